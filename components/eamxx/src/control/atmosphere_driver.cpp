@@ -9,8 +9,12 @@
 #include "share/field/field_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_timing.hpp"
+#include "share/util/eamxx_metrics.hpp"
+#include "share/util/eamxx_kernel_profiler.hpp"
+#include "share/util/eamxx_team_policy_tuner.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -30,6 +34,7 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <fstream>
 #include <random>
 
@@ -129,6 +134,21 @@ set_params(const ekat::ParameterList& atm_params)
 
   create_logger ();
 
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  m_metrics_output_freq = driver_options_pl.get<int>("metrics_output_frequency",0);
+  m_metrics_file = driver_options_pl.get<std::string>("metrics_output_file","eamxx_metrics.jsonl");
+  Metrics::instance().enable(m_metrics_output_freq>0);
+  m_kernel_profiling_file = driver_options_pl.get<std::string>("kernel_profiling_output_file","eamxx_kernels.csv");
+  KernelProfiler::instance().enable(driver_options_pl.get<bool>("kernel_profiling",false));
+
+  // Kernels tuned in previous runs are not tuned again
+  m_team_policy_db_file = driver_options_pl.get<std::string>("autotune_team_policy_database","eamxx_team_policy_db.txt");
+  auto& tuner = TeamPolicyTuner::instance();
+  tuner.enable(driver_options_pl.get<bool>("autotune_team_policy",false));
+  if (tuner.enabled()) {
+    tuner.load(m_team_policy_db_file);
+  }
+
   m_ad_status |= s_params_set;
 }
 
@@ -501,6 +521,7 @@ void AtmosphereDriver::create_fields()
   m_atm_logger->info("[EAMxx] create_fields ...");
   start_timer("EAMxx::init");
   start_timer("EAMxx::create_fields");
+  Metrics::instance().start_region("init");
 
   // Must have grids and procs at this point
   check_ad_status (s_procs_created | s_grids_created);
@@ -666,6 +687,7 @@ void AtmosphereDriver::create_fields()
 
   m_ad_status |= s_fields_created;
 
+  Metrics::instance().stop_region("init");
   stop_timer("EAMxx::create_fields");
   stop_timer("EAMxx::init");
   m_atm_logger->info("[EAMxx] create_fields ... done!");
@@ -891,6 +913,13 @@ void AtmosphereDriver::restart_model ()
 
   m_atm_logger->info("    [EAMxx] Restart filename: " + filename);
 
+  // Open the file once, for the whole restart. Every AtmosphereInput below, as well
+  // as every attribute query, becomes a customer of this open handle, rather than
+  // re-opening the file (and re-inquiring all its dims/vars) every time. It also
+  // means that the PIO decompositions created for the first grid are still around
+  // (and reused) when the fields of the other grids are read.
+  scorpio::register_file(filename,scorpio::Read);
+
   for (auto& it : m_field_mgrs) {
     if (fvphyshack and it.second->get_grid()->name() == "Physics GLL") continue;
     if (not it.second->has_group("RESTART")) {
@@ -932,6 +961,8 @@ void AtmosphereDriver::restart_model ()
     }
   }
 
+  scorpio::release_file(filename);
+
   m_atm_logger->info("  [EAMxx] restart_model ... done!");
 }
 
@@ -1485,7 +1516,7 @@ initialize_constant_field(const FieldIdentifier& fid,
 
       const int n = layout.dim(0);
       auto v = f.get_view<double**>();
-      Kokkos::parallel_for(typename kt::RangePolicy(0,n),
+      Kokkos::parallel_for("AtmosphereDriver::initialize_constant_field", typename kt::RangePolicy(0,n),
                            KOKKOS_LAMBDA(const int i) {
         for (int j=0; j<vec_dim; ++j) {
           v(i,j) = data(j);
@@ -1510,12 +1541,14 @@ void AtmosphereDriver::initialize_atm_procs ()
   m_atm_logger->info("[EAMxx] initialize_atm_procs ...");
   start_timer("EAMxx::init");
   start_timer("EAMxx::initialize_atm_procs");
+  Metrics::instance().start_region("init");
 
   // Initialize memory buffer for all atm processes
   m_memory_buffer = std::make_shared<ATMBufferManager>();
-  m_memory_buffer->request_bytes(m_atm_process_group->requested_buffer_size_in_bytes());
+  m_memory_buffer->request_bytes(m_atm_process_group->total_buffer_size_in_bytes());
   m_memory_buffer->allocate();
   m_atm_process_group->init_buffers(*m_memory_buffer);
+  m_atm_process_group->init_tendencies_buffer(*m_memory_buffer);
 
   const bool restarted_run = m_case_t0 < m_run_t0;
 
@@ -1547,6 +1580,7 @@ void AtmosphereDriver::initialize_atm_procs ()
 
   m_ad_status |= s_procs_inited;
 
+  Metrics::instance().stop_region("init");
   stop_timer("EAMxx::initialize_atm_procs");
   stop_timer("EAMxx::init");
   m_atm_logger->info("[EAMxx] initialize_atm_procs ... done!");
@@ -1587,6 +1621,8 @@ initialize (const ekat::Comm& atm_comm,
 
 void AtmosphereDriver::run (const int dt) {
   start_timer("EAMxx::run");
+  auto& metrics = Metrics::instance();
+  metrics.start_region("run");
 
   // Make sure the end of the time step is after the current start_time
   EKAT_REQUIRE_MSG (dt>0, "Error! Input time step must be positive.\n");
@@ -1652,6 +1688,12 @@ void AtmosphereDriver::run (const int dt) {
   // This way, we give the user a chance to follow the log more real-time.
   m_atm_logger->flush();
 
+  metrics.stop_region("run");
+  metrics.end_step();
+  if (m_metrics_output_freq>0 && metrics.num_steps()==m_metrics_output_freq) {
+    metrics.write(m_atm_comm,m_metrics_file,m_current_ts.to_string());
+  }
+
   stop_timer("EAMxx::run");
 }
 
@@ -1664,6 +1706,36 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
 
   m_atm_logger->info("[EAMxx] Finalize ...");
 
+  // Write metrics of the last (possibly partial) interval. If a region is
+  // still open, we are finalizing after an exception, so don't bother.
+  auto& metrics = Metrics::instance();
+  if (metrics.enabled() && metrics.num_steps()>0 && not metrics.has_open_regions()) {
+    metrics.write(m_atm_comm,m_metrics_file,m_current_ts.to_string());
+  }
+  metrics.enable(false);
+
+  // Write per-kernel times, and show the most expensive ones in the log
+  auto& kernel_profiler = KernelProfiler::instance();
+  if (kernel_profiler.enabled()) {
+    const auto lines = kernel_profiler.write(m_atm_comm,m_kernel_profiling_file);
+    const int num_top = std::min(10,static_cast<int>(lines.size()));
+    m_atm_logger->info("  Most expensive kernels (kernel,num_launches,total_time_min,total_time_max,total_time_mean,time_per_launch):");
+    for (int i=0; i<num_top; ++i) {
+      m_atm_logger->info("    " + lines[i]);
+    }
+    m_atm_logger->info("  Full kernel profile written to " + m_kernel_profiling_file);
+    kernel_profiler.enable(false);
+  }
+
+  // Store the team policies chosen in this run, for the next ones
+  auto& tuner = TeamPolicyTuner::instance();
+  if (tuner.enabled()) {
+    tuner.save(m_atm_comm,m_team_policy_db_file);
+    m_atm_logger->info("  Tuned team policies written to " + m_team_policy_db_file);
+    tuner.enable(false);
+    tuner.clear();
+  }
+
   // Finalize and destroy output streams, make sure files are closed
   for (auto& out_mgr : m_output_managers) {
     out_mgr.finalize();
@@ -247,6 +247,16 @@ protected:
   // Whether GPTL must be finalized by the AD (in certain standalone runs)
   bool m_gptl_externally_handled;
 
+  // If positive, write performance metrics to m_metrics_file every this many steps
+  int m_metrics_output_freq = 0;
+  std::string m_metrics_file;
+
+  // File for the per-kernel profile (if kernel profiling is enabled)
+  std::string m_kernel_profiling_file;
+
+  // Database of tuned team policies (if team policy autotuning is enabled)
+  std::string m_team_policy_db_file;
+
   // Current ad initialization status
   int m_ad_status = 0;
 
@@ -135,7 +135,14 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
   // The export data is of size ncols,num_cpl_exports. All other data is of size num_scream_exports
   m_cpl_exports_view_h = decltype(m_cpl_exports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_exports);
-  m_cpl_exports_view_d = Kokkos::create_mirror_view(DefaultDevice(), m_cpl_exports_view_h);
+  if (cpl_data_is_device_accessible) {
+    // Write cpl data directly in the a2x array (the mirror view is the host view itself)
+    m_cpl_exports_view_d = Kokkos::create_mirror_view(DefaultDevice(), m_cpl_exports_view_h);
+  }
+
+  // Any field not exported by scream is set to 0.0. Since nobody else writes
+  // in the a2x array, we can do this once and for all.
+  Kokkos::deep_copy(m_cpl_exports_view_h, 0.0);
 
   m_export_field_names = new name_t[m_num_scream_exports];
   std::memcpy(m_export_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_exports*32*sizeof(char));
@@ -299,6 +306,26 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   EKAT_REQUIRE_MSG(m_num_scream_exports = m_num_from_file_exports+m_num_const_exports+m_num_from_model_exports,"Error! surface_coupling_exporter - Something went wrong set the type of export for all variables.");
   EKAT_REQUIRE_MSG(m_num_from_model_exports>=0,"Error! surface_coupling_exporter - The number of exports derived from EAMxx < 0, something must have gone wrong in assigning the types of exports for all variables.");
 
+  // Constant exports are set directly in the cpl array, while all other exports are
+  // computed on device. If the device cannot access the cpl array, only the latter
+  // are stored (contiguously) in the device view of cpl data.
+  m_export_constant_values_h = view_1d<HostDevice,Real>("",m_num_scream_exports);
+  int num_dev_exports = 0;
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    if (m_export_source_h(i)==CONSTANT) {
+      m_export_constant_values_h(i) = m_export_constants.at(m_export_field_names_vector[i]);
+      m_column_info_h(i).dev_indx = -1;
+    } else {
+      m_column_info_h(i).dev_indx = cpl_data_is_device_accessible ? m_column_info_h(i).cpl_indx : num_dev_exports;
+      ++num_dev_exports;
+    }
+  }
+  Kokkos::deep_copy(m_column_info_d, m_column_info_h);
+  if (not cpl_data_is_device_accessible) {
+    m_cpl_exports_view_d = decltype(m_cpl_exports_view_d) ("cpl_exports",m_num_cols,num_dev_exports);
+    m_cpl_exports_staging_h = Kokkos::create_mirror_view(m_cpl_exports_view_d);
+  }
+
   // Perform initial export (if any are marked for export during initialization)
   if (any_initial_exports) do_export(0, true);
 }
@@ -431,7 +458,7 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
   // Preprocess exports
   auto export_source = m_export_source;
   const auto setup_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(num_cols, num_levs);
-  Kokkos::parallel_for(setup_policy, KOKKOS_LAMBDA(const Kokkos::TeamPolicy<KT::ExeSpace>::member_type& team) {
+  Kokkos::parallel_for("SurfaceCouplingExporter::compute_eamxx_exports", setup_policy, KOKKOS_LAMBDA(const Kokkos::TeamPolicy<KT::ExeSpace>::member_type& team) {
     const int i = team.league_rank();
 
     // These views are needed by more than one export variable so we declare them here.
@@ -533,30 +560,58 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
 void SurfaceCouplingExporter::do_export_to_cpl(const bool called_during_initialization)
 {
   using policy_type = KT::RangePolicy;
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
+  using host_policy_type = KokkosTypes<HostDevice>::RangePolicy;
+
+  // Any field not exported during initialization is set to 0.0
   const auto cpl_exports_view_d = m_cpl_exports_view_d;
   const int  num_exports        = m_num_scream_exports;
   const int  num_cols           = m_num_cols;
   const auto col_info           = m_column_info_d;
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
-  Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
-
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
+  const auto export_source      = m_export_source;
+
+  // Export to cpl data the non-constant exports
+  if (m_num_const_exports<num_exports) {
+    auto export_policy   = policy_type (0,num_exports*num_cols);
+    Kokkos::parallel_for("SurfaceCouplingExporter::do_export_to_cpl::pack", export_policy, KOKKOS_LAMBDA(const int& i) {
+      const int ifield = i / num_cols;
+      const int icol   = i % num_cols;
+      if (export_source(ifield)==CONSTANT) {
+        return;
+      }
+      const auto& info = col_info(ifield);
+      const auto offset = icol*info.col_stride + info.col_offset;
+
+      // if this is during initialization, check whether or not the field should be exported
+      bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+      cpl_exports_view_d(icol,info.dev_indx) = do_export ? info.constant_multiple*info.data[offset] : 0;
+    });
+
+    if (not cpl_data_is_device_accessible) {
+      Kokkos::deep_copy(m_cpl_exports_staging_h,m_cpl_exports_view_d);
+    } else {
+      Kokkos::fence();
     }
-  });
+  }
 
-  // Deep copy fields from device to cpl host array
-  Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  // On host, set constant exports, and (if needed) scatter the device exports into the cpl array
+  if (m_num_const_exports>0 || not cpl_data_is_device_accessible) {
+    const auto col_info_h         = m_column_info_h;
+    const auto export_source_h    = m_export_source_h;
+    const auto constants_h        = m_export_constant_values_h;
+    const auto staging_h          = m_cpl_exports_staging_h;
+    const auto cpl_exports_view_h = m_cpl_exports_view_h;
+    Kokkos::parallel_for("SurfaceCouplingExporter::do_export_to_cpl::copy_to_cpl", host_policy_type(0,num_cols), [&](const int& icol) {
+      for (int ifield=0; ifield<num_exports; ++ifield) {
+        const auto& info = col_info_h(ifield);
+        if (export_source_h(ifield)==CONSTANT) {
+          bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+          cpl_exports_view_h(icol,info.cpl_indx) = do_export ? info.constant_multiple*constants_h(ifield) : 0;
+        } else if (not cpl_data_is_device_accessible) {
+          cpl_exports_view_h(icol,info.cpl_indx) = staging_h(icol,info.dev_indx);
+        }
+      }
+    });
+  }
 }
 // =========================================================================================
 void SurfaceCouplingExporter::finalize_impl()
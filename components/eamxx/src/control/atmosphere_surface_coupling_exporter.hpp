@@ -137,9 +137,16 @@ protected:
 
   // Views storing a 2d array with dims (num_cols,num_fields) for cpl export data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
-  // pointer to the whole a2x array from Fortran)
+  // pointer to the whole a2x array from Fortran).
+  // If the device cannot access the a2x array directly, the device view only stores
+  // the non-constant scream exports, which are copied to a host staging view, and
+  // then scattered into the a2x array. Constant exports are set directly on host.
   view_2d <DefaultDevice, Real> m_cpl_exports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_exports_view_h;
+  view_2d <DefaultDevice, Real>::HostMirror m_cpl_exports_staging_h;
+
+  // The value of each export, if it is of type CONSTANT
+  view_1d<HostDevice, Real>  m_export_constant_values_h;
 
   // Array storing the field names for exports
   name_t*                   m_export_field_names;
@@ -67,8 +67,14 @@ void SurfaceCouplingImporter::set_grids(const std::shared_ptr<const GridsManager
   // The import data is of size ncols,num_cpl_imports. All other data is of size num_scream_imports
   m_cpl_imports_view_h = decltype(m_cpl_imports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_imports);
-  m_cpl_imports_view_d = Kokkos::create_mirror_view_and_copy(DefaultDevice(),
-                                                             m_cpl_imports_view_h);
+  if (cpl_data_is_device_accessible) {
+    // Read cpl data directly from the x2a array (the mirror view is the host view itself)
+    m_cpl_imports_view_d = Kokkos::create_mirror_view(DefaultDevice(),m_cpl_imports_view_h);
+  } else {
+    // Only the columns imported by scream are transferred to device
+    m_cpl_imports_view_d = decltype(m_cpl_imports_view_d) ("cpl_imports",m_num_cols,m_num_scream_imports);
+    m_cpl_imports_staging_h = Kokkos::create_mirror_view(m_cpl_imports_view_d);
+  }
   m_import_field_names = new name_t[m_num_scream_imports];
   std::memcpy(m_import_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_imports*32*sizeof(char));
 
@@ -116,6 +122,7 @@ void SurfaceCouplingImporter::initialize_impl (const RunType /* run_type */)
 
     // Set index for referencing cpl data.
     m_column_info_h(i).cpl_indx = m_cpl_indices_view(i);
+    m_column_info_h(i).dev_indx = cpl_data_is_device_accessible ? m_cpl_indices_view(i) : i;
   }
 
   // Copy data to device for use in do_import()
@@ -146,12 +153,27 @@ void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
   const int  num_cols           = m_num_cols;
   const int  num_imports        = m_num_scream_imports;
 
-  // Deep copy cpl host array to devic
-  Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  if (not cpl_data_is_device_accessible) {
+    // Gather the imported columns of the cpl host array, and copy only those to device
+    using host_policy_type = KokkosTypes<HostDevice>::RangePolicy;
+
+    const auto col_info_h         = m_column_info_h;
+    const auto cpl_imports_view_h = m_cpl_imports_view_h;
+    const auto staging_h          = m_cpl_imports_staging_h;
+    Kokkos::parallel_for("SurfaceCouplingImporter::do_import::stage", host_policy_type(0,num_cols), [&](const int& icol) {
+      for (int ifield=0; ifield<num_imports; ++ifield) {
+        const auto& info = col_info_h(ifield);
+        if (not called_during_initialization || info.transfer_during_initialization) {
+          staging_h(icol,ifield) = cpl_imports_view_h(icol,info.cpl_indx);
+        }
+      }
+    });
+    Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_staging_h);
+  }
 
   // Unpack the fields
   auto unpack_policy = policy_type(0,num_imports*num_cols);
-  Kokkos::parallel_for(unpack_policy, KOKKOS_LAMBDA(const int& i) {
+  Kokkos::parallel_for("SurfaceCouplingImporter::do_import::unpack", unpack_policy, KOKKOS_LAMBDA(const int& i) {
     const int ifield = i / num_cols;
     const int icol   = i % num_cols;
 
@@ -162,7 +184,7 @@ void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
     // if this is during initialization, check whether or not the field should be imported
     bool do_import = (not called_during_initialization || info.transfer_during_initialization);
     if (do_import) {
-      info.data[offset] = cpl_imports_view_d(icol,info.cpl_indx)*info.constant_multiple;
+      info.data[offset] = cpl_imports_view_d(icol,info.dev_indx)*info.constant_multiple;
     }
   });
 
@@ -223,7 +245,7 @@ void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_in
 
     // Overwrite iop imports with col_val for each column
     auto policy = policy_type(0, m_num_cols);
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& icol) {
+    Kokkos::parallel_for("SurfaceCouplingImporter::overwrite_iop_imports", policy, KOKKOS_LAMBDA(const int& icol) {
       const auto& info_d = col_info_d(ifield);
       const auto offset = icol*info_d.col_stride + info_d.col_offset;
       info_d.data[offset] = col_val;
@@ -79,9 +79,13 @@ protected:
 
   // Views storing a 2d array with dims (num_cols,num_fields) for import data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
-  // pointer to the whole x2a array from Fortran)
+  // pointer to the whole x2a array from Fortran).
+  // If the device cannot access the x2a array directly, the device view only stores
+  // the num_scream_imports columns actually imported, which are first gathered
+  // on host in a staging view, so that only those are transferred to device.
   view_2d <DefaultDevice, Real> m_cpl_imports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_imports_view_h;
+  view_2d <DefaultDevice, Real>::HostMirror m_cpl_imports_staging_h;
 
   // Array storing the field names for imports
   name_t* m_import_field_names;
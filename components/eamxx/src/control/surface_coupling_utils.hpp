@@ -23,6 +23,11 @@ struct SurfaceCouplingColumnInfo {
 
   // Index of this column in cpl data.
   int cpl_indx;
+
+  // Index of this column in the device copy of the cpl data. If the device can access
+  // the cpl data directly, this is the same as cpl_indx. Otherwise, the device copy
+  // only stores the columns transferred by scream, and this is the index among those.
+  int dev_indx;
  
   // Stride between the 1st entry of two consecutive columns to be imported.
   // Note: this is >= that number of scalars in a column. E.g., for a vector field layout like
@@ -51,6 +56,11 @@ struct SurfaceCouplingColumnInfo {
   Real* data;
 };
 
+// If the device can access host memory (e.g., on CPU builds), the cpl arrays
+// can be read/written directly in device kernels, with no staging copies.
+constexpr bool cpl_data_is_device_accessible =
+  Kokkos::SpaceAccessibility<DefaultDevice::execution_space,Kokkos::HostSpace>::accessible;
+
 // For a given field and vector component (set vecComp=-1 for scalar fields),
 // this function calculates the col_offset and col_stride for iterating through
 // surface values. In this case, col_offset is the distance to the surface
@@ -0,0 +1,185 @@
+#include <catch2/catch.hpp>
+
+#include "control/atmosphere_surface_coupling_importer.hpp"
+#include "control/atmosphere_surface_coupling_exporter.hpp"
+#include "share/atm_process/SCDataManager.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <numeric>
+
+namespace scream {
+
+// Micro-benchmark for the transfer of data between the cpl arrays and the eamxx fields.
+// Import/export counts mimic a ne30 coupled run, where mct x2a/a2x arrays store
+// many more fields than the ones scream actually imports/exports.
+// The number of columns and repetitions can be set via
+//   --ekat-test-params ncols=<N>,nrepeat=<N>
+
+namespace {
+
+struct SCData {
+  std::vector<Real>   data;
+  std::vector<char>   names;
+  std::vector<int>    cpl_indices;
+  std::vector<int>    vec_comps;
+  std::vector<Real>   multiples;
+  std::unique_ptr<bool[]> do_init;
+  SCDataManager       mgr;
+
+  SCData (const std::vector<std::pair<std::string,int>>& fields,
+          const int num_cpl_fields, const int ncols)
+   : data(ncols*num_cpl_fields)
+   , names(32*fields.size(),'\0')
+   , cpl_indices(fields.size())
+   , vec_comps(fields.size())
+   , multiples(fields.size(),1)
+   , do_init(new bool[fields.size()])
+  {
+    const int nfields = fields.size();
+    std::iota(data.begin(),data.end(),0);
+    for (int i=0; i<nfields; ++i) {
+      std::strncpy(&names[32*i],fields[i].first.c_str(),31);
+      vec_comps[i] = fields[i].second;
+      // Spread scream fields across the cpl array
+      cpl_indices[i] = (i*num_cpl_fields) / nfields;
+      do_init[i] = false;
+    }
+    mgr.setup_internals(num_cpl_fields,nfields,ncols,data.data(),names.data(),
+                        cpl_indices.data(),vec_comps.data(),multiples.data(),
+                        do_init.get());
+  }
+};
+
+template<typename F>
+double time_it (const int nrepeat, F&& f) {
+  f(); // Warm up
+  Kokkos::fence();
+  auto start = std::chrono::steady_clock::now();
+  for (int i=0; i<nrepeat; ++i) {
+    f();
+  }
+  Kokkos::fence();
+  auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count() / (1e3*nrepeat);
+}
+
+} // anonymous namespace
+
+TEST_CASE ("surface_coupling_bench")
+{
+  using vos_type = std::vector<std::string>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto& session = ekat::TestSession::get();
+  session.params.emplace("ncols","5400");  // ne30pg2 on ~4 ranks
+  session.params.emplace("nrepeat","100");
+  const int ncols   = std::stoi(session.params["ncols"]);
+  const int nrepeat = std::stoi(session.params["nrepeat"]);
+
+  // Number of fields in x2a/a2x in a typical ne30 coupled run
+  constexpr int num_cpl_imports = 48;
+  constexpr int num_cpl_exports = 36;
+
+  // Create a grids manager
+  ekat::ParameterList gm_params;
+  gm_params.set("grids_names",vos_type{"Point Grid"});
+  auto& pl = gm_params.sublist("Point Grid");
+  pl.set<std::string>("type","point_grid");
+  pl.set("aliases",vos_type{"Physics"});
+  pl.set("number_of_global_columns",ncols*comm.size());
+  pl.set("number_of_vertical_levels",72);
+  auto gm = create_mesh_free_grids_manager(comm,gm_params);
+  gm->build_grids();
+  const int nlcols = gm->get_grid("Physics")->get_num_local_dofs();
+
+  auto create_fields = [&](AtmosphereProcess& ap) {
+    for (const auto& req : ap.get_required_field_requests()) {
+      Field f(req.fid);
+      f.get_header().get_alloc_properties().request_allocation(req.pack_size);
+      f.allocate_view();
+      f.deep_copy(1.0);
+      ap.set_required_field(f.get_const());
+    }
+    for (const auto& req : ap.get_computed_field_requests()) {
+      Field f(req.fid);
+      f.get_header().get_alloc_properties().request_allocation(req.pack_size);
+      f.allocate_view();
+      ap.set_computed_field(f);
+    }
+  };
+
+  const util::TimeStamp t0 ({2000,1,1},{0,0,0});
+
+  // Importer
+  {
+    ekat::ParameterList params("importer");
+    params.set<std::string>("log_level","warn");
+    SurfaceCouplingImporter importer(comm,params);
+    importer.set_grids(gm);
+    create_fields(importer);
+
+    SCData sc({{"sfc_alb_dir_vis",-1},{"sfc_alb_dir_nir",-1},{"sfc_alb_dif_vis",-1},
+               {"sfc_alb_dif_nir",-1},{"surf_lw_flux_up",-1},{"surf_sens_flux",-1},
+               {"surf_evap",-1},{"surf_mom_flux",0},{"surf_mom_flux",1},
+               {"surf_radiative_T",-1},{"T_2m",-1},{"qv_2m",-1},{"wind_speed_10m",-1},
+               {"snow_depth_land",-1},{"ocnfrac",-1},{"landfrac",-1}},
+              num_cpl_imports,nlcols);
+    importer.setup_surface_coupling_data(sc.mgr);
+    importer.initialize(t0,RunType::Initial);
+
+    const double ms = time_it(nrepeat,[&](){ importer.do_import(); });
+    if (comm.am_i_root()) {
+      printf(" -> do_import: %d cols, %d/%d fields, %.4f ms/call\n",
+             nlcols,static_cast<int>(sc.cpl_indices.size()),num_cpl_imports,ms);
+    }
+
+    // Check that imported data matches cpl data
+    auto f = importer.get_field_out("ocnfrac");
+    f.sync_to_host();
+    auto v = f.get_view<const Real*,Host>();
+    const int ifield = 14;
+    for (int icol=0; icol<nlcols; ++icol) {
+      REQUIRE (v(icol)==sc.data[icol*num_cpl_imports+sc.cpl_indices[ifield]]);
+    }
+  }
+
+  // Exporter (only the transfer to cpl arrays is timed)
+  {
+    ekat::ParameterList params("exporter");
+    params.set<std::string>("log_level","warn");
+    auto& consts = params.sublist("prescribed_constants");
+    consts.set<vos_type>("fields",{"Sa_pslv"});
+    consts.set<std::vector<Real>>("values",{101325.0});
+    SurfaceCouplingExporter exporter(comm,params);
+    exporter.set_grids(gm);
+    create_fields(exporter);
+
+    SCData sc({{"Sa_z",-1},{"Sa_u",-1},{"Sa_v",-1},{"Sa_tbot",-1},{"Sa_ptem",-1},
+               {"Sa_pbot",-1},{"Sa_shum",-1},{"Sa_dens",-1},{"Sa_pslv",-1},
+               {"Faxa_rainl",-1},{"Faxa_snowl",-1},{"Faxa_swndr",-1},{"Faxa_swvdr",-1},
+               {"Faxa_swndf",-1},{"Faxa_swvdf",-1},{"Faxa_swnet",-1},{"Faxa_lwdn",-1}},
+              num_cpl_exports,nlcols);
+    exporter.setup_surface_coupling_data(sc.mgr);
+    exporter.initialize(t0,RunType::Initial);
+
+    const double ms = time_it(nrepeat,[&](){ exporter.do_export_to_cpl(); });
+    if (comm.am_i_root()) {
+      printf(" -> do_export_to_cpl: %d cols, %d/%d fields, %.4f ms/call\n",
+             nlcols,static_cast<int>(sc.cpl_indices.size()),num_cpl_exports,ms);
+    }
+
+    // Constant exports are set directly in the cpl array
+    const int ifield = 8;
+    for (int icol=0; icol<nlcols; ++icol) {
+      REQUIRE (sc.data[icol*num_cpl_exports+sc.cpl_indices[ifield]]==101325.0);
+    }
+  }
+}
+
+} // namespace scream
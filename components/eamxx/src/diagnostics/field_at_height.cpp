@@ -131,7 +131,7 @@ void FieldAtHeight::compute_diagnostic_impl()
     const auto d_view = m_diagnostic_output.get_view<Real*>();
 
     RangePolicy policy (0,fl.dims()[0]);
-    Kokkos::parallel_for(policy,
+    Kokkos::parallel_for("FieldAtHeight::compute_diagnostic_impl::rank2", policy,
         KOKKOS_LAMBDA(const int i) {
         auto f_i = ekat::subview(f_view,i);
         auto z_i = ekat::subview(z_view,i);
@@ -162,7 +162,7 @@ void FieldAtHeight::compute_diagnostic_impl()
     const auto dim0 = fl.dims()[0];
     const auto dim1 = fl.dims()[1];
     RangePolicy policy (0,dim0*dim1);
-    Kokkos::parallel_for(policy,
+    Kokkos::parallel_for("FieldAtHeight::compute_diagnostic_impl::rank3", policy,
         KOKKOS_LAMBDA(const int idx) {
         const int i = idx / dim1;
         const int j = idx % dim1;
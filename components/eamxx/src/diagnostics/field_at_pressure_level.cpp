@@ -136,7 +136,7 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
     auto diag = m_diagnostic_output.get_view<Real*>();
     auto mask = m_diagnostic_output.get_header().get_extra_data<Field>("mask_data").get_view<Real*>();
     auto f_v  = f.get_view<const Real**>();
-    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int icol) {
+    Kokkos::parallel_for("FieldAtPressureLevel::compute_diagnostic_impl::rank2", policy,KOKKOS_LAMBDA(const int icol) {
       auto x1 = ekat::subview(p_src_v,icol);
       auto y1 = ekat::subview(f_v,icol);
       auto beg = x1.data();
@@ -167,7 +167,7 @@ void FieldAtPressureLevel::compute_diagnostic_impl()
     auto diag = m_diagnostic_output.get_view<Real**>();
     auto mask = m_diagnostic_output.get_header().get_extra_data<Field>("mask_data").get_view<Real*>();
     auto f_v  = f.get_view<const Real***>();
-    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+    Kokkos::parallel_for("FieldAtPressureLevel::compute_diagnostic_impl::rank3", policy,KOKKOS_LAMBDA(const MemberType& team) {
       int icol = team.league_rank();
       auto x1 = ekat::subview(p_src_v,icol);
       auto beg = x1.data();
@@ -81,7 +81,7 @@ static void copy_prev (const int ncols, const int npacks,
   using KT = KokkosTypes<DefaultDevice>;
   using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
   const auto policy = ESU::get_default_team_policy(ncols, npacks);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+  Kokkos::parallel_for("HommeDynamics::copy_prev", policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
     const int& icol = team.league_rank();
     Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npacks),
                          [&] (const int ilev) {
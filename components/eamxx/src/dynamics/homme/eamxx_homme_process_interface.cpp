@@ -390,20 +390,40 @@ void HommeDynamics::initialize_impl (const RunType run_type)
     m_p2d_remapper->registration_begins();
     m_d2p_remapper->registration_begins();
 
-    // ftype==FORCING_0:
-    //  1) remap Q_pgn->FQ_dyn
-    //  2) compute FQ_dyn=dp3d*(FQ_dyn-Q_dyn_old)/dt
-    // ftype!=FORCING_0:
-    //  1) remap Q_pgn->FQ_dyn
-    // Remap Q directly into FQ, tendency computed in pre_process step
-    m_p2d_remapper->register_field(*get_group_out("Q",pgn).m_bundle,m_helper_fields.at("FQ_dyn"));
-    m_p2d_remapper->register_field(m_helper_fields.at("FT_phys"),m_helper_fields.at("FT_dyn"));
+    // The p2d remapper backs out the forcing tendencies on the fly, inside its
+    // local remap kernel, so that no separate pass over phys/dyn fields is needed:
+    //  - FT_dyn = PD( (T_mid-FT_phys)/dt ), with FT_phys storing T_prev
+    //  - FM_dyn = PD( (uv-FM_phys)/dt ), with FM_phys storing uv_prev
+    //  - ftype==FORCING_0: FQ_dyn = dp3d*(PD(Q)-Q_dyn_old)/dt
+    //    ftype!=FORCING_0: FQ_dyn = PD(Q)
+    // Note: Q_dyn and dp3d are DSS-ed Homme states, so they are continuous across
+    //       elements, and the back-out can be done before the halo exchange.
+    auto pd_remapper = std::dynamic_pointer_cast<PhysicsDynamicsRemapper>(m_p2d_remapper);
+    EKAT_REQUIRE_MSG (pd_remapper,
+        "Error! Something went wrong casting the p2d remapper to PhysicsDynamicsRemapper.\n");
+
+    const auto& Q_phys  = *get_group_out("Q",pgn).m_bundle;
+    const auto& FQ_dyn  = m_helper_fields.at("FQ_dyn");
+    m_p2d_remapper->register_field(Q_phys,FQ_dyn);
+    if (params.ftype==Homme::ForcingAlg::FORCING_0) {
+      pd_remapper->set_fwd_tendency(Q_phys,FQ_dyn,m_helper_fields.at("Q_dyn"),get_internal_field("dp3d_dyn"));
+    }
+
+    const auto& T_phys  = get_field_in("T_mid",pgn);
+    const auto& FT_dyn  = m_helper_fields.at("FT_dyn");
+    m_p2d_remapper->register_field(T_phys,FT_dyn);
+    pd_remapper->set_fwd_tendency(T_phys,FT_dyn,m_helper_fields.at("FT_phys"));
 
     // FM has 3 components on dyn grid, but only 2 on phys grid
+    const auto& uv_phys = get_field_in("horiz_winds",pgn);
     auto& FM_phys = m_helper_fields.at("FM_phys");
     auto& FM_dyn  = m_helper_fields.at("FM_dyn");
-    m_p2d_remapper->register_field(FM_phys.get_component(0),FM_dyn.get_component(0));
-    m_p2d_remapper->register_field(FM_phys.get_component(1),FM_dyn.get_component(1));
+    for (int icmp=0; icmp<2; ++icmp) {
+      auto uv_cmp = uv_phys.get_component(icmp);
+      auto FM_cmp = FM_dyn.get_component(icmp);
+      m_p2d_remapper->register_field(uv_cmp,FM_cmp);
+      pd_remapper->set_fwd_tendency(uv_cmp,FM_cmp,FM_phys.get_component(icmp));
+    }
 
     // NOTE: for states, if/when we can remap subfields, we can remap the corresponding internal fields,
     //       which are subviews of the corresponding helper field at time slice np1
@@ -557,69 +577,72 @@ void HommeDynamics::homme_pre_process (const double dt) {
   using namespace Homme;
   const auto& c = Context::singleton();
   const auto& params = c.get<SimulationParams>();
+  auto& tl = c.get<TimeLevel>();
 
-  const int ncols = m_phys_grid->get_num_local_dofs();
-  const int nlevs = m_phys_grid->get_num_vertical_levels();
-  const int npacks = ekat::npack<Pack>(nlevs);
-
-  const auto& pgn = m_phys_grid->name();
+  if (fv_phys_active()) {
+    const int ncols = m_phys_grid->get_num_local_dofs();
+    const int nlevs = m_phys_grid->get_num_vertical_levels();
+    const int npacks = ekat::npack<Pack>(nlevs);
 
-  // At the beginning of the step, FT and FM store T_prev and V_prev,
-  // the temperature and (3d) velocity at the end of the previous
-  // Homme step
-  auto T  = get_field_in("T_mid",pgn).get_view<const Pack**>();
-  auto v  = get_field_in("horiz_winds",pgn).get_view<const Pack***>();
-  auto FT = m_helper_fields.at("FT_phys").get_view<Pack**>();
-  auto FM = m_helper_fields.at("FM_phys").get_view<Pack***>();
-
-  // If there are other atm procs updating the vertical velocity,
-  // then we need to compute forcing for w as well
-  Kokkos::parallel_for(KT::RangePolicy(0,ncols*npacks),
-                       KOKKOS_LAMBDA(const int& idx) {
-    const int icol = idx / npacks;
-    const int ilev = idx % npacks;
-
-    // Temperature forcing
-    // Note: Homme takes care of converting ft into a forcing for vtheta
-    const auto& t_new =  T(icol,ilev);
-    const auto& t_old = FT(icol,ilev);
-          auto& ft    = FT(icol,ilev);
-    ft = (t_new - t_old) / dt;
-
-    // Horizontal velocity forcing
-    const auto& u_new =  v(icol,0,ilev);
-    const auto& u_old = FM(icol,0,ilev);
-          auto& fu    = FM(icol,0,ilev);
-    fu = (u_new - u_old) / dt;
-
-    const auto& v_new =  v(icol,1,ilev);
-    const auto& v_old = FM(icol,1,ilev);
-          auto& fv    = FM(icol,1,ilev);
-    fv = (v_new - v_old) / dt;
-  });
+    const auto& pgn = m_phys_grid->name();
 
-  const auto ftype = params.ftype;
+    // At the beginning of the step, FT and FM store T_prev and V_prev,
+    // the temperature and (3d) velocity at the end of the previous
+    // Homme step
+    auto T  = get_field_in("T_mid",pgn).get_view<const Pack**>();
+    auto v  = get_field_in("horiz_winds",pgn).get_view<const Pack***>();
+    auto FT = m_helper_fields.at("FT_phys").get_view<Pack**>();
+    auto FM = m_helper_fields.at("FM_phys").get_view<Pack***>();
+
+    // If there are other atm procs updating the vertical velocity,
+    // then we need to compute forcing for w as well
+    Kokkos::parallel_for("HommeDynamics::homme_pre_process::temp_and_vel_forcing", KT::RangePolicy(0,ncols*npacks),
+                         KOKKOS_LAMBDA(const int& idx) {
+      const int icol = idx / npacks;
+      const int ilev = idx % npacks;
+
+      // Temperature forcing
+      // Note: Homme takes care of converting ft into a forcing for vtheta
+      const auto& t_new =  T(icol,ilev);
+      const auto& t_old = FT(icol,ilev);
+            auto& ft    = FT(icol,ilev);
+      ft = (t_new - t_old) / dt;
+
+      // Horizontal velocity forcing
+      const auto& u_new =  v(icol,0,ilev);
+      const auto& u_old = FM(icol,0,ilev);
+            auto& fu    = FM(icol,0,ilev);
+      fu = (u_new - u_old) / dt;
+
+      const auto& v_new =  v(icol,1,ilev);
+      const auto& v_old = FM(icol,1,ilev);
+            auto& fv    = FM(icol,1,ilev);
+      fv = (v_new - v_old) / dt;
+    });
 
-  if (fv_phys_active()) {
     fv_phys_pre_process();
   } else {
-    // Remap FT, FM, and Q->FQ
-    m_p2d_remapper->remap(true);
+    // Remap T, uv, and Q, backing out FT, FM, and FQ on the fly.
+    // The FQ back-out (for ftype=0) uses dp3d at the time level
+    // where pd coupling remaps into.
+    get_internal_field("dp3d_dyn").get_header().get_alloc_properties().reset_subview_idx(tl.n0);
+    auto pd_remapper = std::static_pointer_cast<PhysicsDynamicsRemapper>(m_p2d_remapper);
+    pd_remapper->set_fwd_tendency_dt(dt);
+    pd_remapper->remap(true);
   }
 
-  auto& tl = c.get<TimeLevel>();
-
   // Note: np1_qdp and n0_qdp are 'deduced' from tl.nstep, so the
   //       following call may not even change them (i.e., they are
   //       not updated regardless). So if they were already up-to-date,
   //       the following call will do nothing.
   tl.update_tracers_levels(params.qsplit);
 
-  // At this point, FQ contains Qnew (coming from physics).
+  // For fv_phys, FQ contains Qnew (coming from physics).
   // Depending on ftype, we are going to do different things:
   //  ftype=0: FQ = dp*(Qnew-Qold) / dt
   //  ftype=2: nothing
-  if (ftype == ForcingAlg::FORCING_0) {
+  // For the GLL phys grid, the p2d remapper already took care of it.
+  if (fv_phys_active() && params.ftype == ForcingAlg::FORCING_0) {
     // Back out tracers tendency for Qdp
     const auto& tracers = c.get<Tracers>();
     const auto& state = c.get<ElementsState>();
@@ -629,8 +652,7 @@ void HommeDynamics::homme_pre_process (const double dt) {
     const auto n0 = tl.n0;  // The time level where pd coupling remapped into
     constexpr int NVL = HOMMEXX_NUM_LEV;
     const int qsize = params.qsize;
-    const auto Q_dyn = m_helper_fields.at("Q_dyn").get_view<Homme::Scalar*****>();
-    Kokkos::parallel_for(Kokkos::RangePolicy<>(0,Q.size()),KOKKOS_LAMBDA(const int idx) {
+    Kokkos::parallel_for("HommeDynamics::homme_pre_process::tracers_forcing", Kokkos::RangePolicy<>(0,Q.size()),KOKKOS_LAMBDA(const int idx) {
       const int ie = idx / (qsize*NP*NP*NVL);
       const int iq = (idx / (NP*NP*NVL)) % qsize;
       const int ip = (idx / (NP*NVL)) % NP;
@@ -646,8 +668,8 @@ void HommeDynamics::homme_pre_process (const double dt) {
       fq /= dt;
       fq *= dp;
     });
-    Kokkos::fence();
   }
+  Kokkos::fence();
 }
 
 void HommeDynamics::homme_post_process (const double dt) {
@@ -712,7 +734,7 @@ void HommeDynamics::homme_post_process (const double dt) {
   const auto& hvcoord = c.get<Homme::HybridVCoord>();
   const auto ps0 = hvcoord.ps0 * hvcoord.hybrid_ai0;
 
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+  Kokkos::parallel_for("HommeDynamics::homme_post_process", policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
     const int& icol = team.league_rank();
 
     auto qv  = ekat::subview(Q_view,icol,0);
@@ -989,7 +1011,7 @@ void HommeDynamics::restart_homme_state () {
   auto Qdp_dyn_view = get_internal_field("Qdp_dyn",dgn).get_view<Pack*****>();
   auto Q_dyn_view = m_helper_fields.at("Q_dyn").get_view<Pack*****>();
   auto dp_dyn_view = get_internal_field("dp3d_dyn",dgn).get_view<Pack****>();
-  Kokkos::parallel_for(Kokkos::RangePolicy<>(0,nelem*qsize*NGP*NGP*npacks),
+  Kokkos::parallel_for("HommeDynamics::restart_homme_state::q_from_qdp", Kokkos::RangePolicy<>(0,nelem*qsize*NGP*NGP*npacks),
                        KOKKOS_LAMBDA (const int idx) {
     const int ie =  idx / (qsize*NGP*NGP*npacks);
     const int iq = (idx / (NGP*NGP*npacks)) % qsize;
@@ -1040,7 +1062,7 @@ void HommeDynamics::restart_homme_state () {
   auto qv_view     = qv_prev_ref->get_view<Pack**>();
 
   const auto policy = ESU::get_default_team_policy(ncols,npacks);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team){
+  Kokkos::parallel_for("HommeDynamics::restart_homme_state::phys_state", policy, KOKKOS_LAMBDA (const KT::MemberType& team){
     const int icol = team.league_rank();
 
     auto p_mid = ekat::subview(p_mid_view,icol);
@@ -1094,7 +1116,7 @@ void HommeDynamics::initialize_homme_state () {
   const auto hyai = hvcoord.hybrid_ai;
   const auto hybi = hvcoord.hybrid_bi;
   const auto policy_dp = ESU::get_default_team_policy(ncols, nlevs);
-  Kokkos::parallel_for(policy_dp, KOKKOS_LAMBDA (const KT::MemberType& team) {
+  Kokkos::parallel_for("HommeDynamics::initialize_homme_state::dp_phys", policy_dp, KOKKOS_LAMBDA (const KT::MemberType& team) {
     const int icol = team.league_rank();
     Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs),
                         [&](const int ilev) {
@@ -1140,7 +1162,7 @@ void HommeDynamics::initialize_homme_state () {
   // Need two temporaries, for pi_mid and pi_int
   const auto policy = ESU::get_thread_range_parallel_scan_team_policy(nelem*NGP*NGP,npacks_mid);
   WorkspaceMgr wsm(npacks_int,2,policy);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+  Kokkos::parallel_for("HommeDynamics::initialize_homme_state::dyn_state", policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
     const int ie  =  team.league_rank() / (NGP*NGP);
     const int igp = (team.league_rank() / NGP) % NGP;
     const int jgp =  team.league_rank() % NGP;
@@ -1207,7 +1229,7 @@ void HommeDynamics::initialize_homme_state () {
   const auto qdp = tracers.qdp;
   const auto q   = tracers.Q;
   const auto dp  = c.get<Homme::ElementsState>().m_dp3d;
-  Kokkos::parallel_for(Kokkos::RangePolicy<>(0,nelem*qsize*NGP*NGP*npacks_mid),
+  Kokkos::parallel_for("HommeDynamics::initialize_homme_state::qdp", Kokkos::RangePolicy<>(0,nelem*qsize*NGP*NGP*npacks_mid),
                        KOKKOS_LAMBDA (const int idx) {
     const int ie =  idx / (qsize*NGP*NGP*npacks_mid);
     const int iq = (idx / (NGP*NGP*npacks_mid)) % qsize;
@@ -1304,7 +1326,7 @@ void HommeDynamics::update_pressure(const std::shared_ptr<const AbstractGrid>& g
 
   using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
   const auto policy = ESU::get_thread_range_parallel_scan_team_policy(ncols,npacks);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+  Kokkos::parallel_for("HommeDynamics::update_pressure", policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
     const int& icol = team.league_rank();
 
     auto dp = ekat::subview(dp_view,icol);
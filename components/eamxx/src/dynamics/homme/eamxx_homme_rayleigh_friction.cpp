@@ -43,7 +43,7 @@ void HommeDynamics::rayleigh_friction_init()
   auto otau = m_otau;
   auto rayk0 = m_rayk0;
 
-  Kokkos::parallel_for(KT::RangePolicy(0, npacks),
+  Kokkos::parallel_for("HommeDynamics::rayleigh_friction_init", KT::RangePolicy(0, npacks),
                        KOKKOS_LAMBDA (const int ilev) {
     const auto range_pack = ekat::range<Pack>(ilev*Pack::n);
     const Pack x = (rayk0 - range_pack)/krange;
@@ -70,7 +70,7 @@ void HommeDynamics::rayleigh_friction_apply(const Real dt) const
   auto otau = m_otau;
 
   const auto policy = ESU::get_default_team_policy(ncols, npacks);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+  Kokkos::parallel_for("HommeDynamics::rayleigh_friction_apply", policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
     const int& icol = team.league_rank();
 
     auto u_wind = ekat::subview(horiz_winds_view, icol, 0);
@@ -178,6 +178,65 @@ do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
   }
 }
 
+void PhysicsDynamicsRemapper::
+set_fwd_tendency (const field_type& src, const field_type& tgt,
+                  const field_type& prev, const field_type& weight)
+{
+  EKAT_REQUIRE_MSG (this->m_state==RepoState::Open,
+      "Error! Tendency back-out must be set during the registration phase.\n");
+
+  const auto& src_fid = src.get_header().get_identifier();
+  const auto& tgt_fid = tgt.get_header().get_identifier();
+  const int ifield = find_field(src_fid,tgt_fid);
+  EKAT_REQUIRE_MSG (ifield>=0,
+      "Error! The src/tgt field pair\n"
+      "         " + src_fid.get_id_string() + "\n"
+      "         " + tgt_fid.get_id_string() + "\n"
+      "       was not registered. Please, register fields before setting a tendency back-out.\n");
+
+  const auto& src_layout = src_fid.get_layout();
+  const auto& tgt_layout = tgt_fid.get_layout();
+  const auto lt = src_layout.type();
+  EKAT_REQUIRE_MSG (lt==LayoutType::Scalar3D || lt==LayoutType::Vector3D,
+      "Error! Tendency back-out only supported for 3d fields.\n"
+      " - src field: " + src_fid.name() + "\n");
+
+  EKAT_REQUIRE_MSG (prev.is_allocated(),
+      "Error! Previous-state field for tendency back-out is not allocated.\n"
+      " - src field: " + src_fid.name() + "\n");
+  const auto& prev_layout = prev.get_header().get_identifier().get_layout();
+  const auto& prev_grid   = prev.get_header().get_identifier().get_grid_name();
+  if (prev_grid==m_phys_grid->name()) {
+    EKAT_REQUIRE_MSG (prev_layout==src_layout,
+        "Error! Previous-state field on phys grid must have the same layout as src field.\n"
+        " - src layout : " + src_layout.to_string() + "\n"
+        " - prev layout: " + prev_layout.to_string() + "\n");
+    EKAT_REQUIRE_MSG (not weight.is_allocated(),
+        "Error! Tendency weight is only supported for previous-state fields on the dyn grid.\n");
+  } else {
+    EKAT_REQUIRE_MSG (prev_grid==m_dyn_grid->name(),
+        "Error! Previous-state field must be on either the phys or the dyn grid.\n"
+        " - prev grid: " + prev_grid + "\n");
+    EKAT_REQUIRE_MSG (prev_layout==tgt_layout,
+        "Error! Previous-state field on dyn grid must have the same layout as tgt field.\n"
+        " - tgt layout : " + tgt_layout.to_string() + "\n"
+        " - prev layout: " + prev_layout.to_string() + "\n");
+  }
+
+  if (weight.is_allocated()) {
+    const auto& w_fid = weight.get_header().get_identifier();
+    EKAT_REQUIRE_MSG (w_fid.get_grid_name()==m_dyn_grid->name() &&
+                      w_fid.get_layout().type()==LayoutType::Scalar3D &&
+                      w_fid.get_layout().dims().back()==tgt_layout.dims().back(),
+        "Error! Tendency weight must be a Scalar3D field on the dyn grid, with the same\n"
+        "       number of levels as the tgt field.\n"
+        " - weight field : " + w_fid.name() + "\n"
+        " - weight layout: " + w_fid.get_layout().to_string() + "\n");
+    m_tend_weight[ifield] = weight;
+  }
+  m_tend_prev[ifield] = prev;
+}
+
 void PhysicsDynamicsRemapper::
 do_registration_ends ()
 {
@@ -266,15 +325,26 @@ initialize_device_variables()
     const bool is_field_3d = lt==LayoutType::Scalar3D || lt==LayoutType::Vector3D;
     h_num_levels(i) = is_field_3d ? pl.dims().back() : -1;
 
-    const auto& pap = ph.get_alloc_properties();
-    const auto& dap = dh.get_alloc_properties();
-    if (is_field_3d &&
-        pap.template is_compatible<pack_type>() &&
-        dap.template is_compatible<pack_type>()) {
+    // Fields used for tendency back-out (if any) must also be pack-compatible
+    std::vector<const FieldAllocProp*> aps = {&ph.get_alloc_properties(), &dh.get_alloc_properties()};
+    if (m_tend_prev.count(i)==1) {
+      aps.push_back(&m_tend_prev.at(i).get_header().get_alloc_properties());
+    }
+    if (m_tend_weight.count(i)==1) {
+      aps.push_back(&m_tend_weight.at(i).get_header().get_alloc_properties());
+    }
+    auto all_compatible = [&](auto pack) {
+      using PackT = decltype(pack);
+      for (auto ap : aps) {
+        if (not ap->template is_compatible<PackT>()) {
+          return false;
+        }
+      }
+      return true;
+    };
+    if (is_field_3d && all_compatible(pack_type())) {
       h_pack_alloc_property(i) = AllocPropType::PackAlloc;
-    } else if (is_field_3d &&
-               pap.template is_compatible<small_pack_type>() &&
-               dap.template is_compatible<small_pack_type>()) {
+    } else if (is_field_3d && all_compatible(small_pack_type())) {
       h_pack_alloc_property(i) = AllocPropType::SmallPackAlloc;
     } else {
       h_pack_alloc_property(i) = AllocPropType::RealAlloc;
@@ -283,6 +353,59 @@ initialize_device_variables()
   Kokkos::deep_copy(m_layout,              h_layout             );
   Kokkos::deep_copy(m_pack_alloc_property, h_pack_alloc_property);
   Kokkos::deep_copy(m_num_levels,          h_num_levels         );
+
+  // Tendency back-out info (see set_fwd_tendency)
+  m_tend_type       = decltype(m_tend_type)       ("tend_type", this->m_num_fields);
+  m_tend_has_weight = decltype(m_tend_has_weight) ("tend_has_weight", this->m_num_fields);
+  auto h_tend_type       = Kokkos::create_mirror_view(m_tend_type);
+  auto h_tend_has_weight = Kokkos::create_mirror_view(m_tend_has_weight);
+  for (int i=0; i<this->m_num_fields; ++i) {
+    h_tend_type(i) = TendencyType::NoTend;
+    h_tend_has_weight(i) = 0;
+    if (m_tend_prev.count(i)==0) {
+      continue;
+    }
+    const auto& prev_grid = m_tend_prev.at(i).get_header().get_identifier().get_grid_name();
+    h_tend_type(i) = prev_grid==m_phys_grid->name() ? TendencyType::PhysPrevTend
+                                                    : TendencyType::DynPrevTend;
+    h_tend_has_weight(i) = m_tend_weight.count(i);
+  }
+  Kokkos::deep_copy(m_tend_type,       h_tend_type      );
+  Kokkos::deep_copy(m_tend_has_weight, h_tend_has_weight);
+
+  for (auto repo : {&m_tend_prev_repo, &m_tend_weight_repo}) {
+    repo->cviews   = ViewsRepo::cviews_t("cviews",this->m_num_fields);
+    repo->h_cviews = Kokkos::create_mirror_view(repo->cviews);
+  }
+  update_tendency_views();
+}
+
+void PhysicsDynamicsRemapper::
+update_tendency_views () const
+{
+  if (m_tend_prev.size()==0) {
+    return;
+  }
+
+  auto get_cview = [&] (const int i, const Field& f, const ViewsRepo& repo) {
+    const auto rank = f.get_header().get_identifier().get_layout().rank();
+    switch (rank) {
+      case 2: repo.h_cviews[i].v2d = f.get_view<const Real**>();     break;
+      case 3: repo.h_cviews[i].v3d = f.get_view<const Real***>();    break;
+      case 4: repo.h_cviews[i].v4d = f.get_view<const Real****>();   break;
+      case 5: repo.h_cviews[i].v5d = f.get_view<const Real*****>();  break;
+    }
+  };
+
+  // Note: these may be dynamic subfields, so re-extract the views regardless
+  for (const auto& it : m_tend_prev) {
+    get_cview(it.first,it.second,m_tend_prev_repo);
+  }
+  for (const auto& it : m_tend_weight) {
+    get_cview(it.first,it.second,m_tend_weight_repo);
+  }
+  Kokkos::deep_copy(m_tend_prev_repo.cviews,   m_tend_prev_repo.h_cviews);
+  Kokkos::deep_copy(m_tend_weight_repo.cviews, m_tend_weight_repo.h_cviews);
 }
 
 bool PhysicsDynamicsRemapper::
@@ -410,6 +533,7 @@ do_remap_fwd()
 
   // Check if we need to update the views for subfields on phys grid
   update_subfields_views(m_subfield_info_phys,m_phys_repo,m_phys_fields);
+  update_tendency_views();
 
   using TeamPolicy = typename KT::TeamTagPolicy<RemapFwdTag>;
 
@@ -434,7 +558,7 @@ do_remap_fwd()
 
   // TeamPolicy over this->m_num_fields
   const TeamPolicy policy(this->m_num_fields,team_size);
-  Kokkos::parallel_for(policy, *this);
+  Kokkos::parallel_for("PhysicsDynamicsRemapper::do_remap_fwd", policy, *this);
   Kokkos::fence();
 
   // Exchange element halo
@@ -462,7 +586,7 @@ do_remap_bwd()
   // here we do not require setting dyn=0, allowing us to extend
   // the TeamPolicy
   const TeamPolicy policy(this->m_num_fields*m_num_phys_cols,team_size);
-  Kokkos::parallel_for(policy, *this);
+  Kokkos::parallel_for("PhysicsDynamicsRemapper::do_remap_bwd", policy, *this);
   Kokkos::fence();
 }
 
@@ -618,14 +742,57 @@ local_remap_fwd_3d (const MT& team) const
       auto dyn  = pack_view<      ScalarT>(m_dyn_repo.views[i].v4d);
 
       const auto tr = Kokkos::TeamVectorRange(team, m_num_phys_cols*num_packs);
-      const auto f = [&] (const int idx) {
-        const int icol = idx / num_packs;
-        const int ilev = idx % num_packs;
-
-        const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-        dyn(elgp[0],elgp[1],elgp[2],ilev) = phys(icol,ilev);
-      };
-      Kokkos::parallel_for(tr, f);
+      switch (m_tend_type(i)) {
+        case TendencyType::NoTend:
+        {
+          const auto f = [&] (const int idx) {
+            const int icol = idx / num_packs;
+            const int ilev = idx % num_packs;
+
+            const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
+            dyn(elgp[0],elgp[1],elgp[2],ilev) = phys(icol,ilev);
+          };
+          Kokkos::parallel_for(tr, f);
+          break;
+        }
+        case TendencyType::PhysPrevTend:
+        {
+          auto prev = pack_view<const ScalarT>(m_tend_prev_repo.cviews[i].v2d);
+          const auto f = [&] (const int idx) {
+            const int icol = idx / num_packs;
+            const int ilev = idx % num_packs;
+
+            const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
+            dyn(elgp[0],elgp[1],elgp[2],ilev) = (phys(icol,ilev) - prev(icol,ilev)) / m_tend_dt;
+          };
+          Kokkos::parallel_for(tr, f);
+          break;
+        }
+        case TendencyType::DynPrevTend:
+        {
+          const bool has_weight = m_tend_has_weight(i);
+          auto prev = pack_view<const ScalarT>(m_tend_prev_repo.cviews[i].v4d);
+          auto w    = has_weight ? pack_view<const ScalarT>(m_tend_weight_repo.cviews[i].v4d)
+                                 : view_Nd<const ScalarT,4>();
+          const auto f = [&] (const int idx) {
+            const int icol = idx / num_packs;
+            const int ilev = idx % num_packs;
+
+            const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
+            auto& d = dyn(elgp[0],elgp[1],elgp[2],ilev);
+            d  = phys(icol,ilev);
+            d -= prev(elgp[0],elgp[1],elgp[2],ilev);
+            d /= m_tend_dt;
+            if (has_weight) {
+              d *= w(elgp[0],elgp[1],elgp[2],ilev);
+            }
+          };
+          Kokkos::parallel_for(tr, f);
+          break;
+        }
+        default:
+          EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
+      }
       break;
     }
     case etoi(LayoutType::Vector3D):
@@ -635,15 +802,60 @@ local_remap_fwd_3d (const MT& team) const
       const int vec_dim = phys.extent(1);
 
       const auto tr = Kokkos::TeamVectorRange(team, m_num_phys_cols*vec_dim*num_packs);
-      const auto f = [&] (const int idx) {
-        const int icol = (idx / num_packs) / vec_dim;
-        const int idim = (idx / num_packs) % vec_dim;
-        const int ilev =  idx % num_packs;
-
-        const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
-        dyn(elgp[0],idim,elgp[1],elgp[2],ilev) = phys(icol,idim,ilev);
-      };
-      Kokkos::parallel_for(tr, f);
+      switch (m_tend_type(i)) {
+        case TendencyType::NoTend:
+        {
+          const auto f = [&] (const int idx) {
+            const int icol = (idx / num_packs) / vec_dim;
+            const int idim = (idx / num_packs) % vec_dim;
+            const int ilev =  idx % num_packs;
+
+            const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
+            dyn(elgp[0],idim,elgp[1],elgp[2],ilev) = phys(icol,idim,ilev);
+          };
+          Kokkos::parallel_for(tr, f);
+          break;
+        }
+        case TendencyType::PhysPrevTend:
+        {
+          auto prev = pack_view<const ScalarT>(m_tend_prev_repo.cviews[i].v3d);
+          const auto f = [&] (const int idx) {
+            const int icol = (idx / num_packs) / vec_dim;
+            const int idim = (idx / num_packs) % vec_dim;
+            const int ilev =  idx % num_packs;
+
+            const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
+            dyn(elgp[0],idim,elgp[1],elgp[2],ilev) = (phys(icol,idim,ilev) - prev(icol,idim,ilev)) / m_tend_dt;
+          };
+          Kokkos::parallel_for(tr, f);
+          break;
+        }
+        case TendencyType::DynPrevTend:
+        {
+          const bool has_weight = m_tend_has_weight(i);
+          auto prev = pack_view<const ScalarT>(m_tend_prev_repo.cviews[i].v5d);
+          auto w    = has_weight ? pack_view<const ScalarT>(m_tend_weight_repo.cviews[i].v4d)
+                                 : view_Nd<const ScalarT,4>();
+          const auto f = [&] (const int idx) {
+            const int icol = (idx / num_packs) / vec_dim;
+            const int idim = (idx / num_packs) % vec_dim;
+            const int ilev =  idx % num_packs;
+
+            const auto& elgp = Kokkos::subview(m_lid2elgp,m_p2d(icol),Kokkos::ALL());
+            auto& d = dyn(elgp[0],idim,elgp[1],elgp[2],ilev);
+            d  = phys(icol,idim,ilev);
+            d -= prev(elgp[0],idim,elgp[1],elgp[2],ilev);
+            d /= m_tend_dt;
+            if (has_weight) {
+              d *= w(elgp[0],elgp[1],elgp[2],ilev);
+            }
+          };
+          Kokkos::parallel_for(tr, f);
+          break;
+        }
+        default:
+          EKAT_KERNEL_ERROR_MSG("Error! Unhandled case in switch statement.\n");
+      }
       break;
     }
     default:
@@ -751,7 +963,7 @@ create_p2d_map () {
   m_p2d = decltype(m_p2d) ("",num_phys_dofs);
   auto p2d = m_p2d;
 
-  Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idof){
+  Kokkos::parallel_for("PhysicsDynamicsRemapper::create_p2d_map", policy,KOKKOS_LAMBDA(const int idof){
     auto gid = phys_gids(idof);
     bool found = false;
     for (int i=0; i<num_dyn_dofs; ++i) {
@@ -49,6 +49,24 @@ public:
     return src.type()==tgt.type();
   }
 
+  // Instruct the fwd remap of the src/tgt pair to back out a tendency on the fly,
+  // rather than copying the src values. Namely, the local remap computes
+  //    tgt = (src - prev) / dt
+  // if prev is on the phys grid (same layout as src), or
+  //    tgt = (src - prev) / dt * weight
+  // if prev is on the dyn grid (same layout as tgt). The (optional) weight must
+  // be a Scalar3D field on the dyn grid, and is applied to all the components.
+  // Note: dyn entries not hit by a phys column are still set to zero before the
+  //       halo exchange, so prev/weight on the dyn grid must be continuous across
+  //       elements (e.g., a DSS-ed Homme state) for the result to match a back-out
+  //       performed on the dyn grid after the exchange.
+  // Note: must be called after the pair is registered, and before registration_ends.
+  void set_fwd_tendency (const field_type& src, const field_type& tgt,
+                         const field_type& prev, const field_type& weight = field_type());
+
+  // The dt used in the tendencies back-out (see set_fwd_tendency)
+  void set_fwd_tendency_dt (const Real dt) { m_tend_dt = dt; }
+
 protected:
 
   // Getters
@@ -99,6 +117,12 @@ public:
     RealAlloc      = 2
   };
 
+  enum TendencyType : int {
+    NoTend       = 0,
+    PhysPrevTend = 1,
+    DynPrevTend  = 2
+  };
+
   // A container structure to hold the physically-shaped views for the fields.
   // Notice that only one of the vNd will be set, while the others will be empty.
   template<typename T>
@@ -130,6 +154,18 @@ protected:
   ViewsRepo   m_phys_repo;
   ViewsRepo   m_dyn_repo;
 
+  // Fields needed to back out tendencies during fwd remap (see set_fwd_tendency).
+  // Only the const views of the repos are used. Since these fields may be dynamic
+  // subfields (e.g., a time slice of a Homme state), the views are refreshed at
+  // every fwd remap.
+  std::map<int,field_type>  m_tend_prev;
+  std::map<int,field_type>  m_tend_weight;
+  ViewsRepo                 m_tend_prev_repo;
+  ViewsRepo                 m_tend_weight_repo;
+  view_1d<Int>              m_tend_type;
+  view_1d<Int>              m_tend_has_weight;
+  Real                      m_tend_dt = 1;
+
   // NOTE: one could deduce from OldViewT whether the return type
   //       should have a const value type. But the code is a bit tedious,
   //       so we'll just force to call this as pack_view<const T>(v).
@@ -170,6 +206,7 @@ protected:
   std::map<int,SubviewInfo> m_subfield_info_phys;
 
   void initialize_device_variables();
+  void update_tendency_views () const;
 
   bool subfields_info_has_changed (const std::map<int,SubviewInfo>& subfield_info,
                                    const std::vector<field_type>& fields) const;
@@ -1108,4 +1108,156 @@ TEST_CASE("combo_remap", "") {
   cleanup_test_f90();
 }
 
+TEST_CASE("tendency_remap", "") {
+
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+
+  // Some type defs
+  using Remapper = PhysicsDynamicsRemapper;
+  using FID = FieldIdentifier;
+  using FL  = FieldLayout;
+  using gid_type = AbstractGrid::gid_type;
+
+  constexpr int pg_gll = 0;
+  constexpr int PackSize = HOMMEXX_VECTOR_SIZE;
+
+  // Create a comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Init homme context
+  if (!is_parallel_inited_f90()) {
+    auto comm_f = MPI_Comm_c2f(MPI_COMM_WORLD);
+    init_parallel_f90(comm_f);
+  }
+  init_test_params_f90 ();
+
+  auto& c = Homme::Context::singleton();
+  auto& sp = c.create<Homme::SimulationParams>();
+  sp.qsize = std::max(HOMMEXX_QSIZE_D/2,1);
+
+  constexpr int ne = 2;
+  set_homme_param("ne",ne);
+
+  // Create the grids
+  ekat::ParameterList params;
+  params.set<std::string>("physics_grid_type","GLL");
+  params.set<std::string>("vertical_coordinate_filename","NONE");
+  HommeGridsManager gm(comm,params);
+  gm.build_grids();
+
+  const int num_local_elems = get_num_local_elems_f90();
+  const int num_local_cols = get_num_local_columns_f90(pg_gll);
+  EKAT_REQUIRE_MSG(num_local_cols>0, "Internal test error! Fix homme_pd_remap_tests, please.\n");
+
+  auto phys_grid = gm.get_grid("Physics GLL");
+  auto dyn_grid  = std::dynamic_pointer_cast<const SEGrid>(gm.get_grid("Dynamics"));
+  auto h_p_dofs = phys_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto h_d_dofs = dyn_grid->get_cg_dofs_gids().get_view<const gid_type*,Host>();
+  auto h_d_lid2idx = dyn_grid->get_lid_to_idx_map().get_view<const int**,Host>();
+
+  constexpr int np  = HOMMEXX_NP;
+  constexpr int NVL = HOMMEXX_NUM_PHYSICAL_LEV;
+  const int nle = num_local_elems;
+  const int nlc = num_local_cols;
+  const auto units = ekat::units::m;  // Placeholder units (we don't care about units here)
+  const auto dgn = dyn_grid->name();
+  const auto pgn = phys_grid->name();
+
+  // s: prev state on phys grid. v: prev state (and weight) on dyn grid
+  FID s_phys_fid  ("s_phys",  FL({COL,     LEV},{nlc,     NVL}),units,pgn);
+  FID s_prev_fid  ("s_prev",  FL({COL,     LEV},{nlc,     NVL}),units,pgn);
+  FID s_dyn_fid   ("s_dyn",   FL({EL,  GP,GP,LEV},{nle,  np,np,NVL}),units,dgn);
+  FID v_phys_fid  ("v_phys",  FL({COL,CMP, LEV},{nlc,2,   NVL}),units,pgn);
+  FID v_dyn_fid   ("v_dyn",   FL({EL,CMP,GP,GP,LEV},{nle,2,np,np,NVL}),units,dgn);
+  FID v_prev_fid  ("v_prev",  FL({EL,CMP,GP,GP,LEV},{nle,2,np,np,NVL}),units,dgn);
+  FID w_fid       ("w",       FL({EL,  GP,GP,LEV},{nle,  np,np,NVL}),units,dgn);
+
+  std::vector<Field> fields;
+  for (const auto& fid : {s_phys_fid,s_prev_fid,s_dyn_fid,v_phys_fid,v_dyn_fid,v_prev_fid,w_fid}) {
+    fields.emplace_back(fid);
+    fields.back().get_header().get_alloc_properties().request_allocation(PackSize);
+    fields.back().allocate_view();
+  }
+  auto& s_phys = fields[0];
+  auto& s_prev = fields[1];
+  auto& s_dyn  = fields[2];
+  auto& v_phys = fields[3];
+  auto& v_dyn  = fields[4];
+  auto& v_prev = fields[5];
+  auto& w      = fields[6];
+
+  std::shared_ptr<Remapper> remapper(new Remapper(phys_grid,dyn_grid));
+  remapper->registration_begins();
+  remapper->register_field(s_phys,s_dyn);
+  remapper->register_field(v_phys,v_dyn);
+  remapper->set_fwd_tendency(s_phys,s_dyn,s_prev);
+  remapper->set_fwd_tendency(v_phys,v_dyn,v_prev,w);
+  remapper->registration_ends();
+
+  // Use gids as values, so that dyn prev/weight are continuous across elements.
+  // With dt=2, all operations below are exact.
+  const Real dt = 2;
+  {
+    auto h_s_phys = s_phys.get_view<Real**,Host>();
+    auto h_s_prev = s_prev.get_view<Real**,Host>();
+    auto h_v_phys = v_phys.get_view<Real***,Host>();
+    for (int idof=0; idof<nlc; ++idof) {
+      const Real gid = h_p_dofs(idof);
+      for (int il=0; il<NVL; ++il) {
+        h_s_phys(idof,il) = gid;
+        h_s_prev(idof,il) = gid/2;
+        h_v_phys(idof,0,il) = gid;
+        h_v_phys(idof,1,il) = 2*gid;
+      }
+    }
+    auto h_v_prev = v_prev.get_view<Real*****,Host>();
+    auto h_w      = w.get_view<Real****,Host>();
+    for (int idof=0; idof<dyn_grid->get_num_local_dofs(); ++idof) {
+      const int ie = h_d_lid2idx(idof,0);
+      const int ip = h_d_lid2idx(idof,1);
+      const int jp = h_d_lid2idx(idof,2);
+      const Real gid = h_d_dofs(idof);
+      for (int il=0; il<NVL; ++il) {
+        h_v_prev(ie,0,ip,jp,il) = gid/2;
+        h_v_prev(ie,1,ip,jp,il) = gid;
+        h_w(ie,ip,jp,il) = 4;
+      }
+    }
+    for (auto& f : fields) {
+      f.sync_to_dev();
+    }
+  }
+
+  remapper->set_fwd_tendency_dt(dt);
+  remapper->remap(true);
+
+  s_dyn.sync_to_host();
+  v_dyn.sync_to_host();
+  auto h_s_dyn = s_dyn.get_view<const Real****,Host>();
+  auto h_v_dyn = v_dyn.get_view<const Real*****,Host>();
+  for (int idof=0; idof<dyn_grid->get_num_local_dofs(); ++idof) {
+    const int ie = h_d_lid2idx(idof,0);
+    const int ip = h_d_lid2idx(idof,1);
+    const int jp = h_d_lid2idx(idof,2);
+    const Real gid = h_d_dofs(idof);
+    for (int il=0; il<NVL; ++il) {
+      // s: (gid - gid/2)/dt
+      REQUIRE (h_s_dyn(ie,ip,jp,il)==gid/4);
+      // v: (phys - prev)/dt*w
+      REQUIRE (h_v_dyn(ie,0,ip,jp,il)==gid);
+      REQUIRE (h_v_dyn(ie,1,ip,jp,il)==2*gid);
+    }
+  }
+
+  // Delete remapper before finalizing the mpi context, since the remapper has some MPI stuff in it
+  remapper = nullptr;
+
+  // Finalize Homme::Context
+  Homme::Context::finalize_singleton();
+
+  // Cleanup f90 structures
+  cleanup_test_f90();
+}
+
 } // anonymous namespace
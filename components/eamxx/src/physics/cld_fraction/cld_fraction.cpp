@@ -1,5 +1,6 @@
 #include "physics/cld_fraction/cld_fraction_main_impl.hpp"
 #include "share/scream_types.hpp"
+#include "share/util/eamxx_precision_cast.hpp"
 
 namespace scream {
 namespace cld_fraction {
@@ -11,5 +12,10 @@ namespace cld_fraction {
 
 template struct CldFractionFunctions<Real,DefaultDevice>;
 
+#ifdef SCREAM_DOUBLE_PRECISION
+// Used if the process runs with compute_precision=single
+template struct CldFractionFunctions<SingleReal,DefaultDevice>;
+#endif
+
 } // namespace cld_fraction
 } // namespace scream
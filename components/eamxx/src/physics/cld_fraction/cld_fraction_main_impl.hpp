@@ -62,10 +62,10 @@ void CldFractionFunctions<S,D>
   const Int nk_pack = ekat::npack<Spack>(nk);
   Kokkos::parallel_for(
     Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
-      const Real ice_frac_threshold = threshold;
+      const Scalar ice_frac_threshold = threshold;
       auto icecld = qi(k) > ice_frac_threshold;
-      ice_cld_frac(k) = 0.0;
-      ice_cld_frac(k).set(icecld, 1.0);
+      ice_cld_frac(k) = Scalar(0);
+      ice_cld_frac(k).set(icecld, Scalar(1));
   }); // Kokkos_parallel_for nk_pack
   team.team_barrier();
 } // calc_icefrac
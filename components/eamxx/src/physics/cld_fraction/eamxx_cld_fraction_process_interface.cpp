@@ -62,6 +62,39 @@ void CldFraction::set_grids(const std::shared_ptr<const GridsManager> grids_mana
   m_icecloud_for_analysis_threshold = m_params.get<double>("ice_cloud_for_analysis_threshold",1e-5); // Default = 1e-5
 }
 
+// =========================================================================================
+size_t CldFraction::requested_buffer_size_in_bytes() const
+{
+  if (not use_single_precision()) {
+    return 0;
+  }
+  const int nlev_packs = ekat::npack<SpackSP>(m_num_levs);
+  return Buffer::num_2d_mid*m_num_cols*nlev_packs*sizeof(SpackSP);
+}
+
+// =========================================================================================
+void CldFraction::init_buffers(const ATMBufferManager &buffer_manager)
+{
+  EKAT_REQUIRE_MSG(buffer_manager.allocated_bytes() >= requested_buffer_size_in_bytes(), "Error! Buffers size not sufficient.\n");
+  if (not use_single_precision()) {
+    return;
+  }
+
+  SpackSP* mem = reinterpret_cast<SpackSP*>(buffer_manager.get_memory());
+
+  const int nlev_packs = ekat::npack<SpackSP>(m_num_levs);
+  uview_2d<SpackSP>* _2d_mid_view_ptrs[Buffer::num_2d_mid] =
+    {&m_buffer.qi, &m_buffer.liq_cld_frac, &m_buffer.ice_cld_frac,
+     &m_buffer.tot_cld_frac, &m_buffer.ice_cld_frac_4out, &m_buffer.tot_cld_frac_4out};
+  for (int i = 0; i < Buffer::num_2d_mid; ++i) {
+    *_2d_mid_view_ptrs[i] = uview_2d<SpackSP>(mem, m_num_cols, nlev_packs);
+    mem += _2d_mid_view_ptrs[i]->size();
+  }
+
+  size_t used_mem = (reinterpret_cast<Real*>(mem) - buffer_manager.get_memory())*sizeof(Real);
+  EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for CldFraction.");
+}
+
 // =========================================================================================
 void CldFraction::initialize_impl (const RunType /* run_type */)
 {
@@ -74,21 +107,73 @@ void CldFraction::initialize_impl (const RunType /* run_type */)
 }
 
 // =========================================================================================
-void CldFraction::run_impl (const double /* dt */)
+void CldFraction::run_impl (const double dt)
+{
+  run_columns_impl(dt,0,m_num_cols);
+}
+
+// =========================================================================================
+void CldFraction::run_columns_impl (const double /* dt */, const int icol_beg, const int icol_end)
 {
   // Calculate ice cloud fraction and total cloud fraction given the liquid cloud fraction
   // and the ice mass mixing ratio.
-  auto qi   = get_field_in("qi").get_view<const Pack**>();
-  auto liq_cld_frac = get_field_in("cldfrac_liq").get_view<const Pack**>();
-  auto ice_cld_frac = get_field_out("cldfrac_ice").get_view<Pack**>();
-  auto tot_cld_frac = get_field_out("cldfrac_tot").get_view<Pack**>();
-  auto ice_cld_frac_4out = get_field_out("cldfrac_ice_for_analysis").get_view<Pack**>();
-  auto tot_cld_frac_4out = get_field_out("cldfrac_tot_for_analysis").get_view<Pack**>();
-
-  CldFractionFunc::main(m_num_cols,m_num_levs,m_icecloud_threshold,m_icecloud_for_analysis_threshold,
+  // Note: the subviews of a LayoutRight view over a range of columns are still LayoutRight
+  const auto cols = std::make_pair(icol_beg,icol_end);
+  const auto all  = Kokkos::ALL;
+  if (use_single_precision()) {
+    run_columns_single_precision(cols);
+    return;
+  }
+  auto qi   = Kokkos::subview(get_field_in("qi").get_view<const Pack**>(),cols,all);
+  auto liq_cld_frac = Kokkos::subview(get_field_in("cldfrac_liq").get_view<const Pack**>(),cols,all);
+  auto ice_cld_frac = Kokkos::subview(get_field_out("cldfrac_ice").get_view<Pack**>(),cols,all);
+  auto tot_cld_frac = Kokkos::subview(get_field_out("cldfrac_tot").get_view<Pack**>(),cols,all);
+  auto ice_cld_frac_4out = Kokkos::subview(get_field_out("cldfrac_ice_for_analysis").get_view<Pack**>(),cols,all);
+  auto tot_cld_frac_4out = Kokkos::subview(get_field_out("cldfrac_tot_for_analysis").get_view<Pack**>(),cols,all);
+
+  CldFractionFunc::main(icol_end-icol_beg,m_num_levs,m_icecloud_threshold,m_icecloud_for_analysis_threshold,
     qi,liq_cld_frac,ice_cld_frac,tot_cld_frac,ice_cld_frac_4out,tot_cld_frac_4out);
 }
 
+// =========================================================================================
+void CldFraction::run_columns_single_precision (const std::pair<int,int>& cols)
+{
+  const auto all = Kokkos::ALL;
+  using src_view_t = uview_2d<const Real>;
+  using sp_view_t  = uview_2d<SingleReal>;
+  const int ncols = cols.second-cols.first;
+
+  auto qi   = Kokkos::subview(m_buffer.qi,cols,all);
+  auto liq_cld_frac = Kokkos::subview(m_buffer.liq_cld_frac,cols,all);
+  auto ice_cld_frac = Kokkos::subview(m_buffer.ice_cld_frac,cols,all);
+  auto tot_cld_frac = Kokkos::subview(m_buffer.tot_cld_frac,cols,all);
+  auto ice_cld_frac_4out = Kokkos::subview(m_buffer.ice_cld_frac_4out,cols,all);
+  auto tot_cld_frac_4out = Kokkos::subview(m_buffer.tot_cld_frac_4out,cols,all);
+
+  // Cast inputs to single precision
+  fused_cast<2>("CldFraction::cast_inputs",
+    Kokkos::Array<src_view_t,2>{
+      Kokkos::subview(get_field_in("qi").get_view<const Real**>(),cols,all),
+      Kokkos::subview(get_field_in("cldfrac_liq").get_view<const Real**>(),cols,all)},
+    Kokkos::Array<sp_view_t,2>{ekat::scalarize(qi),ekat::scalarize(liq_cld_frac)},
+    ncols,m_num_levs);
+
+  CldFractionFuncSP::main(ncols,m_num_levs,m_icecloud_threshold,m_icecloud_for_analysis_threshold,
+    qi,liq_cld_frac,ice_cld_frac,tot_cld_frac,ice_cld_frac_4out,tot_cld_frac_4out);
+
+  // Cast outputs back to Real
+  using sp_cview_t = uview_2d<const SingleReal>;
+  fused_cast<4>("CldFraction::cast_outputs",
+    Kokkos::Array<sp_cview_t,4>{ekat::scalarize(ice_cld_frac),ekat::scalarize(tot_cld_frac),
+                                ekat::scalarize(ice_cld_frac_4out),ekat::scalarize(tot_cld_frac_4out)},
+    Kokkos::Array<uview_2d<Real>,4>{
+      Kokkos::subview(get_field_out("cldfrac_ice").get_view<Real**>(),cols,all),
+      Kokkos::subview(get_field_out("cldfrac_tot").get_view<Real**>(),cols,all),
+      Kokkos::subview(get_field_out("cldfrac_ice_for_analysis").get_view<Real**>(),cols,all),
+      Kokkos::subview(get_field_out("cldfrac_tot_for_analysis").get_view<Real**>(),cols,all)},
+    ncols,m_num_levs);
+}
+
 // =========================================================================================
 void CldFraction::finalize_impl()
 {
@@ -3,6 +3,7 @@
 
 #include "physics/cld_fraction/cld_fraction_functions.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/util/eamxx_precision_cast.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 
 #include <string>
@@ -25,6 +26,13 @@ public:
   using Smask           = CldFractionFunc::Smask;
   using Pack            = ekat::Pack<Real,Spack::n>;
 
+  // Used if compute_precision=single
+  using CldFractionFuncSP = cld_fraction::CldFractionFunctions<SingleReal, DefaultDevice>;
+  using SpackSP           = CldFractionFuncSP::Spack;
+
+  template<typename ScalarT>
+  using uview_2d = Unmanaged<typename KokkosTypes<DefaultDevice>::template view_2d<ScalarT>>;
+
   // Constructors
   CldFraction (const ekat::Comm& comm, const ekat::ParameterList& params);
 
@@ -44,6 +52,29 @@ protected:
   void run_impl        (const double dt);
   void finalize_impl   ();
 
+  // Cloud fraction is purely column-local, so it can run on blocks of columns
+  bool supports_column_blocking () const { return true; }
+  void run_columns_impl (const double dt, const int icol_beg, const int icol_end);
+
+  // Cloud fraction is a simple threshold on qi, so it is insensitive to precision
+  bool supports_single_precision () const { return true; }
+  void run_columns_single_precision (const std::pair<int,int>& cols);
+
+  // Single precision copies of inputs/outputs are only needed if compute_precision=single
+  size_t requested_buffer_size_in_bytes () const;
+  void init_buffers (const ATMBufferManager& buffer_manager);
+
+  struct Buffer {
+    static constexpr int num_2d_mid = 6;
+
+    uview_2d<SpackSP> qi;
+    uview_2d<SpackSP> liq_cld_frac;
+    uview_2d<SpackSP> ice_cld_frac;
+    uview_2d<SpackSP> tot_cld_frac;
+    uview_2d<SpackSP> ice_cld_frac_4out;
+    uview_2d<SpackSP> tot_cld_frac_4out;
+  };
+
   // Keep track of field dimensions and the iteration count
   Int m_num_cols; 
   Int m_num_levs;
@@ -53,6 +84,8 @@ protected:
   Real m_icecloud_for_analysis_threshold;
 
   std::shared_ptr<const AbstractGrid> m_grid;
+
+  Buffer m_buffer;
 }; // class CldFraction
 
 } // namespace scream
@@ -13,15 +13,65 @@ extern "C" void cosp_c2f_run(const int ncol, const int nsubcol, const int nlay,
 namespace scream {
 
     namespace CospFunc {
-        using lview_host_1d = typename ekat::KokkosTypes<HostDevice>::template lview<Real*  >;
-        using lview_host_2d = typename ekat::KokkosTypes<HostDevice>::template lview<Real** >;
-        using lview_host_3d = typename ekat::KokkosTypes<HostDevice>::template lview<Real***>;
         template <typename S>
-        using view_1d = typename ekat::KokkosTypes<HostDevice>::template view_1d<S>;
+        using view_1d = typename ekat::KokkosTypes<DefaultDevice>::template view_1d<S>;
         template <typename S>
-        using view_2d = typename ekat::KokkosTypes<HostDevice>::template view_2d<S>;
+        using view_2d = typename ekat::KokkosTypes<DefaultDevice>::template view_2d<S>;
         template <typename S>
-        using view_3d = typename ekat::KokkosTypes<HostDevice>::template view_3d<S>;
+        using view_3d = typename ekat::KokkosTypes<DefaultDevice>::template view_3d<S>;
+
+        // Views of a batch of ncol columns, in the (LayoutLeft) ordering expected by cosp_c2f_run.
+        // The views do not own their memory: they are carved out of a flat buffer, which is
+        // laid out so that all inputs come first, followed by all outputs. This way, each batch
+        // only requires one device->host copy for the inputs, and one host->device copy for the
+        // outputs. Since the leading dimension is ncol, a smaller (e.g., last) batch must carve
+        // its own views out of the same buffer.
+        template <typename DeviceT>
+        struct BatchViews {
+            template <typename DT>
+            using uview = Unmanaged<typename ekat::KokkosTypes<DeviceT>::template lview<DT>>;
+
+            // Number of Real's needed for the inputs and outputs of a batch of ncol columns
+            static int input_size (const int ncol, const int nlay) {
+              return ncol*(2 + 11*nlay + (nlay+1));
+            }
+            static int output_size (const int ncol, const int ntau, const int nctp, const int ncth) {
+              return ncol*(1 + ntau*(2*nctp + ncth));
+            }
+
+            BatchViews () = default;
+            BatchViews (Real* data, const int ncol, const int nlay,
+                        const int ntau, const int nctp, const int ncth)
+            {
+              auto carve = [&](const int n) { auto ptr = data; data += n; return ptr; };
+              sunlit       = uview<Real*>  (carve(ncol),ncol);
+              skt          = uview<Real*>  (carve(ncol),ncol);
+              T_mid        = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              p_mid        = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              z_mid        = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              qv           = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              qc           = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              qi           = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              cldfrac      = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              reff_qc      = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              reff_qi      = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              dtau067      = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              dtau105      = uview<Real**> (carve(ncol*nlay),ncol,nlay);
+              p_int        = uview<Real**> (carve(ncol*(nlay+1)),ncol,nlay+1);
+              isccp_cldtot = uview<Real*>  (carve(ncol),ncol);
+              isccp_ctptau = uview<Real***>(carve(ncol*ntau*nctp),ncol,ntau,nctp);
+              modis_ctptau = uview<Real***>(carve(ncol*ntau*nctp),ncol,ntau,nctp);
+              misr_cthtau  = uview<Real***>(carve(ncol*ntau*ncth),ncol,ntau,ncth);
+            }
+
+            // Inputs
+            uview<Real*>   sunlit, skt;
+            uview<Real**>  T_mid, p_mid, z_mid, qv, qc, qi, cldfrac,
+                           reff_qc, reff_qi, dtau067, dtau105, p_int;
+            // Outputs
+            uview<Real*>   isccp_cldtot;
+            uview<Real***> isccp_ctptau, modis_ctptau, misr_cthtau;
+        };
 
         inline void initialize(int ncol, int nsubcol, int nlay) {
             cosp_c2f_init(ncol, nsubcol, nlay);
@@ -29,70 +79,15 @@ namespace scream {
         inline void finalize() {
             cosp_c2f_final();
         };
+        // Run COSP on a batch of ncol columns, whose inputs have already been copied to host
         inline void main(
                 const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
-                view_1d<const Real>& sunlit , view_1d<const Real>& skt,
-                view_2d<const Real>& T_mid  , view_2d<const Real>& p_mid  , view_2d<const Real>& p_int,
-                view_2d<const Real>& z_mid  , view_2d<const Real>& qv     , view_2d<const Real>& qc     , view_2d<const Real>& qi,
-                view_2d<const Real>& cldfrac,
-                view_2d<const Real>& reff_qc, view_2d<const Real>& reff_qi,
-                view_2d<const Real>& dtau067, view_2d<const Real>& dtau105,
-                view_1d<Real>& isccp_cldtot , view_3d<Real>& isccp_ctptau, view_3d<Real>& modis_ctptau, view_3d<Real>& misr_cthtau) {
-
-            // Make host copies and permute data as needed
-            lview_host_2d
-                  T_mid_h("T_mid_h", ncol, nlay), p_mid_h("p_mid_h", ncol, nlay), p_int_h("p_int_h", ncol, nlay+1),
-                  z_mid_h("z_mid_h", ncol, nlay), qv_h("qv_h", ncol, nlay), qc_h("qc_h", ncol, nlay), qi_h("qi_h", ncol, nlay),
-                  cldfrac_h("cldfrac_h", ncol, nlay),
-                  reff_qc_h("reff_qc_h", ncol, nlay), reff_qi_h("reff_qi_h", ncol, nlay),
-                  dtau067_h("dtau_067_h", ncol, nlay), dtau105_h("dtau105_h", ncol, nlay);
-            lview_host_3d isccp_ctptau_h("isccp_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d modis_ctptau_h("modis_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d misr_cthtau_h("misr_cthtau_h", ncol, ntau, ncth);
-
-            // Copy to layoutLeft host views
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < nlay; j++) {
-                    T_mid_h(i,j) = T_mid(i,j);
-                    p_mid_h(i,j) = p_mid(i,j);
-                    z_mid_h(i,j) = z_mid(i,j);
-                    qv_h(i,j) = qv(i,j);
-                    qc_h(i,j) = qc(i,j);
-                    qi_h(i,j) = qi(i,j);
-                    cldfrac_h(i,j) = cldfrac(i,j);
-                    reff_qc_h(i,j) = reff_qc(i,j);
-                    reff_qi_h(i,j) = reff_qi(i,j);
-                    dtau067_h(i,j) = dtau067(i,j);
-                    dtau105_h(i,j) = dtau105(i,j);
-                }
-            }
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < nlay+1; j++) {
-                    p_int_h(i,j) = p_int(i,j);
-                }
-            }
-
-            // Subsample here?
-
-            // Call COSP wrapper
+                const BatchViews<HostDevice>& batch) {
             cosp_c2f_run(ncol, nsubcol, nlay, ntau, nctp, ncth,
-                    emsfc_lw, sunlit.data(), skt.data(), T_mid_h.data(), p_mid_h.data(), p_int_h.data(),
-                    z_mid_h.data(), qv_h.data(), qc_h.data(), qi_h.data(),
-                    cldfrac_h.data(), reff_qc_h.data(), reff_qi_h.data(), dtau067_h.data(), dtau105_h.data(),
-                    isccp_cldtot.data(), isccp_ctptau_h.data(), modis_ctptau_h.data(), misr_cthtau_h.data());
-
-            // Copy outputs back to layoutRight views
-            for (int i = 0; i < ncol; i++) {
-                for (int j = 0; j < ntau; j++) {
-                    for (int k = 0; k < nctp; k++) {
-                        isccp_ctptau(i,j,k) = isccp_ctptau_h(i,j,k);
-                        modis_ctptau(i,j,k) = modis_ctptau_h(i,j,k);
-                    }
-                    for (int k = 0; k < ncth; k++) {
-                        misr_cthtau(i,j,k) = misr_cthtau_h(i,j,k);
-                    }
-                }
-            }
+                    emsfc_lw, batch.sunlit.data(), batch.skt.data(), batch.T_mid.data(), batch.p_mid.data(), batch.p_int.data(),
+                    batch.z_mid.data(), batch.qv.data(), batch.qc.data(), batch.qi.data(),
+                    batch.cldfrac.data(), batch.reff_qc.data(), batch.reff_qi.data(), batch.dtau067.data(), batch.dtau105.data(),
+                    batch.isccp_cldtot.data(), batch.isccp_ctptau.data(), batch.modis_ctptau.data(), batch.misr_cthtau.data());
         }
     }
 }
@@ -98,8 +98,31 @@ void Cosp::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
 // =========================================================================================
 void Cosp::initialize_impl (const RunType /* run_type */)
 {
-  // Set property checks for fields in this process
-  CospFunc::initialize(m_num_cols, m_num_subcols, m_num_levs);
+  // COSP is called on batches of (sunlit) columns, so that the memory used by the simulators
+  // fits in the given budget (in MB); a non-positive budget means all columns in one batch.
+  // The per-column estimate accounts for the subcolumn arrays (subcolumn cloud fraction,
+  // optical depth, emissivity, liquid fraction, plus simulator temporaries) and the
+  // per-level inputs/work arrays of cosp_c2f_run.
+  const auto budget_mb = m_params.get<double>("cosp_batch_memory_mb", 0);
+  const long long bytes_per_col = sizeof(Real)*(8ll*m_num_subcols*m_num_levs + 48ll*m_num_levs);
+  m_max_batch_cols = m_num_cols;
+  if (budget_mb>0) {
+    const long long budget_cols = budget_mb*1024*1024 / bytes_per_col;
+    m_max_batch_cols = std::min<long long>(m_num_cols,budget_cols);
+  }
+  m_max_batch_cols = std::max(m_max_batch_cols,1);
+
+  CospFunc::initialize(m_max_batch_cols, m_num_subcols, m_num_levs);
+
+  m_z_mid = KT::view_2d<Real>("z_mid", m_num_cols, m_num_levs);
+  m_z_int = KT::view_2d<Real>("z_int", m_num_cols, m_num_levs+1);
+  m_sunlit_cols = KT::view_1d<int>("sunlit_cols", m_num_cols);
+
+  using BV = CospFunc::BatchViews<DefaultDevice>;
+  const int batch_size = BV::input_size(m_max_batch_cols,m_num_levs)
+                       + BV::output_size(m_max_batch_cols,m_num_tau,m_num_ctp,m_num_cth);
+  m_batch_data   = KT::view_1d<Real>("cosp_batch_data",batch_size);
+  m_batch_data_h = Kokkos::create_mirror_view(m_batch_data);
 
 
   // Add note to output files about processing ISCCP fields that are only valid during
@@ -134,59 +157,60 @@ void Cosp::run_impl (const double dt)
   auto ts = timestamp();
   auto update_cosp = cosp_do(cosp_freq_in_steps, ts.get_num_steps());
 
-  // Get fields from field manager; note that we get host views because this
-  // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
-  // all then need to be copied to layoutLeft views to permute the indices for
-  // F90.
+  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*>();
+  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***>();
+  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***>();
+  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***>();
+  auto cosp_sunlit  = get_field_out("cosp_sunlit").get_view<Real*>();  // Copy of sunlit flag with COSP frequency for proper averaging
+
+  // Zero out all outputs. If COSP is not updated this step, this essentially weights
+  // the ISCCP cloud properties by the sunlit mask. What will be output for time-averages
+  // then is the time-average mask-weighted statistics; to get true averages, we need to
+  // divide by the time-average of the mask. I.e., if M is the sunlit mask, and X is the ISCCP
+  // statistic, then
+  //
+  //     avg(X) = sum(M * X) / sum(M) = (sum(M * X)/N) / (sum(M)/N) = avg(M * X) / avg(M)
   //
-  // Need to make sure device data is synced to host?
-  get_field_in("qv").sync_to_host();
-  get_field_in("qc").sync_to_host();
-  get_field_in("qi").sync_to_host();
-  get_field_in("sunlit").sync_to_host();
-  get_field_in("surf_radiative_T").sync_to_host();
-  get_field_in("T_mid").sync_to_host();
-  get_field_in("p_mid").sync_to_host();
-  get_field_in("p_int").sync_to_host();
-  get_field_in("cldfrac_rad").sync_to_host();
-  get_field_in("eff_radius_qc").sync_to_host();
-  get_field_in("eff_radius_qi").sync_to_host();
-  get_field_in("dtau067").sync_to_host();
-  get_field_in("dtau105").sync_to_host();
-  get_field_in("phis").sync_to_host();
-  get_field_in("pseudo_density").sync_to_host();
+  // If COSP is updated, only sunlit columns are overwritten below, so that night values
+  // stay ZERO, since our I/O does not know how to handle masked/missing values in temporal averages.
+  // TODO: mask this when/if the AD ever supports masked averages
+  Kokkos::deep_copy(isccp_cldtot, 0.0);
+  Kokkos::deep_copy(isccp_ctptau, 0.0);
+  Kokkos::deep_copy(modis_ctptau, 0.0);
+  Kokkos::deep_copy(misr_cthtau, 0.0);
+  Kokkos::deep_copy(cosp_sunlit, 0.0);
+  if (not update_cosp) {
+    return;
+  }
 
-  auto qv      = get_field_in("qv").get_view<const Real**, Host>();
-  auto qc      = get_field_in("qc").get_view<const Real**, Host>();
-  auto qi      = get_field_in("qi").get_view<const Real**, Host>();
-  auto sunlit  = get_field_in("sunlit").get_view<const Real*, Host>();
-  auto skt     = get_field_in("surf_radiative_T").get_view<const Real*, Host>();
-  auto T_mid   = get_field_in("T_mid").get_view<const Real**, Host>();
-  auto p_mid   = get_field_in("p_mid").get_view<const Real**, Host>();
-  auto p_int   = get_field_in("p_int").get_view<const Real**, Host>();
-  auto phis    = get_field_in("phis").get_view<const Real*, Host>();
-  auto pseudo_density = get_field_in("pseudo_density").get_view<const Real**, Host>();
-  auto cldfrac = get_field_in("cldfrac_rad").get_view<const Real**, Host>();
-  auto reff_qc = get_field_in("eff_radius_qc").get_view<const Real**, Host>();
-  auto reff_qi = get_field_in("eff_radius_qi").get_view<const Real**, Host>();
-  auto dtau067 = get_field_in("dtau067").get_view<const Real**, Host>();
-  auto dtau105 = get_field_in("dtau105").get_view<const Real**, Host>();
-  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*, Host>();
-  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***, Host>();
-  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***, Host>();
-  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***, Host>();
-  auto cosp_sunlit  = get_field_out("cosp_sunlit").get_view<Real*, Host>();  // Copy of sunlit flag with COSP frequency for proper averaging
+  // All the preprocessing is done on device. Only the COSP simulators themselves run on host,
+  // through the c++ to f90 bridge, on batches of sunlit columns, which are copied to/from
+  // host in the layoutLeft ordering expected by F90.
+  auto qv      = get_field_in("qv").get_view<const Real**>();
+  auto qc      = get_field_in("qc").get_view<const Real**>();
+  auto qi      = get_field_in("qi").get_view<const Real**>();
+  auto sunlit  = get_field_in("sunlit").get_view<const Real*>();
+  auto skt     = get_field_in("surf_radiative_T").get_view<const Real*>();
+  auto T_mid   = get_field_in("T_mid").get_view<const Real**>();
+  auto p_mid   = get_field_in("p_mid").get_view<const Real**>();
+  auto p_int   = get_field_in("p_int").get_view<const Real**>();
+  auto phis    = get_field_in("phis").get_view<const Real*>();
+  auto pseudo_density = get_field_in("pseudo_density").get_view<const Real**>();
+  auto cldfrac = get_field_in("cldfrac_rad").get_view<const Real**>();
+  auto reff_qc = get_field_in("eff_radius_qc").get_view<const Real**>();
+  auto reff_qi = get_field_in("eff_radius_qi").get_view<const Real**>();
+  auto dtau067 = get_field_in("dtau067").get_view<const Real**>();
+  auto dtau105 = get_field_in("dtau105").get_view<const Real**>();
 
   // Compute heights
-  const auto z_mid = CospFunc::view_2d<Real>("z_mid", m_num_cols, m_num_levs);
-  const auto z_int = CospFunc::view_2d<Real>("z_int", m_num_cols, m_num_levs+1);
+  const auto z_mid = m_z_mid;
+  const auto z_int = m_z_int;
   const auto dz = z_mid;  // reuse tmp memory for dz
   const auto ncol = m_num_cols;
   const auto nlev = m_num_levs;
   // calculate_z_int contains a team-level parallel_scan, which requires a special policy
-  // TODO: do this on device?
-  const auto scan_policy = ekat::ExeSpaceUtils<KTH::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol, nlev);
-  Kokkos::parallel_for(scan_policy, KOKKOS_LAMBDA (const KTH::MemberType& team) {
+  const auto scan_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol, nlev);
+  Kokkos::parallel_for("Cosp::run_impl", scan_policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
       const int i = team.league_rank();
       const auto dz_s    = ekat::subview(dz,    i);
       const auto p_mid_s = ekat::subview(p_mid, i);
@@ -204,54 +228,93 @@ void Cosp::run_impl (const double dt)
       team.team_barrier();
   });
 
-  // Call COSP wrapper routines
-  if (update_cosp) {
-    Real emsfc_lw = 0.99;
-    Kokkos::deep_copy(cosp_sunlit, sunlit);
-    CospFunc::view_2d<const Real> z_mid_c = z_mid;  // Need a const version of z_mid for call to CospFunc::main
-    CospFunc::main(
-            m_num_cols, m_num_subcols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth,
-            emsfc_lw, sunlit, skt, T_mid, p_mid, p_int, z_mid_c, qv, qc, qi,
-            cldfrac, reff_qc, reff_qi, dtau067, dtau105,
-            isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau
-    );
-    // Remask night values to ZERO since our I/O does not know how to handle masked/missing values
-    // in temporal averages; this is all host data, so we can just use host loops like its the 1980s
-    for (int i = 0; i < m_num_cols; i++) {
-        if (sunlit(i) == 0) {
-            isccp_cldtot(i) = 0;
-            for (int j = 0; j < m_num_tau; j++) {
-                for (int k = 0; k < m_num_ctp; k++) {
-                    isccp_ctptau(i,j,k) = 0;
-                    modis_ctptau(i,j,k) = 0;
-                }
-                for (int k = 0; k < m_num_cth; k++) {
-                    misr_cthtau (i,j,k) = 0;
-                }
-            }
-        }
+  // ISCCP, MODIS, and MISR outputs are only valid for sunlit columns, and are zeroed out at
+  // night anyways, so there is no point in running the simulators on night columns.
+  Kokkos::deep_copy(cosp_sunlit, sunlit);
+  const auto sunlit_cols = m_sunlit_cols;
+  int num_sunlit = 0;
+  Kokkos::parallel_scan("cosp_sunlit_cols", KT::RangePolicy(0,ncol),
+                        KOKKOS_LAMBDA (const int i, int& offset, const bool final) {
+    if (sunlit(i)!=0) {
+      if (final) {
+        sunlit_cols(offset) = i;
+      }
+      ++offset;
     }
-  } else {
-    // If not updating COSP statistics, set these to ZERO; this essentially weights
-    // the ISCCP cloud properties by the sunlit mask. What will be output for time-averages
-    // then is the time-average mask-weighted statistics; to get true averages, we need to
-    // divide by the time-average of the mask. I.e., if M is the sunlit mask, and X is the ISCCP
-    // statistic, then
-    //
-    //     avg(X) = sum(M * X) / sum(M) = (sum(M * X)/N) / (sum(M)/N) = avg(M * X) / avg(M)
-    //
-    // TODO: mask this when/if the AD ever supports masked averages
-    Kokkos::deep_copy(isccp_cldtot, 0.0);
-    Kokkos::deep_copy(isccp_ctptau, 0.0);
-    Kokkos::deep_copy(modis_ctptau, 0.0);
-    Kokkos::deep_copy(misr_cthtau, 0.0);
-    Kokkos::deep_copy(cosp_sunlit, 0.0);
+  },num_sunlit);
+
+  // Call COSP wrapper routines, one batch of sunlit columns at a time
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using BV  = CospFunc::BatchViews<DefaultDevice>;
+  using BVH = CospFunc::BatchViews<HostDevice>;
+  const Real emsfc_lw = 0.99;
+  const int ntau = m_num_tau;
+  const int nctp = m_num_ctp;
+  const int ncth = m_num_cth;
+  for (int first=0; first<num_sunlit; first+=m_max_batch_cols) {
+    const int nbatch = std::min(m_max_batch_cols,num_sunlit-first);
+    const BV  batch  (m_batch_data.data(),  nbatch,nlev,ntau,nctp,ncth);
+    const BVH batch_h(m_batch_data_h.data(),nbatch,nlev,ntau,nctp,ncth);
+
+    // Gather the inputs of this batch
+    const auto gather_policy = ESU::get_default_team_policy(nbatch,nlev+1);
+    Kokkos::parallel_for("cosp_gather_batch", gather_policy,
+                         KOKKOS_LAMBDA (const KT::MemberType& team) {
+      const int ib = team.league_rank();
+      const int i  = sunlit_cols(first+ib);
+      Kokkos::single(Kokkos::PerTeam(team),[&] {
+        batch.sunlit(ib) = sunlit(i);
+        batch.skt(ib)    = skt(i);
+      });
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlev+1),[&](const int k) {
+        batch.p_int(ib,k) = p_int(i,k);
+        if (k<nlev) {
+          batch.T_mid(ib,k)   = T_mid(i,k);
+          batch.p_mid(ib,k)   = p_mid(i,k);
+          batch.z_mid(ib,k)   = z_mid(i,k);
+          batch.qv(ib,k)      = qv(i,k);
+          batch.qc(ib,k)      = qc(i,k);
+          batch.qi(ib,k)      = qi(i,k);
+          batch.cldfrac(ib,k) = cldfrac(i,k);
+          batch.reff_qc(ib,k) = reff_qc(i,k);
+          batch.reff_qi(ib,k) = reff_qi(i,k);
+          batch.dtau067(ib,k) = dtau067(i,k);
+          batch.dtau105(ib,k) = dtau105(i,k);
+        }
+      });
+    });
+
+    const auto in_range  = Kokkos::make_pair(0,BV::input_size(nbatch,nlev));
+    const auto out_range = Kokkos::make_pair(in_range.second,
+                                             in_range.second+BV::output_size(nbatch,ntau,nctp,ncth));
+    Kokkos::deep_copy(Kokkos::subview(m_batch_data_h,in_range),Kokkos::subview(m_batch_data,in_range));
+    CospFunc::main(nbatch, m_num_subcols, nlev, ntau, nctp, ncth, emsfc_lw, batch_h);
+    Kokkos::deep_copy(Kokkos::subview(m_batch_data,out_range),Kokkos::subview(m_batch_data_h,out_range));
+
+    // Scatter the outputs of this batch back to the sunlit columns
+    const int nbins = ntau*(nctp+ncth);
+    const auto scatter_policy = ESU::get_default_team_policy(nbatch,nbins);
+    Kokkos::parallel_for("cosp_scatter_batch", scatter_policy,
+                         KOKKOS_LAMBDA (const KT::MemberType& team) {
+      const int ib = team.league_rank();
+      const int i  = sunlit_cols(first+ib);
+      Kokkos::single(Kokkos::PerTeam(team),[&] {
+        isccp_cldtot(i) = batch.isccp_cldtot(ib);
+      });
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nbins),[&](const int n) {
+        if (n<ntau*nctp) {
+          const int j = n / nctp;
+          const int k = n % nctp;
+          isccp_ctptau(i,j,k) = batch.isccp_ctptau(ib,j,k);
+          modis_ctptau(i,j,k) = batch.modis_ctptau(ib,j,k);
+        } else {
+          const int j = (n-ntau*nctp) / ncth;
+          const int k = (n-ntau*nctp) % ncth;
+          misr_cthtau(i,j,k) = batch.misr_cthtau(ib,j,k);
+        }
+      });
+    });
   }
-  get_field_out("isccp_cldtot").sync_to_dev();
-  get_field_out("isccp_ctptau").sync_to_dev();
-  get_field_out("modis_ctptau").sync_to_dev();
-  get_field_out("misr_cthtau").sync_to_dev();
-  get_field_out("cosp_sunlit").sync_to_dev();
 }
 
 // =========================================================================================
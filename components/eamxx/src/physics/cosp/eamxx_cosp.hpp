@@ -3,6 +3,7 @@
 
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
+#include "cosp_functions.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 
 #include <string>
@@ -20,7 +21,7 @@ class Cosp : public AtmosphereProcess
 {
 
 public:
-  using PF  = scream::PhysicsFunctions<HostDevice>;
+  using PF  = scream::PhysicsFunctions<DefaultDevice>;
   using KT  = KokkosTypes<DefaultDevice>;
   using KTH = KokkosTypes<HostDevice>;
 
@@ -73,6 +74,21 @@ protected:
   Int m_num_ctp = 7;
   Int m_num_cth = 16;
 
+  // Max number of columns passed to the COSP simulators in a single call,
+  // deduced from the cosp_batch_memory_mb parameter
+  Int m_max_batch_cols;
+
+  // Heights, computed on device from the hydrostatic state
+  KT::view_2d<Real> m_z_mid;
+  KT::view_2d<Real> m_z_int;
+
+  // Indices of the sunlit columns, which are the only ones passed to COSP
+  KT::view_1d<int>  m_sunlit_cols;
+
+  // Flat storage for the inputs/outputs of a batch of columns (see CospFunc::BatchViews)
+  KT::view_1d<Real>              m_batch_data;
+  KT::view_1d<Real>::HostMirror  m_batch_data_h;
+
   std::shared_ptr<const AbstractGrid> m_grid;
 
 }; // class Cosp
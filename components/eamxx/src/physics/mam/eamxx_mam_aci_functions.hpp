@@ -17,7 +17,7 @@ void compute_w0_and_rho(haero::ThreadTeamPolicy team_policy,
   MAMAci::const_view_2d omega = dry_atmosphere.omega;
   MAMAci::const_view_2d T_mid = dry_atmosphere.T_mid;
   MAMAci::const_view_2d p_mid = dry_atmosphere.p_mid;
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("MAMAci::compute_w0_and_rho",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
         // Get physical constants
@@ -46,7 +46,7 @@ void compute_tke_at_interfaces(haero::ThreadTeamPolicy team_policy,
 				  MAMAci::view_2d tke) {
   using CO = scream::ColumnOps<DefaultDevice, Real>;
 
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("MAMAci::compute_tke_at_interfaces",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
 
@@ -73,7 +73,7 @@ void compute_subgrid_scale_velocities(
     const Real wsubmin, const int top_lev, const int nlev,
     // output
     MAMAci::view_2d wsub, MAMAci::view_2d wsubice, MAMAci::view_2d wsig) {
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("MAMAci::compute_subgrid_scale_velocities",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
         // More refined computation of sub-grid vertical velocity
@@ -113,7 +113,7 @@ void compute_nucleate_ice_tendencies(
   // from ice nucleation
   //-------------------------------------------------------------
 
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("MAMAci::compute_nucleate_ice_tendencies",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
         //---------------------------------------------------------------------
@@ -176,7 +176,7 @@ void store_liquid_cloud_fraction(
     MAMAci::view_2d cloud_frac, MAMAci::view_2d cloud_frac_prev) {
   MAMAci::const_view_2d qc = dry_atmosphere.qc;
   MAMAci::const_view_2d qi = dry_atmosphere.qi;
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("MAMAci::store_liquid_cloud_fraction",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
         //-------------------------------------------------------------
@@ -203,7 +203,7 @@ void compute_recipical_pseudo_density(haero::ThreadTeamPolicy team_policy,
                                       const int nlev,
                                       // output
                                       MAMAci::view_2d rpdel) {
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("MAMAci::compute_recipical_pseudo_density",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
         Kokkos::parallel_for(
@@ -336,7 +336,7 @@ void call_function_dropmixnuc(
   //---------------------------------------------------------------------------
   //---------------------------------------------------------------------------
 
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("MAMAci::call_function_dropmixnuc",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
         // for (int icol=0; icol<5; ++icol){
@@ -492,7 +492,7 @@ void update_interstitial_aerosols(
 
       if(aero_mmr.data()) {
         const auto ptend_view = ptend_q[s_idx];
-        Kokkos::parallel_for(
+        Kokkos::parallel_for("MAMAci::update_interstitial_aerosols::mass",
             team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
               const int icol = team.league_rank();
               // update values for all levs at this column
@@ -507,7 +507,7 @@ void update_interstitial_aerosols(
     auto aero_nmr =
         dry_aero.int_aero_nmr[m];  // number mixing ratio for mode "m"
     const auto ptend_view = ptend_q[s_idx];
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("MAMAci::update_interstitial_aerosols::number",
         team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
           const int icol = team.league_rank();
           // update values for all levs at this column
@@ -537,7 +537,7 @@ void call_hetfrz_compute_tendencies(
   for(int i = 0; i < MAMAci::hetro_scratch_; ++i)
     diagnostic_scratch[i] = diagnostic_scratch_[i];
 
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("MAMAci::call_hetfrz_compute_tendencies",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
         //   Set up an atmosphere, surface, diagnostics, pronostics and
@@ -251,6 +251,13 @@ void MAMMicrophysics::initialize_impl(const RunType run_type) {
                                         config_.photolysis.rsf_file,
                                         config_.photolysis.xs_long_file);
 
+  // allocate storage for batched gas phase chemistry
+  auto chem_data = impl::create_gas_phase_chemistry_data(ncol_, nlev_);
+  chem_photo_rates_ = chem_data.photo_rates;
+  chem_extfrc_      = chem_data.extfrc;
+  chem_vmr_         = chem_data.vmr;
+  chem_invariants_  = chem_data.invariants;
+
   // FIXME: read relevant land use data from drydep surface file
 
   // set up our preprocess/postprocess functors
@@ -288,9 +295,10 @@ void MAMMicrophysics::run_impl(const double dt) {
   // NOTE: nothing depends on simulation time (yet), so we can just use zero for now
   double t = 0.0;
 
-  // here's where we store per-column photolysis rates
-  using View2D = haero::DeviceType::view_2d<Real>;
-  View2D photo_rates("photo_rates", nlev_, mam4::mo_photo::phtcnt);
+  // per-cell storage for gas phase chemistry (photolysis rates, external
+  // forcings, VMRs, invariants)
+  const impl::GasPhaseChemistryData chem_data{chem_photo_rates_, chem_extfrc_,
+                                              chem_vmr_, chem_invariants_};
 
   // climatology data for linear stratospheric chemistry
   auto linoz_o3_clim      = buffer_.scratch[0]; // ozone (climatology) [vmr]
@@ -316,26 +324,20 @@ void MAMMicrophysics::run_impl(const double dt) {
 
   // FIXME: read relevant chlorine loading data from file based on time
 
-  // loop over atmosphere columns and compute aerosol microphyscs
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const ThreadTeam& team) {
+  // gas phase chemistry is done in three steps:
+  // 1. column-wise photolysis rates and external forcings, and transfer of
+  //    the prognostics into the (batched) VMR storage
+  // 2. gas phase chemistry on all (column,level) cells at once
+  // 3. column-wise aerosol microphysics (see below)
+  Kokkos::parallel_for("gas_phase_chemistry_setup", policy, KOKKOS_LAMBDA(const ThreadTeam& team) {
     const int icol = team.league_rank(); // column index
 
-    Real col_lat = col_latitudes(icol); // column latitude (degrees?)
-
     // fetch column-specific atmosphere state data
     auto atm = mam_coupling::atmosphere_for_column(dry_atm, icol);
-    auto z_iface = ekat::subview(dry_atm.z_iface, icol);
-    Real phis = dry_atm.phis(icol);
-
-    // set surface state data
-    haero::Surface sfc{};
 
     // fetch column-specific subviews into aerosol prognostics
     mam4::Prognostics progs = mam_coupling::interstitial_aerosols_for_column(dry_aero, icol);
 
-    // set up diagnostics
-    mam4::Diagnostics diags(nlev);
-
     // calculate o3 column densities (first component of col_dens in Fortran code)
     auto o3_col_dens_i = ekat::subview(o3_col_dens, icol);
     impl::compute_o3_column_density(team, atm, progs, o3_col_dens_i);
@@ -351,16 +353,51 @@ void MAMMicrophysics::run_impl(const double dt) {
     Real surf_albedo = 0.0; // FIXME: surface albedo
     Real esfact = 0.0; // FIXME: earth-sun distance factor
     mam4::ColumnView lwc; // FIXME: liquid water cloud content: where do we get this?
+    view_2d photo_rates = ekat::subview(chem_data.photo_rates, icol);
     mam4::mo_photo::table_photo(photo_rates, atm.pressure, atm.hydrostatic_dp,
       atm.temperature, o3_col_dens_i, zenith_angle, surf_albedo, lwc,
       atm.cloud_fraction, esfact, photo_table, photo_work_arrays);
 
     // compute external forcings at time t(n+1) [molecules/cm^3/s]
     constexpr int extcnt = mam4::gas_chemistry::extcnt;
-    view_2d extfrc; // FIXME: where to allocate? (nlev, extcnt)
+    view_2d extfrc = ekat::subview(chem_data.extfrc, icol);
     mam4::mo_setext::Forcing forcings[extcnt]; // FIXME: forcings seem to require file data
     mam4::mo_setext::extfrc_set(forcings, extfrc);
 
+    // transfer VMRs into the batched storage
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&](const int k) {
+      constexpr int gas_pcnst = mam_coupling::gas_pcnst();
+      Real q[gas_pcnst] = {};
+      Real qqcw[gas_pcnst] = {};
+      mam_coupling::transfer_prognostics_to_work_arrays(progs, k, q, qqcw);
+      Real vmr[gas_pcnst], vmrcw[gas_pcnst];
+      mam_coupling::convert_work_arrays_to_vmr(q, qqcw, vmr, vmrcw);
+      const int icell = icol*nlev + k;
+      for (int i = 0; i < gas_pcnst; ++i) {
+        chem_data.vmr(i, icell) = vmr[i];
+      }
+    });
+  });
+
+  impl::gas_phase_chemistry_batched(ncol_, nlev_, dt, dry_atm_, chem_data);
+
+  // loop over atmosphere columns and compute aerosol microphyscs
+  Kokkos::parallel_for("MAMMicrophysics::run_impl", policy, KOKKOS_LAMBDA(const ThreadTeam& team) {
+    const int icol = team.league_rank(); // column index
+
+    Real col_lat = col_latitudes(icol); // column latitude (degrees?)
+
+    // fetch column-specific atmosphere state data
+    auto atm = mam_coupling::atmosphere_for_column(dry_atm, icol);
+
+    // fetch column-specific subviews into aerosol prognostics
+    mam4::Prognostics progs = mam_coupling::interstitial_aerosols_for_column(dry_aero, icol);
+
+    auto o3_col_dens_i = ekat::subview(o3_col_dens, icol);
+
+    Real zenith_angle = 0.0; // FIXME: need to get this from EAMxx [radians]
+    mam4::ColumnView lwc; // FIXME: liquid water cloud content: where do we get this?
+
     // compute aerosol microphysics on each vertical level within this column
     Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&](const int k) {
 
@@ -373,7 +410,6 @@ void MAMMicrophysics::run_impl(const double dt) {
       Real pmid    = atm.pressure(k);
       Real pdel    = atm.hydrostatic_dp(k);
       Real zm      = atm.height(k);
-      Real zi      = z_iface(k);
       Real pblh    = atm.planetary_boundary_layer_height;
       Real qv      = atm.vapor_mixing_ratio(k);
       Real cldfrac = atm.cloud_fraction(k);
@@ -407,20 +443,17 @@ void MAMMicrophysics::run_impl(const double dt) {
       //---------------------
       // Gas Phase Chemistry
       //---------------------
-      Real photo_rates_k[mam4::mo_photo::phtcnt];
-      for (int i = 0; i < mam4::mo_photo::phtcnt; ++i) {
-        photo_rates_k[i] = photo_rates(k, i);
-      }
-      Real extfrc_k[extcnt];
-      for (int i = 0; i < extcnt; ++i) {
-        extfrc_k[i] = extfrc(k, i);
+      // NOTE: this was done in the batched kernel above, so we fetch the
+      // NOTE: updated VMRs, as well as the invariants to use later with setsox
+      const int icell = icol*nlev + k;
+      for (int i = 0; i < gas_pcnst; ++i) {
+        vmr[i] = chem_data.vmr(i, icell);
       }
       constexpr int nfs = mam4::gas_chemistry::nfs; // number of "fixed species"
-      // NOTE: we compute invariants here and pass them out to use later with
-      // NOTE: setsox
       Real invariants[nfs];
-      impl::gas_phase_chemistry(zm, zi, phis, temp, pmid, pdel, dt,
-                                photo_rates_k, extfrc_k, vmr, invariants);
+      for (int i = 0; i < nfs; ++i) {
+        invariants[i] = chem_data.invariants(i, icell);
+      }
 
       //----------------------
       // Aerosol microphysics
@@ -36,6 +36,7 @@ class MAMMicrophysics final : public scream::AtmosphereProcess {
   using view_2d       = typename KT::template view_2d<Real>;
   using const_view_1d = typename KT::template view_1d<const Real>;
   using const_view_2d = typename KT::template view_2d<const Real>;
+  using view_3d       = typename KT::template view_3d<Real>;
 
   // unmanaged views (for buffer and workspace manager)
   using uview_1d = Unmanaged<typename KT::template view_1d<Real>>;
@@ -207,6 +208,10 @@ private_except_cuda:
   // photolysis rate table (column-independent)
   mam4::mo_photo::PhotoTableData photo_table_;
 
+  // storage for batched gas phase chemistry (see impl/gas_phase_chemistry.hpp)
+  view_3d chem_photo_rates_, chem_extfrc_;
+  view_2d chem_vmr_, chem_invariants_;
+
   // column areas, latitudes, longitudes
   const_view_1d col_areas_, col_latitudes_, col_longitudes_;
 
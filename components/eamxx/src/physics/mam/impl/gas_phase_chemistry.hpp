@@ -0,0 +1,227 @@
+#ifndef EAMXX_MAM_GAS_PHASE_CHEMISTRY_HPP
+#define EAMXX_MAM_GAS_PHASE_CHEMISTRY_HPP
+
+#include <physics/mam/mam_coupling.hpp>
+
+#include <mam4xx/mam4.hpp>
+
+// Gas phase chemistry kernels. The photolysis table is read (with NetCDF) in
+// gas_phase_chemistry.cpp, which includes this header.
+
+namespace scream::impl {
+
+// performs gas phase chemistry calculations on a single level of a single
+// atmospheric column
+KOKKOS_INLINE_FUNCTION
+void gas_phase_chemistry(Real zm, Real zi, Real phis, Real temp, Real pmid, Real pdel, Real dt,
+                         const Real photo_rates[mam4::mo_photo::phtcnt], // in
+                         const Real extfrc[mam4::gas_chemistry::extcnt], // in
+                         Real q[mam4::gas_chemistry::gas_pcnst], // VMRs, inout
+                         Real invariants[mam4::gas_chemistry::nfs]) { // out
+  // constexpr Real rga = 1.0/haero::Constants::gravity;
+  // constexpr Real m2km = 0.01; // converts m -> km
+
+  // The following things are chemical mechanism dependent! See mam4xx/src/mam4xx/gas_chem_mechanism.hpp)
+  constexpr int gas_pcnst = mam4::gas_chemistry::gas_pcnst; // number of gas phase species
+  constexpr int rxntot = mam4::gas_chemistry::rxntot;       // number of chemical reactions
+  constexpr int extcnt = mam4::gas_chemistry::extcnt;       // number of species with external forcing
+  constexpr int indexm = 0;  // FIXME: index of total atm density in invariants array
+
+  constexpr int phtcnt = mam4::mo_photo::phtcnt; // number of photolysis reactions
+
+  constexpr int itermax = mam4::gas_chemistry::itermax;
+  constexpr int clscnt4 = mam4::gas_chemistry::clscnt4;
+
+  // NOTE: vvv these arrays were copied from mam4xx/gas_chem_mechanism.hpp vvv
+  constexpr int permute_4[gas_pcnst] = {0,  1,  2,  3,  4,  5,  6,  7,  8,  9,
+                                        10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+                                        20, 21, 22, 23, 24, 25, 26, 27, 28, 29};
+  constexpr int clsmap_4[gas_pcnst] = {1,  2,  3,  4,  5,  6,  7,  8,  9,  10,
+                                       11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+                                       21, 22, 23, 24, 25, 26, 27, 28, 29, 30};
+
+  // These indices for species are fixed by the chemical mechanism
+  // std::string solsym[] = {"O3", "H2O2", "H2SO4", "SO2", "DMS", "SOAG",
+  //                         "so4_a1", "pom_a1", "soa_a1", "bc_a1", "dst_a1",
+  //                         "ncl_a1", "mom_a1", "num_a1", "so4_a2", "soa_a2",
+  //                         "ncl_a2", "mom_a2", "num_a2", "dst_a3", "ncl_a3",
+  //                         "so4_a3", "bc_a3", "pom_a3", "soa_a3", "mom_a3",
+  //                         "num_a3", "pom_a4", "bc_a4", "mom_a4", "num_a4"};
+  constexpr int ndx_h2so4 = 2;
+  // std::string extfrc_list[] = {"SO2", "so4_a1", "so4_a2", "pom_a4", "bc_a4",
+  //                              "num_a1", "num_a2", "num_a3", "num_a4", "SOAG"};
+  constexpr int synoz_ndx = -1;
+
+  // fetch the zenith angle (not its cosine!) in degrees for this column.
+  // FIXME: For now, we fix the zenith angle. At length, we need to compute it
+  // FIXME: from EAMxx's current set of orbital parameters, which requires some
+  // FIXME: conversation with the EAMxx team.
+
+  // xform geopotential height from m to km and pressure from Pa to mb
+  // Real zsurf = rga * phis;
+  // Real zmid = m2km * (zm + zsurf);
+
+  // ... compute the column's invariants
+  // Real h2ovmr = q[0];
+  // setinv(invariants, temp, h2ovmr, q, pmid); FIXME: not ported yet
+
+  // ... set rates for "tabular" and user specified reactions
+  Real reaction_rates[rxntot];
+  mam4::gas_chemistry::setrxt(reaction_rates, temp);
+
+  // set reaction rates based on chemical invariants
+  // (indices (ndxes?) are taken from mam4 validation data and translated from
+  // 1-based indices to 0-based indices)
+  int usr_HO2_HO2_ndx = 1, usr_DMS_OH_ndx = 5,
+      usr_SO2_OH_ndx = 3, inv_h2o_ndx = 3;
+  mam4::gas_chemistry::usrrxt(reaction_rates, temp, invariants, invariants[indexm],
+                              usr_HO2_HO2_ndx, usr_DMS_OH_ndx,
+                              usr_SO2_OH_ndx, inv_h2o_ndx);
+  mam4::gas_chemistry::adjrxt(reaction_rates, invariants, invariants[indexm]);
+
+  //===================================
+  // Photolysis rates at time = t(n+1)
+  //===================================
+
+  // compute the rate of change from forcing
+  Real extfrc_rates[extcnt]; // [1/cm^3/s]
+  for (int mm = 0; mm < extcnt; ++mm) {
+    if (mm != synoz_ndx) {
+      extfrc_rates[mm] = extfrc[mm] / invariants[indexm];
+    }
+  }
+
+  // ... Form the washout rates
+  Real het_rates[gas_pcnst];
+  // FIXME: not ported yet
+  //sethet(het_rates, pmid, zmid, phis, temp, cmfdqr, prain, nevapr, delt,
+  //       invariants[indexm], q);
+
+
+  // save h2so4 before gas phase chem (for later new particle nucleation)
+  Real del_h2so4_gasprod = q[ndx_h2so4];
+
+  //===========================
+  // Class solution algorithms
+  //===========================
+
+  // copy photolysis rates into reaction_rates (assumes photolysis rates come first)
+  for (int i = 0; i < phtcnt; ++i) {
+    reaction_rates[i] = photo_rates[i];
+  }
+
+  // ... solve for "Implicit" species
+  bool factor[itermax];
+  for (int i = 0; i < itermax; ++i) {
+    factor[i] = true;
+  }
+
+  // initialize error tolerances
+  Real epsilon[clscnt4];
+  mam4::gas_chemistry::imp_slv_inti(epsilon);
+
+  // solve chemical system implicitly
+  Real prod_out[clscnt4], loss_out[clscnt4];
+  mam4::gas_chemistry::imp_sol(q, reaction_rates, het_rates, extfrc_rates, dt,
+    permute_4, clsmap_4, factor, epsilon, prod_out, loss_out);
+
+  // save h2so4 change by gas phase chem (for later new particle nucleation)
+  if (ndx_h2so4 > 0) {
+    del_h2so4_gasprod = q[ndx_h2so4] - del_h2so4_gasprod;
+  }
+}
+
+//-------------------------------------------------------------------------
+//                    Batched gas phase chemistry
+//-------------------------------------------------------------------------
+// The implicit solve in gas_phase_chemistry has a per-level cost that depends
+// on the number of Newton iterations needed to converge, so dispatching it
+// from a TeamThreadRange over levels (one team per column) leaves most of the
+// team idle while the slowest levels converge, and keeps O(gas_pcnst) arrays
+// per level on the stack of few threads. Instead, we flatten all (column,level)
+// cells into a single range, so that consecutive cells are processed by
+// consecutive threads (i.e., batched in warps on GPU, or in contiguous chunks
+// on CPU), and store per-cell chemistry data with the cell index fastest, so
+// that each species is contiguous across a batch of cells.
+
+using View2D = haero::DeviceType::view_2d<Real>;
+using View3D = haero::DeviceType::view_3d<Real>;
+
+// storage for the batched gas phase chemistry of ncol columns with nlev levels
+struct GasPhaseChemistryData {
+  View3D photo_rates; // photolysis rates, (ncol, nlev, phtcnt) [1/s]
+  View3D extfrc;      // external forcings, (ncol, nlev, extcnt) [molecules/cm^3/s]
+  View2D vmr;         // gas/aerosol volume mixing ratios, (gas_pcnst, ncol*nlev)
+  View2D invariants;  // invariants ("fixed species"), (nfs, ncol*nlev)
+};
+
+// ON HOST, allocates the storage for batched gas phase chemistry
+inline GasPhaseChemistryData create_gas_phase_chemistry_data(const int ncol, const int nlev) {
+  const int ncell = ncol*nlev;
+  GasPhaseChemistryData data;
+  data.photo_rates = View3D("photo_rates", ncol, nlev, mam4::mo_photo::phtcnt);
+  data.extfrc      = View3D("extfrc",      ncol, nlev, mam4::gas_chemistry::extcnt);
+  data.vmr         = View2D("chem_vmr",       mam4::gas_chemistry::gas_pcnst, ncell);
+  data.invariants  = View2D("chem_invariants", mam4::gas_chemistry::nfs,      ncell);
+  return data;
+}
+
+// performs gas phase chemistry on all cells of the given atmosphere state,
+// using (and updating) the VMRs in data.vmr. Cell indices are icol*nlev+k.
+inline void gas_phase_chemistry_batched(const int ncol, const int nlev, const Real dt,
+                                        const mam_coupling::DryAtmosphere& dry_atm,
+                                        const GasPhaseChemistryData& data) {
+  constexpr int gas_pcnst = mam4::gas_chemistry::gas_pcnst;
+  constexpr int extcnt    = mam4::gas_chemistry::extcnt;
+  constexpr int nfs       = mam4::gas_chemistry::nfs;
+  constexpr int phtcnt    = mam4::mo_photo::phtcnt;
+
+  const auto T_mid       = dry_atm.T_mid;
+  const auto p_mid       = dry_atm.p_mid;
+  const auto p_del       = dry_atm.p_del;
+  const auto z_mid       = dry_atm.z_mid;
+  const auto z_iface     = dry_atm.z_iface;
+  const auto phis        = dry_atm.phis;
+  const auto photo_rates = data.photo_rates;
+  const auto extfrc      = data.extfrc;
+  const auto vmr         = data.vmr;
+  const auto invariants  = data.invariants;
+
+  Kokkos::parallel_for("gas_phase_chemistry_batched", ncol*nlev,
+                       KOKKOS_LAMBDA(const int icell) {
+    const int icol = icell / nlev;
+    const int k    = icell % nlev;
+
+    Real photo_rates_k[phtcnt];
+    for (int i = 0; i < phtcnt; ++i) {
+      photo_rates_k[i] = photo_rates(icol, k, i);
+    }
+    Real extfrc_k[extcnt];
+    for (int i = 0; i < extcnt; ++i) {
+      extfrc_k[i] = extfrc(icol, k, i);
+    }
+    Real vmr_k[gas_pcnst];
+    for (int i = 0; i < gas_pcnst; ++i) {
+      vmr_k[i] = vmr(i, icell);
+    }
+    Real invariants_k[nfs];
+    for (int i = 0; i < nfs; ++i) {
+      invariants_k[i] = invariants(i, icell);
+    }
+
+    gas_phase_chemistry(z_mid(icol, k), z_iface(icol, k), phis(icol),
+                        T_mid(icol, k), p_mid(icol, k), p_del(icol, k), dt,
+                        photo_rates_k, extfrc_k, vmr_k, invariants_k);
+
+    for (int i = 0; i < gas_pcnst; ++i) {
+      vmr(i, icell) = vmr_k[i];
+    }
+    for (int i = 0; i < nfs; ++i) {
+      invariants(i, icell) = invariants_k[i];
+    }
+  });
+}
+
+} // namespace scream::impl
+
+#endif // EAMXX_MAM_GAS_PHASE_CHEMISTRY_HPP
@@ -732,7 +732,7 @@ void copy_view_lev_slice(haero::ThreadTeamPolicy team_policy, //inputs
                          const int dim,                       //dimension till view should be copied
                          view_2d &out_view) {                 //output view
 
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("mam_coupling::copy_view_lev_slice",
       team_policy, KOKKOS_LAMBDA(const haero::ThreadTeam &team) {
         const int icol = team.league_rank();
         Kokkos::parallel_for(Kokkos::TeamThreadRange(team, dim), [&](int kk) {
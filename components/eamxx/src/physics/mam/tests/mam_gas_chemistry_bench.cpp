@@ -0,0 +1,152 @@
+#include <catch2/catch.hpp>
+
+#include "physics/mam/eamxx_mam_microphysics_process_interface.hpp"
+
+#include "physics/mam/impl/gas_phase_chemistry.hpp"
+
+#include <ekat/util/ekat_test_utils.hpp>
+
+#include <chrono>
+
+namespace scream {
+
+// Micro-benchmark for the MAM4 gas phase chemistry kernel. We compare the
+// batched dispatch (one thread per (column,level) cell) with the original
+// team-per-column dispatch (TeamThreadRange over levels), and check that
+// they produce the same answer.
+// The problem size can be set via
+//   --ekat-test-params ncols=<N>,nlevs=<N>,nrepeat=<N>
+
+TEST_CASE ("mam_gas_chemistry_bench")
+{
+  using KT = KokkosTypes<DefaultDevice>;
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using view_1d = KT::view_1d<Real>;
+  using view_2d = KT::view_2d<Real>;
+
+  constexpr int gas_pcnst = mam4::gas_chemistry::gas_pcnst;
+  constexpr int extcnt    = mam4::gas_chemistry::extcnt;
+  constexpr int nfs       = mam4::gas_chemistry::nfs;
+  constexpr int phtcnt    = mam4::mo_photo::phtcnt;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto& session = ekat::TestSession::get();
+  session.params.emplace("ncols","218");
+  session.params.emplace("nlevs","72");
+  session.params.emplace("nrepeat","10");
+  const int ncols   = std::stoi(session.params["ncols"]);
+  const int nlevs   = std::stoi(session.params["nlevs"]);
+  const int nrepeat = std::stoi(session.params["nrepeat"]);
+  const int ncells  = ncols*nlevs;
+  const Real dt = 1800;
+
+  // A simple (dry) atmosphere state
+  view_2d T_mid("T_mid",ncols,nlevs), p_mid("p_mid",ncols,nlevs), p_del("p_del",ncols,nlevs);
+  view_2d z_mid("z_mid",ncols,nlevs), z_iface("z_iface",ncols,nlevs+1);
+  view_1d phis("phis",ncols);
+  Kokkos::parallel_for(ncells, KOKKOS_LAMBDA(const int icell) {
+    const int icol = icell / nlevs;
+    const int k    = icell % nlevs;
+    const Real x = (k + 0.5) / nlevs;
+    p_del(icol,k)   = 1e5 / nlevs;
+    p_mid(icol,k)   = 1e5 * x;
+    T_mid(icol,k)   = 200 + 100*x + 0.1*icol/ncols;
+    z_mid(icol,k)   = 2e4 * (1-x);
+    z_iface(icol,k) = 2e4 * (1-Real(k)/nlevs);
+    if (k==0) {
+      phis(icol) = 0;
+      z_iface(icol,nlevs) = 0;
+    }
+  });
+  mam_coupling::DryAtmosphere dry_atm;
+  dry_atm.T_mid   = T_mid;
+  dry_atm.p_mid   = p_mid;
+  dry_atm.p_del   = p_del;
+  dry_atm.z_mid   = z_mid;
+  dry_atm.z_iface = z_iface;
+  dry_atm.phis    = phis;
+
+  // Chemistry inputs
+  auto data = impl::create_gas_phase_chemistry_data(ncols,nlevs);
+  Kokkos::deep_copy(data.photo_rates,1e-6);
+  Kokkos::deep_copy(data.extfrc,0);
+  const auto vmr = data.vmr;
+  const auto invariants = data.invariants;
+  Kokkos::parallel_for(ncells, KOKKOS_LAMBDA(const int icell) {
+    const int icol = icell / nlevs;
+    const int k    = icell % nlevs;
+    // Total number density [molecules/cm^3], roughly p/(kB*T)
+    const Real xhnm = 7.24e16 * p_mid(icol,k) / T_mid(icol,k);
+    for (int i=0; i<nfs; ++i) {
+      invariants(i,icell) = (i==0 ? 1 : 1e-2) * xhnm;
+    }
+    for (int i=0; i<gas_pcnst; ++i) {
+      vmr(i,icell) = 1e-10 * (1 + i + Real(k)/nlevs);
+    }
+  });
+  view_2d vmr0("vmr0",gas_pcnst,ncells), vmr_ref("vmr_ref",gas_pcnst,ncells);
+  Kokkos::deep_copy(vmr0,vmr);
+
+  auto time_it = [&](auto&& f) {
+    f(); // Warm up
+    Kokkos::fence();
+    auto start = std::chrono::steady_clock::now();
+    for (int i=0; i<nrepeat; ++i) {
+      f();
+    }
+    Kokkos::fence();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count() / (1e3*nrepeat);
+  };
+
+  // Team-per-column dispatch, with a TeamThreadRange over levels
+  const auto policy = ESU::get_default_team_policy(ncols,nlevs);
+  const auto photo_rates = data.photo_rates;
+  const auto extfrc = data.extfrc;
+  auto run_per_column = [&]() {
+    Kokkos::deep_copy(vmr_ref,vmr0);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const KT::MemberType& team) {
+      const int icol = team.league_rank();
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nlevs),[&](const int k) {
+        const int icell = icol*nlevs + k;
+        Real photo_rates_k[phtcnt], extfrc_k[extcnt], vmr_k[gas_pcnst], invariants_k[nfs];
+        for (int i=0; i<phtcnt; ++i)    photo_rates_k[i] = photo_rates(icol,k,i);
+        for (int i=0; i<extcnt; ++i)    extfrc_k[i]      = extfrc(icol,k,i);
+        for (int i=0; i<gas_pcnst; ++i) vmr_k[i]         = vmr_ref(i,icell);
+        for (int i=0; i<nfs; ++i)       invariants_k[i]  = invariants(i,icell);
+        impl::gas_phase_chemistry(z_mid(icol,k), z_iface(icol,k), phis(icol),
+                                  T_mid(icol,k), p_mid(icol,k), p_del(icol,k), dt,
+                                  photo_rates_k, extfrc_k, vmr_k, invariants_k);
+        for (int i=0; i<gas_pcnst; ++i) vmr_ref(i,icell) = vmr_k[i];
+      });
+    });
+  };
+
+  // Batched dispatch
+  auto run_batched = [&]() {
+    Kokkos::deep_copy(vmr,vmr0);
+    impl::gas_phase_chemistry_batched(ncols,nlevs,dt,dry_atm,data);
+  };
+
+  const double ms_col   = time_it(run_per_column);
+  const double ms_batch = time_it(run_batched);
+  if (comm.am_i_root()) {
+    printf(" -> gas phase chemistry, %d cols x %d levs\n",ncols,nlevs);
+    printf("    - per column: %.4f ms/call\n",ms_col);
+    printf("    - batched   : %.4f ms/call\n",ms_batch);
+  }
+
+  // Both dispatches run the same per-cell code, so answers must match exactly
+  auto vmr_h     = Kokkos::create_mirror_view(vmr);
+  auto vmr_ref_h = Kokkos::create_mirror_view(vmr_ref);
+  Kokkos::deep_copy(vmr_h,vmr);
+  Kokkos::deep_copy(vmr_ref_h,vmr_ref);
+  for (int i=0; i<gas_pcnst; ++i) {
+    for (int icell=0; icell<ncells; ++icell) {
+      REQUIRE (vmr_h(i,icell)==vmr_ref_h(i,icell));
+    }
+  }
+}
+
+} // namespace scream
@@ -6,6 +6,8 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 
+#include <map>
+
 namespace scream {
 // =========================================================================================
 MLCorrection::MLCorrection(const ekat::Comm &comm,
@@ -16,6 +18,11 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ML_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ML_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ML_correction_unit_test");
+  m_ML_backend = m_params.get<std::string>("ML_backend","python");
+  EKAT_REQUIRE_MSG (m_ML_backend=="python" or m_ML_backend=="kokkos",
+      "Error! Invalid value for 'ML_backend' in MLCorrection.\n"
+      "  - input value: " + m_ML_backend + "\n"
+      "  - valid values: python, kokkos\n");
 }
 
 // =========================================================================================
@@ -72,18 +79,41 @@ void MLCorrection::set_grids(
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy  
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_ML_backend=="python") {
+    fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for importing numpy  
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    ekat::enable_fpes(fpe_mask);
+  } else {
+    // Models are stored in the order they are applied, as in ml_correction.py
+    int max_inputs = 0, max_outputs = 0;
+    bool needs_cos_zenith = false;
+    for (const auto& path : {m_ML_model_path_tq,m_ML_model_path_uv,m_ML_model_path_sfc_fluxes}) {
+      if (path=="NONE") {
+        continue;
+      }
+      m_ML_models.push_back(create_ml_model(path));
+      const auto& mlp = *m_ML_models.back().mlp;
+      max_inputs  = std::max(max_inputs,mlp.num_inputs());
+      max_outputs = std::max(max_outputs,mlp.num_outputs());
+      for (const auto& v : mlp.inputs()) {
+        needs_cos_zenith |= v.name=="cos_zenith_angle";
+      }
+    }
+    m_ML_inputs  = view_2d<Real>("ML_inputs",m_num_cols,max_inputs);
+    m_ML_outputs = view_2d<Real>("ML_outputs",m_num_cols,max_outputs);
+    if (needs_cos_zenith) {
+      m_cos_zenith = view_1d<Real>("cos_zenith",m_num_cols);
+    }
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -98,73 +128,24 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
-  // use model time to infer solar zenith angle for the ML prediction
-  auto current_ts = timestamp();
-  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
-
-  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
-  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
-
-  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
-  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
-  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
-  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
-  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
-  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
-  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
-
   // For precipitation adjustment we need to track the change in column integrated 'qv'
   // So we clone the original qv before ML changes the state so we can back out a qv_tend
   // to use with precip adjustment.
   auto qv_src = get_field_in("qv");
   auto qv_in = qv_src.clone();
 
-  auto h_lat  = m_lat.get_view<const Real*,Host>();
-  auto h_lon  = m_lon.get_view<const Real*,Host>();
-
-  const auto& tracers = get_group_out("tracers");
-  const auto& tracers_info = tracers.m_info;
-  Int num_tracers = tracers_info->size();
-
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_ML_backend=="python") {
+    run_python(dt);
+  } else {
+    run_kokkos(dt);
   }
-  // for qv, we need to stride across number of tracers
-  pybind11::object ob1     = py_correction.attr("update_fields")(
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),          
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, u.data(), pybind11::str{}),        
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, v.data(), pybind11::str{}),       
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lat.data(), pybind11::str{}),       
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lon.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, phis.data(), pybind11::str{}),   
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),   
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),                                                                                                   
-      m_num_cols, m_num_levs, num_tracers, dt, 
-      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
-  pybind11::gil_scoped_release no_gil;  
-  ekat::enable_fpes(fpe_mask);   
 
   // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
   if (m_ML_model_path_tq != "None") {
     using PC  = scream::physics::Constants<Real>;
-    using KT  = KokkosTypes<DefaultDevice>;
     using MT  = typename KT::MemberType;
     using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+    const auto &T_mid                = get_field_in("T_mid").get_view<const Real**>();
     const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
     const auto &precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real *>();
     const auto &precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real *>();
@@ -227,6 +208,253 @@ void MLCorrection::run_impl(const double dt) {
   }
 }
 
+// =========================================================================================
+void MLCorrection::run_python(const double dt) {
+  // use model time to infer solar zenith angle for the ML prediction
+  auto current_ts = timestamp();
+  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
+
+  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
+  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
+
+  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
+  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
+  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
+  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
+  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
+  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
+  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
+
+  auto h_lat  = m_lat.get_view<const Real*,Host>();
+  auto h_lon  = m_lon.get_view<const Real*,Host>();
+
+  const auto& tracers = get_group_out("tracers");
+  const auto& tracers_info = tracers.m_info;
+  Int num_tracers = tracers_info->size();
+
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    pybind11::initialize_interpreter();
+  }
+  // for qv, we need to stride across number of tracers
+  pybind11::object ob1     = py_correction.attr("update_fields")(
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),          
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, u.data(), pybind11::str{}),        
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, v.data(), pybind11::str{}),       
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lat.data(), pybind11::str{}),       
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lon.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, phis.data(), pybind11::str{}),   
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),   
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),                                                                                                   
+      m_num_cols, m_num_levs, num_tracers, dt, 
+      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
+  pybind11::gil_scoped_release no_gil;  
+  ekat::enable_fpes(fpe_mask);   
+}
+
+// =========================================================================================
+void MLCorrection::run_kokkos(const double dt) {
+  if (m_cos_zenith.size()>0) {
+    compute_cos_zenith();
+  }
+  for (auto& model : m_ML_models) {
+    apply_ml_model(model,dt);
+  }
+}
+
+// =========================================================================================
+MLCorrection::MLModel
+MLCorrection::create_ml_model(const std::string& path) const {
+  MLModel model;
+  model.mlp = std::make_shared<MLCorrectionMLP>(m_comm,path);
+
+  const auto& inputs  = model.mlp->inputs();
+  const auto& outputs = model.mlp->outputs();
+  model.in_map  = view_2d<int>("ML_in_map",inputs.size(),3);
+  model.out_map = view_2d<int>("ML_out_map",outputs.size(),3);
+  auto in_map_h  = Kokkos::create_mirror_view(model.in_map);
+  auto out_map_h = Kokkos::create_mirror_view(model.out_map);
+
+  // Names match the ones used by the python models (see ml_correction.py)
+  const std::map<std::string,int> in_ids = {
+    {"T_mid",InTmid}, {"qv",InQv}, {"U",InU}, {"V",InV}, {"lat",InLat},
+    {"surface_geopotential",InPhis}, {"cos_zenith_angle",InCosZenith},
+    {"surface_diffused_shortwave_albedo",InSfcAlbDifVis},
+    {"total_sky_downward_shortwave_flux_at_top_of_atmosphere",InSWFluxDnToa}
+  };
+  const std::map<std::string,int> out_ids = {
+    {"dQ1",OutdT}, {"dQ2",OutdQv}, {"dQu",OutdU}, {"dQv",OutdV},
+    {"dQxwind",OutdU}, {"dQywind",OutdV},
+    {"net_shortwave_sfc_flux_via_transmissivity",OutSfcFluxSWNet},
+    {"override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface",OutSfcFluxLWDn}
+  };
+
+  auto is_profile = [](const int id, const bool input) {
+    return input ? id<=InV : id<=OutdV;
+  };
+  auto fill_map = [&](const std::vector<MLCorrectionMLP::Variable>& vars,
+                      const std::map<std::string,int>& ids,
+                      decltype(in_map_h)& map, const bool input) {
+    for (size_t i=0; i<vars.size(); ++i) {
+      const auto& v = vars[i];
+      EKAT_REQUIRE_MSG (ids.count(v.name)==1,
+          "Error! Unsupported ML model " + std::string(input ? "input" : "output") + " variable.\n"
+          "  - model file: " + path + "\n"
+          "  - variable  : " + v.name + "\n");
+      const int id = ids.at(v.name);
+      const int expected_size = is_profile(id,input) ? m_num_levs : 1;
+      EKAT_REQUIRE_MSG (v.size==expected_size,
+          "Error! Unexpected size for ML model variable.\n"
+          "  - model file   : " + path + "\n"
+          "  - variable     : " + v.name + "\n"
+          "  - size         : " + std::to_string(v.size) + "\n"
+          "  - expected size: " + std::to_string(expected_size) + "\n");
+      EKAT_REQUIRE_MSG (is_profile(id,input) or not m_ML_correction_unit_test,
+          "Error! ML model variable not available in unit test mode.\n"
+          "  - model file: " + path + "\n"
+          "  - variable  : " + v.name + "\n");
+      map(i,0) = id;
+      map(i,1) = v.offset;
+      map(i,2) = v.size;
+    }
+  };
+  fill_map(inputs,in_ids,in_map_h,true);
+  fill_map(outputs,out_ids,out_map_h,false);
+  Kokkos::deep_copy(model.in_map,in_map_h);
+  Kokkos::deep_copy(model.out_map,out_map_h);
+
+  return model;
+}
+
+// =========================================================================================
+void MLCorrection::compute_cos_zenith() {
+  // Cosine of the solar zenith angle, using the solar declination and equation
+  // of time approximations of Spencer (1971), with lat/lon in degrees.
+  using PC = scream::physics::Constants<Real>;
+  constexpr Real pi = PC::Pi;
+  constexpr Real deg2rad = pi/180;
+
+  const auto ts = timestamp();
+  const Real g = 2*pi/365 * (ts.frac_of_year_in_days() - 0.5);
+  const Real decl = 0.006918 - 0.399912*std::cos(g) + 0.070257*std::sin(g)
+                  - 0.006758*std::cos(2*g) + 0.000907*std::sin(2*g)
+                  - 0.002697*std::cos(3*g) + 0.00148*std::sin(3*g);
+  const Real eqtime = 229.18*(0.000075 + 0.001868*std::cos(g) - 0.032077*std::sin(g)
+                    - 0.014615*std::cos(2*g) - 0.040849*std::sin(2*g));
+  const Real sin_decl = std::sin(decl);
+  const Real cos_decl = std::cos(decl);
+  const Real minute_of_day = ts.sec_of_day() / 60.0;
+
+  const auto lat  = m_lat.get_view<const Real*>();
+  const auto lon  = m_lon.get_view<const Real*>();
+  const auto cosz = m_cos_zenith;
+  Kokkos::parallel_for("MLCorrection::compute_cos_zenith",
+                       KT::RangePolicy(0,m_num_cols),
+                       KOKKOS_LAMBDA(const int icol) {
+    // True solar time (in minutes) and hour angle
+    const Real tst = minute_of_day + eqtime + 4*lon(icol);
+    const Real ha  = (tst/4 - 180)*deg2rad;
+    const Real lat_r = lat(icol)*deg2rad;
+    cosz(icol) = Kokkos::sin(lat_r)*sin_decl + Kokkos::cos(lat_r)*cos_decl*Kokkos::cos(ha);
+  });
+}
+
+// =========================================================================================
+void MLCorrection::apply_ml_model(MLModel& model, const double dt) {
+  using MT  = typename KT::MemberType;
+  using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const auto T_mid = get_field_out("T_mid").get_view<Real**>();
+  const auto qv    = get_field_out("qv").get_view<Real**>();
+  const auto u     = get_field_out("horiz_winds").get_component(0).get_view<Real**>();
+  const auto v     = get_field_out("horiz_winds").get_component(1).get_view<Real**>();
+
+  // These are not registered in unit test mode (see create_ml_model for the check)
+  Field::get_view_type<const Real*,Device>  lat, phis, sfc_alb_dif_vis;
+  Field::get_view_type<const Real**,Device> SW_flux_dn;
+  Field::get_view_type<Real*,Device>        sfc_flux_sw_net, sfc_flux_lw_dn;
+  if (not m_ML_correction_unit_test) {
+    lat             = m_lat.get_view<const Real*>();
+    phis            = get_field_in("phis").get_view<const Real*>();
+    sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+    SW_flux_dn      = get_field_in("SW_flux_dn").get_view<const Real**>();
+    sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
+    sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
+  }
+  const auto cosz = m_cos_zenith;
+  const auto x    = m_ML_inputs;
+  const auto y    = m_ML_outputs;
+
+  const auto in_map   = model.in_map;
+  const auto out_map  = model.out_map;
+  const int  nin_vars  = in_map.extent(0);
+  const int  nout_vars = out_map.extent(0);
+
+  const auto policy = ESU::get_default_team_policy(m_num_cols, m_num_levs);
+
+  // Pack the model inputs in the (ncols,num_inputs) array
+  Kokkos::parallel_for("MLCorrection::gather_inputs", policy,
+                       KOKKOS_LAMBDA(const MT& team) {
+    const int icol = team.league_rank();
+    for (int iv=0; iv<nin_vars; ++iv) {
+      const int id     = in_map(iv,0);
+      const int offset = in_map(iv,1);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,in_map(iv,2)),[&](const int k) {
+        Real val = 0;
+        switch (id) {
+          case InTmid:          val = T_mid(icol,k);         break;
+          case InQv:            val = qv(icol,k);            break;
+          case InU:             val = u(icol,k);             break;
+          case InV:             val = v(icol,k);             break;
+          case InLat:           val = lat(icol);             break;
+          case InPhis:          val = phis(icol);            break;
+          case InCosZenith:     val = cosz(icol);            break;
+          case InSfcAlbDifVis:  val = sfc_alb_dif_vis(icol); break;
+          case InSWFluxDnToa:   val = SW_flux_dn(icol,0);    break;
+        }
+        x(icol,offset+k) = val;
+      });
+    }
+  });
+
+  model.mlp->predict(x,y);
+
+  // Apply tendencies to the state, and override the surface fluxes
+  Kokkos::parallel_for("MLCorrection::apply_outputs", policy,
+                       KOKKOS_LAMBDA(const MT& team) {
+    const int icol = team.league_rank();
+    for (int iv=0; iv<nout_vars; ++iv) {
+      const int id     = out_map(iv,0);
+      const int offset = out_map(iv,1);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,out_map(iv,2)),[&](const int k) {
+        const Real val = y(icol,offset+k);
+        switch (id) {
+          case OutdT:           T_mid(icol,k) += val*dt;  break;
+          case OutdQv:          qv(icol,k)    += val*dt;  break;
+          case OutdU:           u(icol,k)     += val*dt;  break;
+          case OutdV:           v(icol,k)     += val*dt;  break;
+          case OutSfcFluxSWNet: sfc_flux_sw_net(icol) = val; break;
+          case OutSfcFluxLWDn:  sfc_flux_lw_dn(icol)  = val; break;
+        }
+      });
+    }
+  });
+}
+
 // =========================================================================================
 void MLCorrection::finalize_impl() {
   // Do nothing
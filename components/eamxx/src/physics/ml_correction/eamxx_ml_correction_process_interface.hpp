@@ -6,6 +6,7 @@
 #include <pybind11/pybind11.h>
 #include <array>
 #include <string>
+#include "ml_correction_mlp.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/util/ekat_lin_interp.hpp"
@@ -30,6 +31,12 @@ namespace scream {
 class MLCorrection : public AtmosphereProcess {
  public:
   using Pack = ekat::Pack<Real,SCREAM_PACK_SIZE>;
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
   // Constructors
   MLCorrection(const ekat::Comm &comm, const ekat::ParameterList &params);
 
@@ -49,6 +56,30 @@ class MLCorrection : public AtmosphereProcess {
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
+  // Run the ML models via the python interpreter (reference implementation)
+  void run_python (const double dt);
+  // Run the ML models on device, via the C++ MLP executor
+  void run_kokkos (const double dt);
+
+  // Sources/targets for the inputs/outputs of the C++ ML models
+  enum MLInput : int {
+    InTmid, InQv, InU, InV, InLat, InPhis, InCosZenith, InSfcAlbDifVis, InSWFluxDnToa
+  };
+  enum MLOutput : int {
+    OutdT, OutdQv, OutdU, OutdV, OutSfcFluxSWNet, OutSfcFluxLWDn
+  };
+
+  struct MLModel {
+    std::shared_ptr<MLCorrectionMLP> mlp;
+    // For each model input/output variable: MLInput/MLOutput id, offset, size
+    view_2d<int> in_map;
+    view_2d<int> out_map;
+  };
+
+  MLModel create_ml_model (const std::string& path) const;
+  void compute_cos_zenith ();
+  void apply_ml_model (MLModel& model, const double dt);
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
@@ -60,11 +91,21 @@ class MLCorrection : public AtmosphereProcess {
   std::string m_ML_model_path_sfc_fluxes;
   std::vector<std::string> m_fields_ml_output_variables;
   bool m_ML_correction_unit_test;
+  // Either "python" or "kokkos"
+  std::string m_ML_backend;
+
+  // Python backend
   pybind11::module py_correction;
   pybind11::object ML_model_tq;
   pybind11::object ML_model_uv;
   pybind11::object ML_model_sfc_fluxes;
   int fpe_mask;
+
+  // Kokkos backend
+  std::vector<MLModel> m_ML_models;
+  view_2d<Real> m_ML_inputs;
+  view_2d<Real> m_ML_outputs;
+  view_1d<Real> m_cos_zenith;
 };  // class MLCorrection
 
 }  // namespace scream
@@ -0,0 +1,236 @@
+#include "ml_correction_mlp.hpp"
+
+#include "share/util/scream_utils.hpp"
+
+#include "ekat/ekat_assert.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace scream {
+
+MLCorrectionMLP::
+MLCorrectionMLP (const ekat::Comm& comm, const std::string& filename)
+{
+  // Only root reads the file, then broadcasts its (comment-free) content
+  std::string contents;
+  if (comm.am_i_root()) {
+    std::ifstream ifile(filename);
+    EKAT_REQUIRE_MSG (ifile.good(),
+        "Error! Could not open ML model weights file.\n"
+        "  - file name: " + filename + "\n");
+    std::string line;
+    while (std::getline(ifile,line)) {
+      // Strip comments, which extend from '#' to the end of the line
+      auto pos = line.find('#');
+      contents += line.substr(0,pos) + "\n";
+    }
+  }
+  broadcast_string(contents,comm,comm.root_rank());
+
+  parse(contents);
+}
+
+void MLCorrectionMLP::parse (const std::string& contents)
+{
+  std::istringstream is(contents);
+  std::string token;
+
+  auto expect = [&](const std::string& kw) {
+    is >> token;
+    EKAT_REQUIRE_MSG (is and token==kw,
+        "Error! Unexpected token in ML model weights file.\n"
+        "  - expected: " + kw + "\n"
+        "  - found   : " + token + "\n");
+  };
+  // All integers in the file (counts and sizes) must be positive
+  auto read_int = [&](const std::string& what) {
+    int i;
+    is >> i;
+    EKAT_REQUIRE_MSG (is and i>0,
+        "Error! Invalid or missing " + what + " in ML model weights file.\n"
+        "  - expected: a positive integer\n");
+    return i;
+  };
+  auto read_vars = [&](const std::string& kw, std::vector<Variable>& vars) {
+    expect(kw);
+    const int n = read_int("number of " + kw);
+    int offset = 0;
+    for (int i=0; i<n; ++i) {
+      is >> token;
+      auto pos = token.find(':');
+      EKAT_REQUIRE_MSG (is and pos!=std::string::npos,
+          "Error! Invalid variable specification in ML model weights file.\n"
+          "  - expected: <name>:<size>\n"
+          "  - found   : " + token + "\n");
+      Variable v;
+      v.name = token.substr(0,pos);
+      v.offset = offset;
+      std::istringstream size_is(token.substr(pos+1));
+      EKAT_REQUIRE_MSG ((size_is >> v.size) and size_is.eof() and v.size>0,
+          "Error! Invalid variable size in ML model weights file.\n"
+          "  - expected: <name>:<size>, with size>0\n"
+          "  - found   : " + token + "\n");
+      offset += v.size;
+      vars.push_back(v);
+    }
+    return offset;
+  };
+  auto read_values = [&](Real* data, const int n) {
+    for (int i=0; i<n; ++i) {
+      is >> data[i];
+    }
+    EKAT_REQUIRE_MSG (is,
+        "Error! Not enough values in ML model weights file.\n");
+  };
+
+  m_num_inputs  = read_vars("inputs",m_inputs);
+  m_num_outputs = read_vars("outputs",m_outputs);
+
+  m_input_scaling  = view_2d<Real>("mlp_input_scaling",m_num_inputs,2);
+  m_output_scaling = view_2d<Real>("mlp_output_scaling",m_num_outputs,2);
+  auto in_scaling_h  = Kokkos::create_mirror_view(m_input_scaling);
+  auto out_scaling_h = Kokkos::create_mirror_view(m_output_scaling);
+  std::vector<Real> tmp;
+  auto read_scaling = [&](const std::string& kw, const int n, decltype(in_scaling_h)& s) {
+    expect(kw);
+    tmp.resize(2*n);
+    read_values(tmp.data(),2*n);
+    for (int i=0; i<n; ++i) {
+      s(i,0) = tmp[i];
+      s(i,1) = tmp[n+i];
+      EKAT_REQUIRE_MSG (s(i,1)!=0,
+          "Error! Zero standard deviation found in ML model " + kw + ".\n");
+    }
+  };
+  read_scaling("input_scaling",m_num_inputs,in_scaling_h);
+  read_scaling("output_scaling",m_num_outputs,out_scaling_h);
+  Kokkos::deep_copy(m_input_scaling,in_scaling_h);
+  Kokkos::deep_copy(m_output_scaling,out_scaling_h);
+
+  expect("layers");
+  const int nlayers = read_int("number of layers");
+  m_layers = view_2d<int>("mlp_layers",nlayers,layer_info_size);
+  m_layers_h = Kokkos::create_mirror_view(m_layers);
+
+  std::vector<Real> params;
+  m_max_width = m_num_inputs;
+  int prev_nout = m_num_inputs;
+  for (int l=0; l<nlayers; ++l) {
+    expect("layer");
+    const int nin  = read_int("input size of layer " + std::to_string(l));
+    const int nout = read_int("output size of layer " + std::to_string(l));
+    is >> token;
+    int act;
+    if (token=="linear") {
+      act = Linear;
+    } else if (token=="relu") {
+      act = ReLU;
+    } else if (token=="tanh") {
+      act = Tanh;
+    } else {
+      EKAT_ERROR_MSG ("Error! Unsupported activation function in ML model weights file.\n"
+                      "  - activation: " + token + "\n"
+                      "  - supported : linear, relu, tanh\n");
+    }
+    EKAT_REQUIRE_MSG (nin==prev_nout,
+        "Error! Mismatching sizes between consecutive layers in ML model weights file.\n"
+        "  - layer: " + std::to_string(l) + "\n"
+        "  - expected input size: " + std::to_string(prev_nout) + "\n"
+        "  - actual input size  : " + std::to_string(nin) + "\n");
+
+    m_layers_h(l,0) = nin;
+    m_layers_h(l,1) = nout;
+    m_layers_h(l,2) = act;
+    m_layers_h(l,3) = params.size();
+    m_layers_h(l,4) = params.size() + nout*nin;
+    params.resize(params.size()+nout*nin+nout);
+    read_values(params.data()+m_layers_h(l,3),nout*nin+nout);
+
+    m_max_width = std::max(m_max_width,nout);
+    prev_nout = nout;
+  }
+  EKAT_REQUIRE_MSG (prev_nout==m_num_outputs,
+      "Error! Last layer size does not match the number of outputs in ML model weights file.\n"
+      "  - last layer size  : " + std::to_string(prev_nout) + "\n"
+      "  - number of outputs: " + std::to_string(m_num_outputs) + "\n");
+  is >> token;
+  EKAT_REQUIRE_MSG (not is,
+      "Error! Unexpected trailing content in ML model weights file.\n"
+      "  - token: " + token + "\n");
+
+  Kokkos::deep_copy(m_layers,m_layers_h);
+  m_params = view_1d<Real>("mlp_params",params.size());
+  auto params_h = Kokkos::create_mirror_view(m_params);
+  std::copy(params.begin(),params.end(),params_h.data());
+  Kokkos::deep_copy(m_params,params_h);
+}
+
+void MLCorrectionMLP::
+predict (const view_2d<const Real>& x, const view_2d<Real>& y)
+{
+  using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const int ncols = x.extent(0);
+  EKAT_REQUIRE_MSG (y.extent_int(0)==ncols,
+      "Error! Input and output views have different number of columns.\n");
+  EKAT_REQUIRE_MSG (x.extent_int(1)>=m_num_inputs and y.extent_int(1)>=m_num_outputs,
+      "Error! Input/output views are too small for this ML model.\n");
+
+  if (m_work.extent_int(0)<ncols) {
+    m_work = view_2d<Real>("mlp_work",ncols,2*m_max_width);
+  }
+
+  const int nin     = m_num_inputs;
+  const int nout    = m_num_outputs;
+  const int nlayers = num_layers();
+  const int width   = m_max_width;
+  const auto layers = m_layers;
+  const auto params = m_params;
+  const auto in_s   = m_input_scaling;
+  const auto out_s  = m_output_scaling;
+  const auto work   = m_work;
+
+  const auto policy = ESU::get_default_team_policy(ncols,width);
+  Kokkos::parallel_for("MLCorrectionMLP::predict", policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+
+    auto buf_a = Kokkos::subview(work,icol,Kokkos::make_pair(0,width));
+    auto buf_b = Kokkos::subview(work,icol,Kokkos::make_pair(width,2*width));
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nin),[&](const int i) {
+      buf_a(i) = (x(icol,i)-in_s(i,0)) / in_s(i,1);
+    });
+    team.team_barrier();
+
+    for (int l=0; l<nlayers; ++l) {
+      const auto& src = l%2==0 ? buf_a : buf_b;
+      const auto& tgt = l%2==0 ? buf_b : buf_a;
+      const int lnin = layers(l,0);
+      const int lnout = layers(l,1);
+      const int act = layers(l,2);
+      const Real* W = params.data() + layers(l,3);
+      const Real* b = params.data() + layers(l,4);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,lnout),[&](const int o) {
+        Real dot = 0;
+        Kokkos::parallel_reduce(Kokkos::ThreadVectorRange(team,lnin),
+                                [&](const int i, Real& sum) {
+          sum += W[o*lnin+i]*src(i);
+        },dot);
+        Kokkos::single(Kokkos::PerThread(team),[&] {
+          tgt(o) = activate(act,dot+b[o]);
+        });
+      });
+      team.team_barrier();
+    }
+
+    const auto& last = nlayers%2==0 ? buf_a : buf_b;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nout),[&](const int o) {
+      y(icol,o) = last(o)*out_s(o,1) + out_s(o,0);
+    });
+  });
+}
+
+} // namespace scream
@@ -0,0 +1,115 @@
+#ifndef SCREAM_ML_CORRECTION_MLP_HPP
+#define SCREAM_ML_CORRECTION_MLP_HPP
+
+#include "share/scream_types.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/kokkos/ekat_kokkos_types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A small dense neural network (multi-layer perceptron) evaluated column-wise
+ * on device. This is the C++ counterpart of the python ML models used by
+ * MLCorrection: each column is treated as one sample, whose input vector is the
+ * concatenation of the model input variables, and whose output vector is the
+ * concatenation of the model output variables.
+ *
+ * The weights are read from an ascii file, exported from the trained model.
+ * The file is a whitespace-separated sequence of tokens ('#' starts a comment,
+ * which extends to the end of the line), with the following structure:
+ *
+ *   inputs  <n> <name_1>:<size_1> ... <name_n>:<size_n>    (all sizes positive)
+ *   outputs <n> <name_1>:<size_1> ... <name_n>:<size_n>
+ *   input_scaling   <mean values> <std values>
+ *   output_scaling  <mean values> <std values>
+ *   layers <num_layers>
+ *   layer <nin> <nout> <linear|relu|tanh>
+ *     <nout*nin weights, stored by row, that is W(out,in)>
+ *     <nout biases>
+ *   ...
+ *
+ * Inputs are normalized as (x-mean)/std before the first layer, while outputs
+ * are de-normalized as y*std+mean after the last layer. The file is read on the
+ * root rank only, and broadcast to all other ranks.
+ */
+
+class MLCorrectionMLP {
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+  using MemberType = typename KT::MemberType;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  enum Activation : int {
+    Linear = 0,
+    ReLU   = 1,
+    Tanh   = 2
+  };
+
+  // A (named) chunk of the input/output vectors
+  struct Variable {
+    std::string name;
+    int offset;
+    int size;
+  };
+
+  MLCorrectionMLP (const ekat::Comm& comm, const std::string& filename);
+
+  int num_inputs  () const { return m_num_inputs;  }
+  int num_outputs () const { return m_num_outputs; }
+  int num_layers  () const { return m_layers_h.extent(0); }
+
+  const std::vector<Variable>& inputs  () const { return m_inputs;  }
+  const std::vector<Variable>& outputs () const { return m_outputs; }
+
+  // Evaluate the network on each column (i.e., each row of x and y).
+  //   x: (ncols,num_inputs), the input features
+  //   y: (ncols,num_outputs), the predictions
+  void predict (const view_2d<const Real>& x, const view_2d<Real>& y);
+
+  KOKKOS_INLINE_FUNCTION
+  static Real activate (const int act, const Real v) {
+    switch (act) {
+      case ReLU: return v>0 ? v : 0;
+      case Tanh: return Kokkos::tanh(v);
+      default:   return v;
+    }
+  }
+
+protected:
+
+  void parse (const std::string& contents);
+
+  int m_num_inputs  = 0;
+  int m_num_outputs = 0;
+  int m_max_width   = 0;
+
+  std::vector<Variable> m_inputs;
+  std::vector<Variable> m_outputs;
+
+  // For each layer: nin, nout, activation, offset of weights, offset of bias
+  static constexpr int layer_info_size = 5;
+  view_2d<int>                        m_layers;
+  typename view_2d<int>::HostMirror   m_layers_h;
+
+  // Weights and biases of all layers, stored contiguously
+  view_1d<Real>  m_params;
+
+  // Normalization coefficients, stored as (mean,std) pairs
+  view_2d<Real>  m_input_scaling;
+  view_2d<Real>  m_output_scaling;
+
+  // Scratch space for hidden layers, sized as (ncols,2*max_width)
+  view_2d<Real>  m_work;
+};
+
+} // namespace scream
+
+#endif // SCREAM_ML_CORRECTION_MLP_HPP
@@ -0,0 +1,160 @@
+#include <catch2/catch.hpp>
+
+#include "physics/ml_correction/ml_correction_mlp.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <random>
+
+namespace scream {
+
+TEST_CASE("ml_correction_mlp")
+{
+  using MLP = MLCorrectionMLP;
+  using view_2d = MLP::view_2d<Real>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Same seed on all ranks, since weights are only written by root
+  std::mt19937_64 engine(1234);
+  std::uniform_real_distribution<Real> pdf(-1,1);
+
+  // A network with 5 inputs (a 4-level profile plus a scalar), two hidden layers, 3 outputs
+  const int nlevs = 4;
+  const int nin   = nlevs+1;
+  const int nout  = 3;
+  const std::vector<int> sizes = {nin,8,6,nout};
+  const std::vector<std::string> acts = {"relu","tanh","linear"};
+
+  std::vector<std::vector<Real>> W(acts.size()), b(acts.size());
+  std::vector<Real> in_mean(nin), in_std(nin), out_mean(nout), out_std(nout);
+  for (int i=0; i<nin; ++i) {
+    in_mean[i] = pdf(engine);
+    in_std[i]  = 1.5 + pdf(engine);
+  }
+  for (int i=0; i<nout; ++i) {
+    out_mean[i] = pdf(engine);
+    out_std[i]  = 1.5 + pdf(engine);
+  }
+
+  const std::string fname = "mlp_weights_np" + std::to_string(comm.size()) + ".txt";
+  if (comm.am_i_root()) {
+    std::ofstream ofile(fname);
+    ofile.precision(17);
+    ofile << "# Test model\n";
+    ofile << "inputs 2 T_mid:" << nlevs << " lat:1\n";
+    ofile << "outputs 2 dQ1:2 net_shortwave_sfc_flux_via_transmissivity:1\n";
+    ofile << "input_scaling\n";
+    for (auto m : in_mean) ofile << m << " ";
+    for (auto s : in_std)  ofile << s << " ";
+    ofile << "\noutput_scaling\n";
+    for (auto m : out_mean) ofile << m << " ";
+    for (auto s : out_std)  ofile << s << " ";
+    ofile << "\nlayers " << acts.size() << "\n";
+  }
+  for (size_t l=0; l<acts.size(); ++l) {
+    W[l].resize(sizes[l]*sizes[l+1]);
+    b[l].resize(sizes[l+1]);
+    for (auto& w : W[l]) w = pdf(engine);
+    for (auto& v : b[l]) v = pdf(engine);
+    if (comm.am_i_root()) {
+      std::ofstream ofile(fname,std::ios_base::app);
+      ofile.precision(17);
+      ofile << "layer " << sizes[l] << " " << sizes[l+1] << " " << acts[l] << "\n";
+      for (auto w : W[l]) ofile << w << " ";
+      ofile << "\n";
+      for (auto v : b[l]) ofile << v << " ";
+      ofile << "  # bias\n";
+    }
+  }
+  comm.barrier();
+
+  MLP mlp(comm,fname);
+  REQUIRE (mlp.num_inputs()==nin);
+  REQUIRE (mlp.num_outputs()==nout);
+  REQUIRE (mlp.num_layers()==3);
+  REQUIRE (mlp.inputs().size()==2);
+  REQUIRE (mlp.inputs()[1].name=="lat");
+  REQUIRE (mlp.inputs()[1].offset==nlevs);
+  REQUIRE (mlp.outputs()[1].offset==2);
+
+  const int ncols = 10;
+  view_2d x("x",ncols,nin), y("y",ncols,nout);
+  auto x_h = Kokkos::create_mirror_view(x);
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int i=0; i<nin; ++i) {
+      x_h(icol,i) = 10*pdf(engine);
+    }
+  }
+  Kokkos::deep_copy(x,x_h);
+
+  mlp.predict(x,y);
+  auto y_h = Kokkos::create_mirror_view(y);
+  Kokkos::deep_copy(y_h,y);
+
+  // Compare against a serial evaluation of the network
+  const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+  for (int icol=0; icol<ncols; ++icol) {
+    std::vector<Real> a(nin);
+    for (int i=0; i<nin; ++i) {
+      a[i] = (x_h(icol,i)-in_mean[i]) / in_std[i];
+    }
+    for (size_t l=0; l<acts.size(); ++l) {
+      std::vector<Real> z(sizes[l+1]);
+      for (int o=0; o<sizes[l+1]; ++o) {
+        Real dot = 0;
+        for (int i=0; i<sizes[l]; ++i) {
+          dot += W[l][o*sizes[l]+i]*a[i];
+        }
+        dot += b[l][o];
+        z[o] = acts[l]=="relu" ? std::max(dot,Real(0))
+             : acts[l]=="tanh" ? std::tanh(dot) : dot;
+      }
+      a = z;
+    }
+    for (int o=0; o<nout; ++o) {
+      const Real expected = a[o]*out_std[o] + out_mean[o];
+      REQUIRE (y_h(icol,o)==Approx(expected).epsilon(tol));
+    }
+  }
+}
+
+TEST_CASE("ml_correction_mlp_parsing")
+{
+  using MLP = MLCorrectionMLP;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A single linear layer, preceded by the given input/output specs
+  const std::string fname = "mlp_parsing_np" + std::to_string(comm.size()) + ".txt";
+  auto write = [&](const std::string& inputs, const int layer_nin) {
+    if (comm.am_i_root()) {
+      std::ofstream ofile(fname);
+      ofile << "  # An indented comment line\n"
+            << inputs << "\n"
+            << "outputs 1 y:1 # trailing comment\n"
+            << "input_scaling 0 0 1 1\n"
+            << "output_scaling 0 1\n"
+            << "layers 1\n"
+            << "layer " << layer_nin << " 1 linear\n"
+            << "1 2 0.5\n";
+    }
+    comm.barrier();
+  };
+
+  write("inputs 2 a:1 b:1",2);
+  MLP mlp(comm,fname);
+  REQUIRE (mlp.num_inputs()==2);
+  REQUIRE (mlp.num_outputs()==1);
+
+  // Variable and layer sizes must be positive integers
+  for (const std::string& bad : {"inputs 2 a:0 b:2", "inputs 2 a:-1 b:3", "inputs 2 a:x b:2", "inputs 2 a:1.5 b:1"}) {
+    write(bad,2);
+    REQUIRE_THROWS (MLP(comm,fname));
+  }
+  write("inputs 2 a:1 b:1",0);
+  REQUIRE_THROWS (MLP(comm,fname));
+}
+
+} // namespace scream
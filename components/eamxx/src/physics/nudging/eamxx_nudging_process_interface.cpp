@@ -196,7 +196,7 @@ void Nudging::apply_tendency(Field& state, const Field& nudge, const Real dt) co
     }
     state_view(i,j) += dtend * tend;
   };
-  Kokkos::parallel_for(policy,update);
+  Kokkos::parallel_for("Nudging::apply_tendency", policy,update);
 }
 // =============================================================================================================
 void Nudging::initialize_impl (const RunType /* run_type */)
@@ -382,7 +382,7 @@ void Nudging::run_impl (const double dt)
       }
     };
 
-    Kokkos::parallel_for(RangePolicy(0,ncols),lambda);
+    Kokkos::parallel_for("Nudging::run_impl::correct_masked_values", RangePolicy(0,ncols),lambda);
   };
 
   // Correct before horiz remap
@@ -464,7 +464,7 @@ void Nudging::run_impl (const double dt)
         to_v(lev+2) = to_v(lev+1);
       }
     };
-    Kokkos::parallel_for(RangePolicy(0,nlevs_src),lambda);
+    Kokkos::parallel_for("Nudging::run_impl::pad_p_mid", RangePolicy(0,nlevs_src),lambda);
   }
   const auto& p_mid_v = get_field_in("p_mid").get_view<const PackT**>();
   view_2d p_mid_tmp_3d;
@@ -31,7 +31,9 @@ void Functions<Real,DefaultDevice>
     const uview_2d<Spack>& nc_tend,
     const uview_1d<Scalar>& precip_liq_surf,
     const uview_1d<bool>& nucleationPossible,
-    const uview_1d<bool>& hydrometeorsPresent)
+    const uview_1d<bool>& hydrometeorsPresent,
+    const uview_1d<const Int>& active_cols,
+    const bool& do_semi_lagrangian_sed)
 {
   using ExeSpace = typename KT::ExeSpace;
   const Int nk_pack = ekat::npack<Spack>(nk);
@@ -41,7 +43,7 @@ void Functions<Real,DefaultDevice>
     "p3_cloud_sedimentation",
     policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     auto workspace = workspace_mgr.get_workspace(team);
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
@@ -53,11 +55,77 @@ void Functions<Real,DefaultDevice>
       nk, ktop, kbot, kdir, dt, inv_dt, do_predict_nc,
       ekat::subview(qc, i), ekat::subview(nc, i), ekat::subview(nc_incld, i), ekat::subview(mu_c, i), ekat::subview(lamc, i), ekat::subview(qc_tend, i),
       ekat::subview(nc_tend, i),
-      precip_liq_surf(i));
+      precip_liq_surf(i), do_semi_lagrangian_sed);
   });
 
 }
 
+template <>
+void Functions<Real,DefaultDevice>
+::cloud_sedimentation_substeps_disp(
+    const uview_2d<const Spack>& qc,
+    const uview_2d<const Spack>& qc_incld,
+    const uview_2d<const Spack>& nc_incld,
+    const uview_2d<const Spack>& rho,
+    const uview_2d<const Spack>& acn,
+    const uview_2d<const Spack>& inv_dz,
+    const view_dnu_table& dnu,
+    const Int& nj, const Int& nk, const Int& ktop, const Int& kbot, const Int& kdir, const Scalar& dt,
+    const uview_1d<const Int>& cols,
+    const uview_1d<Int>& nsubsteps)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  constexpr Scalar qsmall = C::QSMALL;
+  constexpr Scalar bcn    = C::bcn;
+  const Int nk_pack = ekat::npack<Spack>(nk);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+  Kokkos::parallel_for(
+    "p3_cloud_sedimentation_substeps",
+    policy, KOKKOS_LAMBDA(const MemberType& team) {
+
+    const Int ii = team.league_rank();
+    const Int i = cols(ii);
+
+    // Same as the first iteration of the CFL loop in cloud_sedimentation,
+    // but the DSD parameters are updated in local copies only
+    bool log_qxpresent;
+    const auto sqc = ekat::scalarize(ekat::subview(qc, i));
+    const Int k_qxtop = find_top(team, sqc, qsmall, kbot, ktop, kdir, log_qxpresent);
+    Scalar Co_max = 0;
+    if (log_qxpresent) {
+      const Int k_qxbot = find_bottom(team, sqc, qsmall, kbot, k_qxtop, kdir, log_qxpresent);
+      const Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
+      const Int kmax_scalar = ( kdir == 1 ? k_qxtop : k_qxbot);
+      Int kmin, kmax;
+      ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
+
+      Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
+          const int pk = kmin + pk_;
+          const auto range_pack = ekat::range<IntSmallPack>(pk*Spack::n);
+          const auto range_mask = range_pack >= kmin_scalar && range_pack <= kmax_scalar;
+          const auto qc_gt_small = range_mask && qc_incld(i,pk) > qsmall;
+          Spack V_qc(0);
+          if (qc_gt_small.any()) {
+            Spack nc_loc = nc_incld(i,pk), mu_c(0), lamc(0), nu, cdist, cdist1;
+            get_cloud_dsd2(qc_incld(i,pk), nc_loc, mu_c, rho(i,pk), nu, dnu, lamc, cdist, cdist1, qc_gt_small);
+            const Spack dum = 1 / pow(lamc, bcn);
+            V_qc.set(qc_gt_small, acn(i,pk)*tgamma(4 + bcn + mu_c) * dum / tgamma(mu_c+4));
+          }
+          const auto Co_max_local = max(qc_gt_small, 0, V_qc * dt * inv_dz(i,pk));
+          if (Co_max_local > lmax)
+            lmax = Co_max_local;
+      }, Kokkos::Max<Scalar>(Co_max));
+    }
+
+    Kokkos::single(
+      Kokkos::PerTeam(team), [&] () {
+        // Cap the estimate, which also takes care of a NaN Co_max
+        nsubsteps(ii) = not log_qxpresent ? 0 : (Co_max < nk ? static_cast<Int>(Co_max + 1) : nk);
+      });
+  });
+}
+
 } // namespace p3
 } // namespace scream
 
@@ -29,7 +29,9 @@ void Functions<Real,DefaultDevice>
   const uview_1d<Scalar>& precip_ice_surf,
   const uview_1d<bool>& nucleationPossible,
   const uview_1d<bool>& hydrometeorsPresent,
-  const physics::P3_Constants<Real> & p3constants)
+  const uview_1d<const Int>& active_cols,
+  const physics::P3_Constants<Real> & p3constants,
+  const bool& do_semi_lagrangian_sed)
 {
   using ExeSpace = typename KT::ExeSpace;
   const Int nk_pack = ekat::npack<Spack>(nk);
@@ -38,7 +40,7 @@ void Functions<Real,DefaultDevice>
   Kokkos::parallel_for("p3_ice_sedimentation",
     policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
     }
@@ -50,11 +52,82 @@ void Functions<Real,DefaultDevice>
       ekat::subview(inv_dz, i), team, workspace, nk, ktop, kbot, kdir, dt, inv_dt, 
       ekat::subview(qi, i), ekat::subview(qi_incld, i), ekat::subview(ni, i), ekat::subview(ni_incld, i),
       ekat::subview(qm, i), ekat::subview(qm_incld, i), ekat::subview(bm, i), ekat::subview(bm_incld, i), ekat::subview(qi_tend, i), ekat::subview(ni_tend, i),
-      ice_table_vals, precip_ice_surf(i), p3constants);
+      ice_table_vals, precip_ice_surf(i), p3constants, do_semi_lagrangian_sed);
 
  });
 }
 
+template <>
+void Functions<Real,DefaultDevice>
+::ice_sedimentation_substeps_disp(
+  const uview_2d<const Spack>& qi,
+  const uview_2d<const Spack>& qi_incld,
+  const uview_2d<const Spack>& ni_incld,
+  const uview_2d<const Spack>& qm_incld,
+  const uview_2d<const Spack>& bm_incld,
+  const uview_2d<const Spack>& rhofaci,
+  const uview_2d<const Spack>& inv_dz,
+  const view_ice_table& ice_table_vals,
+  const Int& nj, const Int& nk, const Int& ktop, const Int& kbot, const Int& kdir, const Scalar& dt,
+  const uview_1d<const Int>& cols,
+  const uview_1d<Int>& nsubsteps,
+  const physics::P3_Constants<Real> & p3constants)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  constexpr Scalar qsmall = C::QSMALL;
+  constexpr Scalar nsmall = C::NSMALL;
+  const Scalar p3_ice_sed_knob = p3constants.p3_ice_sed_knob;
+  const Int nk_pack = ekat::npack<Spack>(nk);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+  Kokkos::parallel_for("p3_ice_sedimentation_substeps",
+    policy, KOKKOS_LAMBDA(const MemberType& team) {
+
+    const Int ii = team.league_rank();
+    const Int i = cols(ii);
+
+    // Same as the first iteration of the CFL loop in ice_sedimentation,
+    // but the ice properties are updated in local copies only
+    bool log_qxpresent;
+    const auto sqi = ekat::scalarize(ekat::subview(qi, i));
+    const Int k_qxtop = find_top(team, sqi, qsmall, kbot, ktop, kdir, log_qxpresent);
+    Scalar Co_max = 0;
+    if (log_qxpresent) {
+      const Int k_qxbot = find_bottom(team, sqi, qsmall, kbot, k_qxtop, kdir, log_qxpresent);
+      const Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
+      const Int kmax_scalar = ( kdir == 1 ? k_qxtop : k_qxbot);
+      Int kmin, kmax;
+      ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
+
+      Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
+        const int pk = kmin + pk_;
+        const auto range_pack = ekat::range<IntSmallPack>(pk*Spack::n);
+        const auto range_mask = range_pack >= kmin_scalar && range_pack <= kmax_scalar;
+        const auto qi_gt_small = range_mask && qi_incld(i,pk) > qsmall;
+        Spack V_qit(0);
+        if (qi_gt_small.any()) {
+          Spack ni_loc = ni_incld(i,pk), qm_loc = qm_incld(i,pk), bm_loc = bm_incld(i,pk);
+          ni_loc.set(qi_gt_small, max(ni_loc, nsmall));
+          const auto rhop = calc_bulk_rho_rime(qi_incld(i,pk), qm_loc, bm_loc, p3constants, qi_gt_small);
+
+          TableIce tab;
+          lookup_ice(qi_incld(i,pk), ni_loc, qm_loc, rhop, tab, qi_gt_small);
+          const auto table_val_qi_fallspd = apply_table_ice(1, ice_table_vals, tab, qi_gt_small);
+          V_qit.set(qi_gt_small, p3_ice_sed_knob * table_val_qi_fallspd * rhofaci(i,pk));
+        }
+        const auto Co_max_local = max(qi_gt_small, 0, V_qit * dt * inv_dz(i,pk));
+        if (Co_max_local > lmax) lmax = Co_max_local;
+      }, Kokkos::Max<Scalar>(Co_max));
+    }
+
+    Kokkos::single(
+      Kokkos::PerTeam(team), [&] () {
+        // Cap the estimate, which also takes care of a NaN Co_max
+        nsubsteps(ii) = not log_qxpresent ? 0 : (Co_max < nk ? static_cast<Int>(Co_max + 1) : nk);
+      });
+  });
+}
+
 template <>
 void Functions<Real,DefaultDevice>
 ::homogeneous_freezing_disp(
@@ -72,7 +145,8 @@ void Functions<Real,DefaultDevice>
   const uview_2d<Spack>& bm,
   const uview_2d<Spack>& th_atm,
   const uview_1d<bool>& nucleationPossible,
-  const uview_1d<bool>& hydrometeorsPresent)
+  const uview_1d<bool>& hydrometeorsPresent,
+  const uview_1d<const Int>& active_cols)
 {
   using ExeSpace = typename KT::ExeSpace;
   const Int nk_pack = ekat::npack<Spack>(nk);
@@ -82,7 +156,7 @@ void Functions<Real,DefaultDevice>
     "p3_homogeneous",
     policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
     }
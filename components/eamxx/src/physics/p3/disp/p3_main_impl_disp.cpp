@@ -97,6 +97,59 @@ void Functions<Real,DefaultDevice>
  });
 }
 
+template <>
+void Functions<Real,DefaultDevice>
+::bin_columns_by_substeps_disp(
+  const uview_1d<const Int>& cols,
+  const uview_1d<const Int>& nsubsteps,
+  const Int& max_bins,
+  const uview_1d<Int>& bin_offset,
+  const uview_1d<Int>& binned_cols)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using RangePolicy = Kokkos::RangePolicy<ExeSpace>;
+
+  EKAT_REQUIRE_MSG (bin_offset.extent_int(0) > max_bins,
+      "Error! bin_offset is too small for the number of substeps bins.\n");
+
+  const Int ncols = cols.extent(0);
+  if (ncols==0) {
+    return;
+  }
+
+  Int max_substeps;
+  Kokkos::parallel_reduce("p3_sed_max_substeps", RangePolicy(0, ncols),
+      KOKKOS_LAMBDA (const Int ii, Int& lmax) {
+    if (nsubsteps(ii) > lmax) lmax = nsubsteps(ii);
+  }, Kokkos::Max<Int>(max_substeps));
+  const Int nbins = max_substeps < max_bins ? max_substeps : max_bins;
+
+  // Counting sort, with one bin per number of substeps. Bin b holds the
+  // columns with nbins-b substeps, so that bins are in decreasing order;
+  // columns with more than nbins substeps go in bin 0 as well.
+  const auto offsets = Kokkos::subview(bin_offset, Kokkos::make_pair(0, nbins+1));
+  Kokkos::deep_copy(offsets, 0);
+  Kokkos::parallel_for("p3_sed_bin_count", RangePolicy(0, ncols),
+      KOKKOS_LAMBDA (const Int ii) {
+    const Int b = nsubsteps(ii) < nbins ? nbins-nsubsteps(ii) : 0;
+    Kokkos::atomic_increment(&offsets(b));
+  });
+  Kokkos::parallel_scan("p3_sed_bin_offsets", RangePolicy(0, nbins+1),
+      KOKKOS_LAMBDA (const Int b, Int& offset, const bool final) {
+    const Int count = offsets(b);
+    if (final) {
+      offsets(b) = offset;
+    }
+    offset += count;
+  });
+  Kokkos::parallel_for("p3_sed_bin_columns", RangePolicy(0, ncols),
+      KOKKOS_LAMBDA (const Int ii) {
+    const Int b = nsubsteps(ii) < nbins ? nbins-nsubsteps(ii) : 0;
+    const Int pos = Kokkos::atomic_fetch_add(&offsets(b), 1);
+    binned_cols(pos) = cols(ii);
+  });
+}
+
 template <>
 Int Functions<Real,DefaultDevice>
 ::p3_main_internal_disp(
@@ -235,11 +288,39 @@ Int Functions<Real,DefaultDevice>
       bm, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld, nr_incld,
       ni_incld, bm_incld, nucleationPossible, hydrometeorsPresent, p3constants);
 
+  // Build the list of active columns, that is, columns where nucleation is possible
+  // or hydrometeors are present. All the remaining kernels skip the other columns,
+  // so we only launch teams for the active ones, rather than having idle teams
+  // occupying the device. Part2 only runs over these columns, so it cannot activate
+  // any other column, and the list does not need to be rebuilt later on.
+  // Each kernel still checks the per-column bools, so results are unchanged.
+  // The lists of columns live in the (persistent) scratch provided by the caller, if any.
+  view_1d<Int> col_scratch = infrastructure.col_scratch;
+  if (col_scratch.extent_int(0) < col_scratch_size(nj, nk)) {
+    EKAT_REQUIRE_MSG (col_scratch.size()==0,
+        "Error! P3Infrastructure::col_scratch is too small.\n"
+        "  - size    : " + std::to_string(col_scratch.size()) + "\n"
+        "  - expected: " + std::to_string(col_scratch_size(nj, nk)) + "\n");
+    col_scratch = view_1d<Int>("col_scratch", col_scratch_size(nj, nk));
+  }
+  const uview_1d<Int> active_cols_storage(col_scratch.data(), nj);
+  Int nactive = 0;
+  Kokkos::parallel_scan("p3_active_columns", Kokkos::RangePolicy<ExeSpace>(0, nj),
+      KOKKOS_LAMBDA (const Int i, Int& offset, const bool final) {
+    if (nucleationPossible(i) || hydrometeorsPresent(i)) {
+      if (final) {
+        active_cols_storage(offset) = i;
+      }
+      ++offset;
+    }
+  }, nactive);
+  const uview_1d<const Int> active_cols(active_cols_storage.data(), nactive);
+
   // ------------------------------------------------------------------------------------------
   // main k-loop (for processes):
 
   p3_main_part2_disp(
-      nj, nk, runtime_options.max_total_ni, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt, inv_dt,
+      nactive, nk, runtime_options.max_total_ni, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt, inv_dt,
       lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, 
       lookup_tables.revap_table_vals, pres, dpres, dz, nc_nuceat_tend, inv_exner,
       exner, inv_cld_frac_l, inv_cld_frac_i, inv_cld_frac_r, ni_activated, inv_qc_relvar, cld_frac_i,
@@ -249,7 +330,7 @@ Int Functions<Real,DefaultDevice>
       nr_incld, ni_incld, bm_incld, mu_c, nu, lamc, cdist, cdist1, cdistr,
       mu_r, lamr, logn0r, qv2qi_depos_tend, precip_total_tend, nevapr, qr_evap_tend,
       vap_liq_exchange, vap_ice_exchange, liq_ice_exchange,
-      pratot, prctot, nucleationPossible, hydrometeorsPresent, p3constants);
+      pratot, prctot, nucleationPossible, hydrometeorsPresent, active_cols, p3constants);
 
   //NOTE: At this point, it is possible to have negative (but small) nc, nr, ni.  This is not
   //      a problem; those values get clipped to zero in the sedimentation section (if necessary).
@@ -262,44 +343,75 @@ Int Functions<Real,DefaultDevice>
   // ==========================================================================================!
   // Sedimentation:
 
+  // The number of CFL substeps can vary a lot from column to column (e.g., convective
+  // cores vs stratiform regions). To avoid having teams with very different amounts
+  // of work in the same launch, each sedimentation kernel runs over the active columns
+  // binned by (estimated) number of substeps, with the most expensive columns first.
+  // The estimates replay the upwind CFL loop, which does not model the cost of the
+  // semi-Lagrangian remap, so columns are not binned with that scheme.
+  // The bins are capped at nk, which is also the cap of the substeps estimates.
+  const bool sl_sed = runtime_options.do_semi_lagrangian_sed;
+  const uview_1d<Int> sed_nsubsteps(col_scratch.data() + nj, nactive);
+  const uview_1d<Int> sed_cols(col_scratch.data() + 2*nj, nactive);
+  const uview_1d<Int> sed_bin_offset(col_scratch.data() + 3*nj, nk+1);
+  const uview_1d<const Int> sed_cols_c = sl_sed ? active_cols : uview_1d<const Int>(sed_cols.data(), nactive);
+
   // Cloud sedimentation:  (adaptive substepping)
+  if (not sl_sed) {
+    cloud_sedimentation_substeps_disp(
+        qc, qc_incld, nc_incld, rho, acn, inv_dz, lookup_tables.dnu_table_vals,
+        nactive, nk, ktop, kbot, kdir, infrastructure.dt, active_cols, sed_nsubsteps);
+    bin_columns_by_substeps_disp(active_cols, sed_nsubsteps, nk, sed_bin_offset, sed_cols);
+  }
   cloud_sedimentation_disp(
       qc_incld, rho, inv_rho, cld_frac_l, acn, inv_dz, lookup_tables.dnu_table_vals, workspace_mgr,
-      nj, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
+      nactive, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
       qc, nc, nc_incld, mu_c, lamc, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf, nucleationPossible, hydrometeorsPresent);
+      diagnostic_outputs.precip_liq_surf, nucleationPossible, hydrometeorsPresent, sed_cols_c, sl_sed);
 
 
   // Rain sedimentation:  (adaptive substepping)
+  if (not sl_sed) {
+    rain_sedimentation_substeps_disp(
+        qr, qr_incld, nr_incld, rhofacr, inv_dz, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
+        nactive, nk, ktop, kbot, kdir, infrastructure.dt, active_cols, sed_nsubsteps, p3constants);
+    bin_columns_by_substeps_disp(active_cols, sed_nsubsteps, nk, sed_bin_offset, sed_cols);
+  }
   rain_sedimentation_disp(
       rho, inv_rho, rhofacr, cld_frac_r, inv_dz, qr_incld, workspace_mgr,
-      lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, nj, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, qr,
+      lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, nactive, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, qr,
       nr, nr_incld, mu_r, lamr, precip_liq_flux, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf, nucleationPossible, hydrometeorsPresent, p3constants);
+      diagnostic_outputs.precip_liq_surf, nucleationPossible, hydrometeorsPresent, sed_cols_c, p3constants, sl_sed);
 
   // Ice sedimentation:  (adaptive substepping)
+  if (not sl_sed) {
+    ice_sedimentation_substeps_disp(
+        qi, qi_incld, ni_incld, qm_incld, bm_incld, rhofaci, inv_dz, lookup_tables.ice_table_vals,
+        nactive, nk, ktop, kbot, kdir, infrastructure.dt, active_cols, sed_nsubsteps, p3constants);
+    bin_columns_by_substeps_disp(active_cols, sed_nsubsteps, nk, sed_bin_offset, sed_cols);
+  }
   ice_sedimentation_disp(
-      rho, inv_rho, rhofaci, cld_frac_i, inv_dz, workspace_mgr, nj, nk, ktop, kbot,
+      rho, inv_rho, rhofaci, cld_frac_i, inv_dz, workspace_mgr, nactive, nk, ktop, kbot,
       kdir, infrastructure.dt, inv_dt, qi, qi_incld, ni, ni_incld,
       qm, qm_incld, bm, bm_incld, qtend_ignore, ntend_ignore,
-      lookup_tables.ice_table_vals, diagnostic_outputs.precip_ice_surf, nucleationPossible, hydrometeorsPresent, p3constants);
+      lookup_tables.ice_table_vals, diagnostic_outputs.precip_ice_surf, nucleationPossible, hydrometeorsPresent, sed_cols_c, p3constants, sl_sed);
 
   // homogeneous freezing f cloud and rain
   homogeneous_freezing_disp(
-      T_atm, inv_exner, latent_heat_fusion, nj, nk, ktop, kbot, kdir, qc, nc, qr, nr, qi,
-      ni, qm, bm, th, nucleationPossible, hydrometeorsPresent);
+      T_atm, inv_exner, latent_heat_fusion, nactive, nk, ktop, kbot, kdir, qc, nc, qr, nr, qi,
+      ni, qm, bm, th, nucleationPossible, hydrometeorsPresent, active_cols);
 
   //
   // final checks to ensure consistency of mass/number
   // and compute diagnostic fields for output
   //
   p3_main_part3_disp(
-      nj, nk_pack, runtime_options.max_total_ni, lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, inv_exner, cld_frac_l, cld_frac_r, cld_frac_i,
+      nactive, nk_pack, runtime_options.max_total_ni, lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, inv_exner, cld_frac_l, cld_frac_r, cld_frac_i,
       rho, inv_rho, rhofaci, qv, th, qc, nc, qr, nr, qi, ni,
       qm, bm, latent_heat_vapor, latent_heat_sublim, mu_c, nu, lamc, mu_r, lamr,
       vap_liq_exchange, ze_rain, ze_ice, diag_vm_qi, diag_eff_radius_qi, diag_diam_qi,
       rho_qi, diag_equiv_reflectivity, diag_eff_radius_qc, diag_eff_radius_qr, nucleationPossible, hydrometeorsPresent,
-      p3constants);
+      active_cols, p3constants);
 
   //
   // merge ice categories with similar properties
@@ -310,7 +422,7 @@ Int Functions<Real,DefaultDevice>
   // PMC nCat deleted nCat>1 stuff
 
 #ifndef NDEBUG
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("p3::p3_main_internal_disp",
       Kokkos::MDRangePolicy<ExeSpace, Kokkos::Rank<2>>({0, 0}, {nj, nk_pack}), KOKKOS_LAMBDA (int i, int k) {
       tmparr2(i,k) = th(i,k) * exner(i,k);
   });
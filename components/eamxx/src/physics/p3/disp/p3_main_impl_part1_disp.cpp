@@ -4,6 +4,7 @@
 #include "physics/share/physics_saturation_impl.hpp"
 
 #include "ekat/kokkos/ekat_subview_utils.hpp"
+#include "share/util/eamxx_team_policy_tuner.hpp"
 
 namespace scream {
 namespace p3 {
@@ -67,10 +68,9 @@ void Functions<Real,DefaultDevice>
 {
   using ExeSpace = typename KT::ExeSpace;
   const Int nk_pack = ekat::npack<Spack>(nk);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
   // p3_cloud_sedimentation loop
-  Kokkos::parallel_for("p3_main_part1",
-      policy, KOKKOS_LAMBDA(const MemberType& team) {
+  TeamPolicyTuner::instance().parallel_for<ExeSpace>("p3_main_part1",
+      nj, nk_pack, KOKKOS_LAMBDA(const MemberType& team) {
 
     const Int i = team.league_rank();
     
@@ -4,6 +4,7 @@
 #include "physics/share/physics_saturation_impl.hpp"
 
 #include "ekat/kokkos/ekat_subview_utils.hpp"
+#include "share/util/eamxx_team_policy_tuner.hpp"
 
 namespace scream {
 namespace p3 {
@@ -57,16 +58,16 @@ void Functions<Real,DefaultDevice>
   const uview_2d<Spack>& diag_eff_radius_qr,
   const uview_1d<bool>& nucleationPossible,
   const uview_1d<bool>& hydrometeorsPresent,
+  const uview_1d<const Int>& active_cols,
   const physics::P3_Constants<Real> & p3constants)
 {
   using ExeSpace = typename KT::ExeSpace;
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
   // p3_cloud_sedimentation loop
-  Kokkos::parallel_for(
+  TeamPolicyTuner::instance().parallel_for<ExeSpace>(
     "p3_main_part3_disp",
-    policy, KOKKOS_LAMBDA(const MemberType& team) {
+    nj, nk_pack, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
     }
@@ -28,7 +28,9 @@ void Functions<Real,DefaultDevice>
   const uview_1d<Scalar>& precip_liq_surf,
   const uview_1d<bool>& nucleationPossible,
   const uview_1d<bool>& hydrometeorsPresent,
-  const physics::P3_Constants<Real> & p3constants)
+  const uview_1d<const Int>& active_cols,
+  const physics::P3_Constants<Real> & p3constants,
+  const bool& do_semi_lagrangian_sed)
 {
   using ExeSpace = typename KT::ExeSpace;
   const Int nk_pack = ekat::npack<Spack>(nk);
@@ -37,7 +39,7 @@ void Functions<Real,DefaultDevice>
   Kokkos::parallel_for("p3_rain_sed_disp",
     policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     auto workspace = workspace_mgr.get_workspace(team);
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
@@ -50,9 +52,73 @@ void Functions<Real,DefaultDevice>
       team, workspace, vn_table_vals, vm_table_vals, nk, ktop, kbot, kdir, dt, inv_dt, 
       ekat::subview(qr, i), ekat::subview(nr, i), ekat::subview(nr_incld, i), ekat::subview(mu_r, i), 
       ekat::subview(lamr, i), ekat::subview(precip_liq_flux, i), 
-      ekat::subview(qr_tend, i), ekat::subview(nr_tend, i), precip_liq_surf(i), p3constants);
+      ekat::subview(qr_tend, i), ekat::subview(nr_tend, i), precip_liq_surf(i), p3constants,
+      do_semi_lagrangian_sed);
   });
 
 }
+
+template <>
+void Functions<Real,DefaultDevice>
+::rain_sedimentation_substeps_disp(
+  const uview_2d<const Spack>& qr,
+  const uview_2d<const Spack>& qr_incld,
+  const uview_2d<const Spack>& nr_incld,
+  const uview_2d<const Spack>& rhofacr,
+  const uview_2d<const Spack>& inv_dz,
+  const view_2d_table& vn_table_vals, const view_2d_table& vm_table_vals,
+  const Int& nj, const Int& nk, const Int& ktop, const Int& kbot, const Int& kdir, const Scalar& dt,
+  const uview_1d<const Int>& cols,
+  const uview_1d<Int>& nsubsteps,
+  const physics::P3_Constants<Real> & p3constants)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  constexpr Scalar qsmall = C::QSMALL;
+  const Int nk_pack = ekat::npack<Spack>(nk);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+  Kokkos::parallel_for("p3_rain_sed_substeps_disp",
+    policy, KOKKOS_LAMBDA(const MemberType& team) {
+
+    const Int ii = team.league_rank();
+    const Int i = cols(ii);
+
+    // Same as the first iteration of the CFL loop in rain_sedimentation,
+    // but the DSD parameters are updated in local copies only
+    bool log_qxpresent;
+    const auto sqr = ekat::scalarize(ekat::subview(qr, i));
+    const Int k_qxtop = find_top(team, sqr, qsmall, kbot, ktop, kdir, log_qxpresent);
+    Scalar Co_max = 0;
+    if (log_qxpresent) {
+      const Int k_qxbot = find_bottom(team, sqr, qsmall, kbot, k_qxtop, kdir, log_qxpresent);
+      const Int kmin_scalar = ( kdir == 1 ? k_qxbot : k_qxtop);
+      const Int kmax_scalar = ( kdir == 1 ? k_qxtop : k_qxbot);
+      Int kmin, kmax;
+      ekat::impl::set_min_max(k_qxbot, k_qxtop, kmin, kmax, Spack::n);
+
+      Kokkos::parallel_reduce(
+       Kokkos::TeamVectorRange(team, kmax-kmin+1), [&] (int pk_, Scalar& lmax) {
+        const int pk = kmin + pk_;
+        const auto range_pack = ekat::range<IntSmallPack>(pk*Spack::n);
+        const auto range_mask = range_pack >= kmin_scalar && range_pack <= kmax_scalar;
+        const auto qr_gt_small = range_mask && qr_incld(i,pk) > qsmall;
+        Spack V_qr(0);
+        if (qr_gt_small.any()) {
+          Spack nr_loc = nr_incld(i,pk), mu_r(0), lamr(0), V_nr(0);
+          compute_rain_fall_velocity(vn_table_vals, vm_table_vals, qr_incld(i,pk), rhofacr(i,pk),
+                                     nr_loc, mu_r, lamr, V_qr, V_nr, p3constants, qr_gt_small);
+        }
+        const auto Co_max_local = max(qr_gt_small, 0, V_qr * dt * inv_dz(i,pk));
+        if (Co_max_local > lmax) lmax = Co_max_local;
+      }, Kokkos::Max<Scalar>(Co_max));
+    }
+
+    Kokkos::single(
+      Kokkos::PerTeam(team), [&] () {
+        // Cap the estimate, which also takes care of a NaN Co_max
+        nsubsteps(ii) = not log_qxpresent ? 0 : (Co_max < nk ? static_cast<Int>(Co_max + 1) : nk);
+      });
+  });
+}
+
 } // namespace p3
 } // namespace scream
@@ -204,6 +204,12 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
 {
   // Gather runtime options
   runtime_options.max_total_ni = m_params.get<double>("max_total_ni");
+  const auto sed_scheme = m_params.get<std::string>("sedimentation_scheme","upwind");
+  EKAT_REQUIRE_MSG (sed_scheme=="upwind" || sed_scheme=="semi_lagrangian",
+      "Error! Invalid value for P3 parameter 'sedimentation_scheme'.\n"
+      "  - value: " + sed_scheme + "\n"
+      "  - valid values: upwind, semi_lagrangian\n");
+  runtime_options.do_semi_lagrangian_sed = sed_scheme=="semi_lagrangian";
 
   // setting P3 constants in a struct
   m_p3constants.set_p3_from_namelist(m_params);
@@ -316,6 +322,8 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   diag_outputs.precip_ice_flux  = m_buffer.precip_ice_flux;
   // -- Infrastructure, what is left to assign
   infrastructure.col_location = m_buffer.col_location; // TODO: Initialize this here and now when P3 has access to lat/lon for each column.
+  // Allocated once, so that p3_main does not allocate it at each step
+  infrastructure.col_scratch = P3F::view_1d<Int>("p3_col_scratch",P3F::col_scratch_size(m_num_cols,m_num_levs));
   // --History Only
   history_only.liq_ice_exchange = get_field_out("micro_liq_ice_exchange").get_view<Pack**>();
   history_only.vap_liq_exchange = get_field_out("micro_vap_liq_exchange").get_view<Pack**>();
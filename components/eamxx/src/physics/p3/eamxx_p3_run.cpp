@@ -9,10 +9,10 @@ void P3Microphysics::run_impl (const double dt)
 
   // Assign values to local arrays used by P3, these are now stored in p3_loc.
   Kokkos::parallel_for(
-    "p3_main_local_vals",
+    "P3Microphysics::run_impl::preproc",
     Kokkos::RangePolicy<>(0,m_num_cols),
     p3_preproc
-  ); // Kokkos::parallel_for(p3_main_local_vals)
+  );
   Kokkos::fence();
 
   // Update the variables in the p3 input structures with local values.
@@ -33,10 +33,10 @@ void P3Microphysics::run_impl (const double dt)
 
   // Conduct the post-processing of the p3_main output.
   Kokkos::parallel_for(
-    "p3_main_local_vals",
+    "P3Microphysics::run_impl::postproc",
     Kokkos::RangePolicy<>(0,m_num_cols),
     p3_postproc
-  ); // Kokkos::parallel_for(p3_main_local_vals)
+  );
   Kokkos::fence();
 }
 
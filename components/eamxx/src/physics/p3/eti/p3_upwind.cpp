@@ -42,6 +42,23 @@ ETI_GENSED(2)
 ETI_GENSED(4)
 #undef ETI_GENSED
 
+#define ETI_SLSED(nfield)                                               \
+  template void Functions<Real,DefaultDevice>                           \
+  ::semi_lagrangian_sedimentation<nfield>(                              \
+    const uview_1d<const Spack>& rho,                                   \
+    const uview_1d<const Spack>& inv_rho,                               \
+    const uview_1d<const Spack>& inv_dz,                               \
+    const MemberType& team,                                             \
+    const Int& nk, const Int& k_qxtop, Int& k_qxbot, const Int& kbot, const Int& kdir, \
+    Scalar& dt_left, Scalar& prt_accum,                                 \
+    const view_1d_ptr_array<Spack, nfield>& flux,                       \
+    const view_1d_ptr_array<Spack, nfield>& V,                          \
+    const view_1d_ptr_array<Spack, nfield>& r);
+ETI_SLSED(1)
+ETI_SLSED(2)
+ETI_SLSED(4)
+#undef ETI_SLSED
+
 template struct Functions<Real,DefaultDevice>;
 
 } // namespace p3
@@ -32,7 +32,8 @@ void Functions<S,D>
     const uview_1d<Spack>& lamc,
     const uview_1d<Spack>& qc_tend,
     const uview_1d<Spack>& nc_tend,
-    Scalar& precip_liq_surf)
+    Scalar& precip_liq_surf,
+    const bool& do_semi_lagrangian_sed)
 {
   // Get temporary workspaces needed for the cloud-sed calculation
   uview_1d<Spack> V_qc, V_nc, flux_qx, flux_nx;
@@ -112,7 +113,15 @@ void Functions<S,D>
       }, Kokkos::Max<Scalar>(Co_max));
       team.team_barrier();
 
-      if (do_predict_nc) {
+      if (do_semi_lagrangian_sed) {
+        if (do_predict_nc) {
+          semi_lagrangian_sedimentation<2>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+        }
+        else {
+          semi_lagrangian_sedimentation<1>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, dt_left, prt_accum, flux_ptr, v_ptr, qr_ptr);
+        }
+      }
+      else if (do_predict_nc) {
         generalized_sedimentation<2>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
       }
       else {
@@ -87,7 +87,8 @@ void Functions<S,D>
   const uview_1d<Spack>& ni_tend,
   const view_ice_table& ice_table_vals,
   Scalar& precip_ice_surf,
-  const physics::P3_Constants<S> & p3constants)
+  const physics::P3_Constants<S> & p3constants,
+  const bool& do_semi_lagrangian_sed)
 {
   // Get temporary workspaces needed for the ice-sed calculation
   uview_1d<Spack> V_qit, V_nit, flux_nit, flux_bir, flux_qir, flux_qit;
@@ -172,7 +173,12 @@ void Functions<S,D>
       }, Kokkos::Max<Scalar>(Co_max));
       team.team_barrier();
 
-      generalized_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      if (do_semi_lagrangian_sed) {
+        semi_lagrangian_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      }
+      else {
+        generalized_sedimentation<4>(rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot, kbot, kdir, Co_max, dt_left, prt_accum, fluxes_ptr, vs_ptr, qnr_ptr);
+      }
 
       //Update _incld values with end-of-step cell-ave values
       //No prob w/ div by cld_frac_i because set to min of 1e-4 in interface.
@@ -128,6 +128,87 @@ void Functions<S,D>
   dt_left -= dt_sub;
 }
 
+template <typename S, typename D>
+template <int nfield>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::semi_lagrangian_sedimentation (
+  const uview_1d<const Spack>& rho,
+  const uview_1d<const Spack>& inv_rho,
+  const uview_1d<const Spack>& inv_dz,
+  const MemberType& team,
+  const Int& nk, const Int& k_qxtop, Int& k_qxbot, const Int& kbot, const Int& kdir, Scalar& dt_left, Scalar& prt_accum,
+  const view_1d_ptr_array<Spack, nfield>& fluxes,
+  const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
+  const view_1d_ptr_array<Spack, nfield>& rs)
+{
+  const Scalar dt = dt_left;
+  const Scalar inv_dt = 1 / dt;
+
+  // Everything between k_qxtop and the ground may receive mass
+  Int kmin, kmax;
+  ekat::impl::set_min_max(k_qxtop, kbot, kmin, kmax, Spack::n);
+  Kokkos::parallel_for(
+    Kokkos::TeamVectorRange(team, kmax-kmin+1), [&] (int pk_) {
+      const int pk = kmin + pk_;
+      for (int f = 0; f < nfield; ++f) {
+        (*fluxes[f])(pk) = 0;
+      }
+  });
+  team.team_barrier();
+
+  const auto sinv_rho = scalarize(inv_rho);
+  const auto sinv_dz  = scalarize(inv_dz);
+  const auto srho     = scalarize(rho);
+
+  // The remap is sequential along the column, but fields are independent
+  Kokkos::parallel_for(
+    Kokkos::TeamVectorRange(team, nfield), [&] (int f) {
+      const auto sflux = scalarize(*fluxes[f]);
+      const auto sV    = scalarize(*Vs[f]);
+      const auto sr    = scalarize(*rs[f]);
+
+      // Sources are processed from the bottom up, so that each source is read
+      // before any mass falling from above is deposited into it. Depths are
+      // measured downward from the top of the source cell.
+      for (Int j = k_qxbot; j != k_qxtop + kdir; j += kdir) {
+        const Scalar depth = sV(j) * dt;
+        if (depth <= 0 || sr(j) == 0) continue;
+
+        const Scalar dz_j = 1 / sinv_dz(j);
+        const Scalar mass = sr(j) * srho(j) * dz_j;
+        const Scalar bot_j = depth + dz_j;
+        sr(j) = 0;
+
+        Scalar remaining = mass;
+        Scalar top = 0;
+        for (Int k = j; ; k -= kdir) {
+          const Scalar bot = top + 1 / sinv_dz(k);
+          if (bot > depth) {
+            // The falling slab overlaps cell k
+            const bool last = bot_j <= bot;
+            const Scalar piece = last ? remaining : mass * (bot - ekat::impl::max(depth, top)) / dz_j;
+            sr(k) += piece * sinv_dz(k) * sinv_rho(k);
+            remaining -= piece;
+            if (last) break;
+          }
+          // What is left has crossed the bottom of cell k
+          sflux(k) += remaining * inv_dt;
+          if (k == kbot) break;
+          top = bot;
+        }
+      }
+  });
+  team.team_barrier();
+
+  // accumulated precip during time step
+  const auto sflux0 = scalarize(*fluxes[0]);
+  prt_accum += sflux0(kbot) * dt;
+
+  k_qxbot = kbot;
+  dt_left = 0;
+}
+
 template <typename S, typename D>
 template <int nfield>
 KOKKOS_FUNCTION
@@ -21,6 +21,7 @@ FortranData::FortranData (Int ncol_, Int nlev_)
 {
   do_predict_nc = true;
   do_prescribed_CCN = true;
+  do_semi_lagrangian_sed = false;
   dt = -1; // model time step, s; set to invalid -1
   it = 1;
   // In/out
@@ -22,6 +22,7 @@ struct FortranData {
 
   bool do_predict_nc;
   bool do_prescribed_CCN;
+  bool do_semi_lagrangian_sed; // C++ only
   const Int ncol, nlev;
 
   // In
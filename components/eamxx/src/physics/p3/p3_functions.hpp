@@ -112,6 +112,8 @@ struct Functions
   struct P3Runtime {
     // maximum total ice concentration (sum of all categories) (m)
     Scalar max_total_ni;
+    // Use semi-Lagrangian sedimentation instead of CFL-limited upwind substeps
+    bool do_semi_lagrangian_sed = false;
   };
 
   // This struct stores prognostic variables evolved by P3.
@@ -214,8 +216,19 @@ struct Functions
     bool prescribedCCN;
     // Coordinates of columns, nj x 3
     view_2d<const Scalar> col_location;
+    // Integer scratch used by the small kernels implementation to store lists of
+    // columns, of size at least col_scratch_size(nj,nk). If not set, it is
+    // allocated at each call of p3_main.
+    view_1d<Int> col_scratch;
   };
 
+  // Size of P3Infrastructure::col_scratch: the active columns, the estimated
+  // number of sedimentation substeps and the binned columns (nj each), plus
+  // the offsets of the (at most nk) substeps bins.
+  static Int col_scratch_size (const Int nj, const Int nk) {
+    return 3*nj + nk + 1;
+  }
+
   // This struct stores tendencies computed by P3 and used by other
   // parameterizations.
   struct P3HistoryOnly {
@@ -393,6 +406,29 @@ struct Functions
     const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
     const view_1d_ptr_array<Spack, nfield>& rs);
 
+  // Semi-Lagrangian alternative to generalized_sedimentation, which covers all
+  // of dt_left in a single step, regardless of the Courant number. The mass of
+  // each cell in [k_qxtop, k_qxbot] falls rigidly by V*dt_left, and is remapped
+  // conservatively (piecewise constant) onto the cells it lands on; mass falling
+  // past kbot is added to prt_accum. The scheme is first order, like the upwind
+  // one, but also unconditionally stable and positivity preserving. Fall speeds
+  // are used once, rather than once per substep, but the remap still visits all
+  // the cells crossed by each source, so the work is O(nk*Co) per field (up to
+  // O(nk^2) for very large Courant numbers). Each field is remapped serially by
+  // one thread of the team. On output, fluxes contain the time-averaged flux
+  // through the bottom of each cell, dt_left is 0, and k_qxbot is kbot.
+  template <int nfield>
+  KOKKOS_FUNCTION
+  static void semi_lagrangian_sedimentation(
+    const uview_1d<const Spack>& rho,
+    const uview_1d<const Spack>& inv_rho,
+    const uview_1d<const Spack>& inv_dz,
+    const MemberType& team,
+    const Int& nk, const Int& k_qxtop, Int& k_qxbot, const Int& kbot, const Int& kdir, Scalar& dt_left, Scalar& prt_accum,
+    const view_1d_ptr_array<Spack, nfield>& fluxes,
+    const view_1d_ptr_array<Spack, nfield>& Vs, // (behaviorally const)
+    const view_1d_ptr_array<Spack, nfield>& rs);
+
   // Cloud sedimentation
   KOKKOS_FUNCTION
   static void cloud_sedimentation(
@@ -414,7 +450,8 @@ struct Functions
     const uview_1d<Spack>& lamc,
     const uview_1d<Spack>& qc_tend,
     const uview_1d<Spack>& nc_tend,
-    Scalar& precip_liq_surf);
+    Scalar& precip_liq_surf,
+    const bool& do_semi_lagrangian_sed = false);
 
 #ifdef SCREAM_SMALL_KERNELS
   static void cloud_sedimentation_disp(
@@ -437,7 +474,23 @@ struct Functions
     const uview_2d<Spack>& nc_tend,
     const uview_1d<Scalar>& precip_liq_surf,
     const uview_1d<bool>& is_nucleat_possible,
-    const uview_1d<bool>& is_hydromet_present);
+    const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
+    const bool& do_semi_lagrangian_sed = false);
+
+  // Estimate the number of CFL substeps of cloud_sedimentation for each of the
+  // nj columns in cols (0 if there is no cloud water), capped at nk. Inputs are not modified.
+  static void cloud_sedimentation_substeps_disp(
+    const uview_2d<const Spack>& qc,
+    const uview_2d<const Spack>& qc_incld,
+    const uview_2d<const Spack>& nc_incld,
+    const uview_2d<const Spack>& rho,
+    const uview_2d<const Spack>& acn,
+    const uview_2d<const Spack>& inv_dz,
+    const view_dnu_table& dnu,
+    const Int& nj, const Int& nk, const Int& ktop, const Int& kbot, const Int& kdir, const Scalar& dt,
+    const uview_1d<const Int>& cols,
+    const uview_1d<Int>& nsubsteps);
 #endif
 
   // TODO: comment
@@ -462,7 +515,8 @@ struct Functions
     const uview_1d<Spack>& qr_tend,
     const uview_1d<Spack>& nr_tend,
     Scalar& precip_liq_surf,
-    const physics::P3_Constants<ScalarT> & p3constants);
+    const physics::P3_Constants<ScalarT> & p3constants,
+    const bool& do_semi_lagrangian_sed = false);
 
 #ifdef SCREAM_SMALL_KERNELS
   static void rain_sedimentation_disp(
@@ -486,6 +540,22 @@ struct Functions
     const uview_1d<Scalar>& precip_liq_surf,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
+    const physics::P3_Constants<ScalarT> & p3constants,
+    const bool& do_semi_lagrangian_sed = false);
+
+  // Estimate the number of CFL substeps of rain_sedimentation for each of the
+  // nj columns in cols (0 if there is no rain), capped at nk. Inputs are not modified.
+  static void rain_sedimentation_substeps_disp(
+    const uview_2d<const Spack>& qr,
+    const uview_2d<const Spack>& qr_incld,
+    const uview_2d<const Spack>& nr_incld,
+    const uview_2d<const Spack>& rhofacr,
+    const uview_2d<const Spack>& inv_dz,
+    const view_2d_table& vn_table_vals, const view_2d_table& vm_table_vals,
+    const Int& nj, const Int& nk, const Int& ktop, const Int& kbot, const Int& kdir, const Scalar& dt,
+    const uview_1d<const Int>& cols,
+    const uview_1d<Int>& nsubsteps,
     const physics::P3_Constants<ScalarT> & p3constants);
 #endif
 
@@ -512,7 +582,8 @@ struct Functions
     const uview_1d<Spack>& ni_tend,
     const view_ice_table& ice_table_vals,
     Scalar& precip_ice_surf,
-    const physics::P3_Constants<ScalarT> & p3constants);
+    const physics::P3_Constants<ScalarT> & p3constants,
+    const bool& do_semi_lagrangian_sed = false);
 
 #ifdef SCREAM_SMALL_KERNELS
   static void ice_sedimentation_disp(
@@ -537,7 +608,37 @@ struct Functions
     const uview_1d<Scalar>& precip_ice_surf,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
+    const physics::P3_Constants<ScalarT> & p3constants,
+    const bool& do_semi_lagrangian_sed = false);
+
+  // Estimate the number of CFL substeps of ice_sedimentation for each of the
+  // nj columns in cols (0 if there is no ice), capped at nk. Inputs are not modified.
+  static void ice_sedimentation_substeps_disp(
+    const uview_2d<const Spack>& qi,
+    const uview_2d<const Spack>& qi_incld,
+    const uview_2d<const Spack>& ni_incld,
+    const uview_2d<const Spack>& qm_incld,
+    const uview_2d<const Spack>& bm_incld,
+    const uview_2d<const Spack>& rhofaci,
+    const uview_2d<const Spack>& inv_dz,
+    const view_ice_table& ice_table_vals,
+    const Int& nj, const Int& nk, const Int& ktop, const Int& kbot, const Int& kdir, const Scalar& dt,
+    const uview_1d<const Int>& cols,
+    const uview_1d<Int>& nsubsteps,
     const physics::P3_Constants<ScalarT> & p3constants);
+
+  // Reorder cols by decreasing number of substeps, so that columns with similar
+  // sedimentation cost are launched together, and the most expensive ones first.
+  // Columns with the same number of substeps are stored in arbitrary order.
+  // At most max_bins bins are used: columns with more than max_bins substeps
+  // all go in the first bin. bin_offset must have at least max_bins+1 entries.
+  static void bin_columns_by_substeps_disp(
+    const uview_1d<const Int>& cols,
+    const uview_1d<const Int>& nsubsteps,
+    const Int& max_bins,
+    const uview_1d<Int>& bin_offset,
+    const uview_1d<Int>& binned_cols);
 #endif
 
   // homogeneous freezing of cloud and rain
@@ -574,7 +675,8 @@ struct Functions
     const uview_2d<Spack>& bm,
     const uview_2d<Spack>& th_atm,
     const uview_1d<bool>& is_nucleat_possible,
-    const uview_1d<bool>& is_hydromet_present);
+    const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols);
 #endif
 
   // -- Find layers
@@ -1196,6 +1298,7 @@ struct Functions
     const uview_2d<Spack>& prctot,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
     const physics::P3_Constants<ScalarT> & p3constants);
 #endif
 
@@ -1285,6 +1388,7 @@ struct Functions
     const uview_2d<Spack>& diag_eff_radius_qr,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
     const physics::P3_Constants<ScalarT> & p3constants);
 #endif
 
@@ -1316,6 +1420,9 @@ struct Functions
     const physics::P3_Constants<ScalarT> & p3constants);
 
 #ifdef SCREAM_SMALL_KERNELS
+  // Same as p3_main_internal, but each part is a separate kernel. The kernels
+  // after part1 only launch over the nj entries of active_cols, which lists the
+  // columns where nucleation is possible or hydrometeors are present.
   static Int p3_main_internal_disp(
     const P3Runtime& runtime_options,
     const P3PrognosticState& prognostic_state,
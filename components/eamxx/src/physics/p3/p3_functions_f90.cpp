@@ -1929,7 +1929,8 @@ Int p3_main_f(
   Real* precip_ice_surf, Int its, Int ite, Int kts, Int kte, Real* diag_eff_radius_qc,
   Real* diag_eff_radius_qi, Real* diag_eff_radius_qr, Real* rho_qi, bool do_predict_nc, bool do_prescribed_CCN, Real* dpres, Real* inv_exner,
   Real* qv2qi_depos_tend, Real* precip_liq_flux, Real* precip_ice_flux, Real* cld_frac_r, Real* cld_frac_l, Real* cld_frac_i,
-  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev)
+  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev,
+  bool do_semi_lagrangian_sed)
 {
   using P3F  = Functions<Real, DefaultDevice>;
 
@@ -2065,7 +2066,7 @@ Int p3_main_f(
 
   P3F::P3LookupTables lookup_tables{mu_r_table_vals, vn_table_vals, vm_table_vals, revap_table_vals,
                                     ice_table_vals, collect_table_vals, dnu_table_vals};
-  P3F::P3Runtime runtime_options{740.0e3};
+  P3F::P3Runtime runtime_options{740.0e3, do_semi_lagrangian_sed};
 
   // Create local workspace
   const Int nk_pack = ekat::npack<Spack>(nk);
@@ -29,6 +29,8 @@ namespace p3 {
 Int p3_main_wrap(const FortranData& d, bool use_fortran) {
   EKAT_REQUIRE_MSG(d.dt > 0, "invalid dt");
   if (use_fortran) {
+    EKAT_REQUIRE_MSG(not d.do_semi_lagrangian_sed,
+                     "Semi-Lagrangian sedimentation is not available in the fortran impl");
     Real elapsed_s;
     p3_main_c(d.qc.data(), d.nc.data(), d.qr.data(), d.nr.data(),
               d.th_atm.data(), d.qv.data(), d.dt, d.qi.data(),
@@ -52,7 +54,8 @@ Int p3_main_wrap(const FortranData& d, bool use_fortran) {
                      d.precip_liq_flux.data(), d.precip_ice_flux.data(),
                      d.cld_frac_r.data(), d.cld_frac_l.data(), d.cld_frac_i.data(),
                      d.liq_ice_exchange.data(), d.vap_liq_exchange.data(),
-                     d.vap_ice_exchange.data(),d.qv_prev.data(),d.t_prev.data() );
+                     d.vap_ice_exchange.data(),d.qv_prev.data(),d.t_prev.data(),
+                     d.do_semi_lagrangian_sed);
 
   }
 }
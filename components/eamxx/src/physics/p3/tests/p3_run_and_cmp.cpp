@@ -26,7 +26,9 @@ using namespace scream::p3;
  * start from an initial condition in ../p3_ic_cases.cpp. By default,
  * tests are run with log_PredictNc=true and false and also for 1 step or
  * 6 steps. This creates a total of 4 different cases. When 6 steps are run,
- * output for each step is considered separately.
+ * output for each step is considered separately. The sedimentation scheme
+ * can be selected with -sed; in a timing run (-r), "-sed both" reports the
+ * cost of the upwind and semi-Lagrangian schemes on the same cases.
  */
 
 
@@ -50,7 +52,8 @@ using namespace scream::p3;
 }
 
 struct Baseline {
-  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int repeat, const std::string predict_nc, const std::string prescribed_CCN)
+  Baseline (const Int nsteps, const Real dt, const Int ncol, const Int nlev, const Int repeat, const std::string predict_nc, const std::string prescribed_CCN,
+            const std::string sed_scheme)
   {
     //If predict_nc="both", start looping at i_start=0 (false) and end after i_start=1 (true)
     //otherwise, modify start and end to only loop over case of interest. Test that predict_nc
@@ -66,11 +69,19 @@ struct Baseline {
     if (prescribed_CCN == "yes") {j_start=1;}
     if (prescribed_CCN == "no" ) {j_end=1;}
 
+    //Like above, get indexing for sedimentation scheme options. Running both
+    //schemes in a timing run (-r) gives a cost comparison of the two.
+    int l_start=0;
+    int l_end=2;
+    if (sed_scheme == "semi_lagrangian") {l_start=1;}
+    if (sed_scheme == "upwind"         ) {l_end=1;}
 
     for (int i = i_start; i < i_end; ++i) { // predict_nc is false or true
       for (int j = j_start; j< j_end; ++j) { //prescribed_CCN is false or true
-  //                 initial condit,     repeat, nsteps, ncol, nlev, dt, prescribe or predict nc, prescribe CCN or not
-  params_.push_back({ic::Factory::mixed, repeat, nsteps, ncol, nlev, dt, i>0,                     j>0 });
+        for (int l = l_start; l < l_end; ++l) { //upwind or semi-Lagrangian sedimentation
+  //                 initial condit,     repeat, nsteps, ncol, nlev, dt, prescribe or predict nc, prescribe CCN or not, SL sed or not
+  params_.push_back({ic::Factory::mixed, repeat, nsteps, ncol, nlev, dt, i>0,                     j>0,                  l>0 });
+        }
       }
     }
   }
@@ -80,9 +91,10 @@ struct Baseline {
     EKAT_REQUIRE_MSG( fid, "generate_baseline can't write " << filename);
     Int nerr = 0;
 
-    Int total_duration_microsec = 0;
-
     for (auto ps : params_) {
+      // Time each set of parameters separately, so that timings can be compared
+      Int total_duration_microsec = 0;
+
       // Run reference p3 on this set of parameters.
       for (Int r = -1; r < ps.repeat; ++r) {
         const auto d = ic::Factory::create(ps.ic, ps.ncol, ps.nlev);
@@ -93,7 +105,8 @@ struct Baseline {
           std::cout << "Running P3 with ni=" << d->ncol << ", nk=" << d->nlev
                     << ", dt=" << d->dt << ", ts=" << d->it
                     << ", predict_nc=" << d->do_predict_nc
-                    << ", prescribed_CCN=" << d->do_prescribed_CCN;
+                    << ", prescribed_CCN=" << d->do_prescribed_CCN
+                    << ", sed=" << (d->do_semi_lagrangian_sed ? "semi_lagrangian" : "upwind");
 
           if (!use_fortran) {
             std::cout << ", small_packn=" << SCREAM_SMALL_PACK_SIZE;
@@ -159,7 +172,7 @@ private:
     ic::Factory::IC ic;
     Int repeat, nsteps, ncol, nlev;
     Real dt;
-    bool do_predict_nc, do_prescribed_CCN;
+    bool do_predict_nc, do_prescribed_CCN, do_semi_lagrangian_sed;
   };
 
   static void set_params (const ParamSet& ps, FortranData& d) {
@@ -168,6 +181,7 @@ private:
     d.it                = ps.nsteps;
     d.do_predict_nc     = ps.do_predict_nc;
     d.do_prescribed_CCN = ps.do_prescribed_CCN;
+    d.do_semi_lagrangian_sed = ps.do_semi_lagrangian_sed;
   }
 
   std::vector<ParamSet> params_;
@@ -231,7 +245,8 @@ int main (int argc, char** argv) {
       "  -k <nlev>           Number of vertical levels. Default=72.\n"
       "  -r <repeat>         Number of repetitions, implies timing run (generate + no I/O). Default=0.\n"
       "  -p <predict_nc>     yes|no|both. Default=both.\n"
-      "  -c <prescribed_ccn> yes|no|both. Default=both.\n";
+      "  -c <prescribed_ccn> yes|no|both. Default=both.\n"
+      "  -sed <scheme>       Sedimentation scheme: upwind|semi_lagrangian|both. Default=upwind.\n";
     return 1;
   }
 
@@ -245,6 +260,7 @@ int main (int argc, char** argv) {
   std::string device;
   std::string predict_nc = "both";
   std::string prescribed_ccn = "both";
+  std::string sed_scheme = "upwind";
   std::string baseline_fn;
   for (int i = 1; i < argc-1; ++i) {
     if (ekat::argv_matches(argv[i], "-g", "--generate")) generate = true;
@@ -306,7 +322,16 @@ int main (int argc, char** argv) {
       EKAT_REQUIRE_MSG(prescribed_ccn == "yes" || prescribed_ccn == "no" || prescribed_ccn == "both",
                        "Prescribed CCN option value must be one of yes|no|both");
     }
+    if (ekat::argv_matches(argv[i], "-sed", "--sedimentation")) {
+      expect_another_arg(i, argc);
+      ++i;
+      sed_scheme = std::string(argv[i]);
+      EKAT_REQUIRE_MSG(sed_scheme == "upwind" || sed_scheme == "semi_lagrangian" || sed_scheme == "both",
+                       "Sedimentation option value must be one of upwind|semi_lagrangian|both");
+    }
   }
+  EKAT_REQUIRE_MSG(sed_scheme == "upwind" || not use_fortran,
+                   "Semi-Lagrangian sedimentation is only available in the C++ impl");
 
   // Decorate baseline name with precision.
   baseline_fn += std::to_string(sizeof(scream::Real));
@@ -337,7 +362,7 @@ int main (int argc, char** argv) {
   }
 
   scream::initialize_scream_session(args.size(), args.data()); {
-    Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn);
+    Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn, sed_scheme);
     if (generate) {
       std::cout << "Generating to " << baseline_fn << "\n";
       nerr += bln.generate_baseline(baseline_fn, use_fortran);
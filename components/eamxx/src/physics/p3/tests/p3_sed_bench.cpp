@@ -0,0 +1,326 @@
+#include <catch2/catch.hpp>
+
+#include "p3_functions.hpp"
+#include "p3_ic_cases.hpp"
+#include "physics/share/physics_constants.hpp"
+
+#include <ekat/util/ekat_test_utils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace scream {
+namespace p3 {
+
+// Benchmark for the binning of columns by number of sedimentation substeps.
+// Starting from the mixed IC of p3_run_and_cmp, the hydrometeors of half of
+// the columns are scaled by a random factor in [1e-2,1e2], while the other
+// half of the columns is left cloud-free. For cloud, rain, and ice
+// sedimentation, we report the kernel time and the team efficiency with the
+// natural and the binned column order. The team efficiency is the analogue
+// of warp efficiency at the team level: the fraction of team slots doing
+// useful work, assuming that each wave of concurrently resident teams lasts
+// as long as its slowest team. We also check that answers do not change.
+// The problem size can be set via
+//   --ekat-test-params ncols=<N>,nrepeat=<N>
+
+TEST_CASE ("p3_sed_bench")
+{
+  using P3F         = Functions<Real,DefaultDevice>;
+  using KT          = P3F::KT;
+  using Spack       = P3F::Spack;
+  using C           = P3F::C;
+  using view_1d_int = P3F::view_1d<Int>;
+  using view_1d     = P3F::view_1d<Real>;
+  using view_2d     = P3F::view_2d<Spack>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto& session = ekat::TestSession::get();
+  session.params.emplace("ncols","1024");
+  session.params.emplace("nrepeat","10");
+  const int ncols   = std::stoi(session.params["ncols"]);
+  const int nrepeat = std::stoi(session.params["nrepeat"]);
+  const int nk      = 72;
+  const int nk_pack = ekat::npack<Spack>(nk);
+  const int kdir    = -1;
+  const int ktop    = 0;
+  const int kbot    = nk-1;
+  const Real dt     = 300;
+  const Real inv_dt = 1/dt;
+  const auto p3constants = physics::P3_Constants<Real>();
+
+  // Build the ICs on host
+  const auto d = ic::Factory::create(ic::Factory::mixed, ncols, nk);
+  std::mt19937_64 engine(1234);
+  std::uniform_real_distribution<Real> pdf(0,1);
+  for (int i=0; i<ncols; ++i) {
+    const Real scale = pdf(engine)<0.5 ? 0 : std::pow(Real(10),4*pdf(engine)-2);
+    for (int k=0; k<nk; ++k) {
+      d->qc(i,k) *= scale;
+      d->qr(i,k) *= scale;
+      d->qi(i,k) *= scale;
+      d->qm(i,k) *= scale;
+      d->bm(i,k) *= scale;
+    }
+  }
+
+  // All the fields used by the sedimentation kernels. Cloud fractions are 1,
+  // so the in-cloud quantities coincide with the cell averages.
+  struct State {
+    State (const int ncols, const int nk_pack)
+    {
+      for (auto v : fields()) {
+        *v = view_2d("",ncols,nk_pack);
+      }
+      precip_liq_surf = view_1d("",ncols);
+      precip_ice_surf = view_1d("",ncols);
+    }
+    std::vector<view_2d*> fields () {
+      return {&qc, &nc, &qr, &nr, &qi, &ni, &qm, &bm,
+              &qc_incld, &nc_incld, &qr_incld, &nr_incld,
+              &qi_incld, &ni_incld, &qm_incld, &bm_incld,
+              &mu_c, &lamc, &mu_r, &lamr, &precip_liq_flux,
+              &qc_tend, &nc_tend, &qr_tend, &nr_tend, &qi_tend, &ni_tend};
+    }
+    void deep_copy (State& src) {
+      auto dst_f = fields();
+      auto src_f = src.fields();
+      for (size_t n=0; n<dst_f.size(); ++n) {
+        Kokkos::deep_copy(*dst_f[n],*src_f[n]);
+      }
+      Kokkos::deep_copy(precip_liq_surf,src.precip_liq_surf);
+      Kokkos::deep_copy(precip_ice_surf,src.precip_ice_surf);
+    }
+
+    view_2d qc, nc, qr, nr, qi, ni, qm, bm;
+    view_2d qc_incld, nc_incld, qr_incld, nr_incld, qi_incld, ni_incld, qm_incld, bm_incld;
+    view_2d mu_c, lamc, mu_r, lamr, precip_liq_flux;
+    view_2d qc_tend, nc_tend, qr_tend, nr_tend, qi_tend, ni_tend;
+    view_1d precip_liq_surf, precip_ice_surf;
+  };
+
+  State state0(ncols,nk_pack), state(ncols,nk_pack), state_ref(ncols,nk_pack);
+  view_2d rho("rho",ncols,nk_pack), inv_rho("inv_rho",ncols,nk_pack),
+          rhofacr("rhofacr",ncols,nk_pack), rhofaci("rhofaci",ncols,nk_pack),
+          acn("acn",ncols,nk_pack), inv_dz("inv_dz",ncols,nk_pack),
+          cld_frac("cld_frac",ncols,nk_pack);
+  {
+    auto set_host = [&](const view_2d& v, auto&& f) {
+      auto v_h = Kokkos::create_mirror_view(v);
+      auto s_h = ekat::scalarize(v_h);
+      for (int i=0; i<ncols; ++i) {
+        for (int k=0; k<nk_pack*Spack::n; ++k) {
+          // Pad with copies of the last level
+          s_h(i,k) = f(i,std::min(k,nk-1));
+        }
+      }
+      Kokkos::deep_copy(v,v_h);
+    };
+    auto rho_f = [&](int i, int k) { return d->dpres(i,k) / d->dz(i,k) / C::gravit; };
+    auto T_f   = [&](int i, int k) { return d->th_atm(i,k) / d->inv_exner(i,k); };
+    set_host(rho,     rho_f);
+    set_host(inv_rho, [&](int i, int k) { return 1 / rho_f(i,k); });
+    set_host(rhofacr, [&](int i, int k) { return std::pow(C::RHO_1000MB / rho_f(i,k), Real(0.54)); });
+    set_host(rhofaci, [&](int i, int k) { return std::pow(C::RHO_600MB / rho_f(i,k), Real(0.54)); });
+    set_host(acn,     [&](int i, int k) {
+      const Real mu = 1.496e-6 * std::pow(T_f(i,k),Real(1.5)) / (T_f(i,k) + 120);
+      return C::gravit * C::RHO_H2O / (18 * mu); });
+    set_host(inv_dz,   [&](int i, int k) { return 1 / d->dz(i,k); });
+    set_host(cld_frac, [&](int,   int  ) { return Real(1); });
+    for (auto q : {std::make_pair(&state0.qc,&d->qc), std::make_pair(&state0.nc,&d->nc),
+                   std::make_pair(&state0.qr,&d->qr), std::make_pair(&state0.nr,&d->nr),
+                   std::make_pair(&state0.qi,&d->qi), std::make_pair(&state0.ni,&d->ni),
+                   std::make_pair(&state0.qm,&d->qm), std::make_pair(&state0.bm,&d->bm)}) {
+      set_host(*q.first, [&](int i, int k) { return (*q.second)(i,k); });
+    }
+    Kokkos::deep_copy(state0.qc_incld,state0.qc);
+    Kokkos::deep_copy(state0.nc_incld,state0.nc);
+    Kokkos::deep_copy(state0.qr_incld,state0.qr);
+    Kokkos::deep_copy(state0.nr_incld,state0.nr);
+    Kokkos::deep_copy(state0.qi_incld,state0.qi);
+    Kokkos::deep_copy(state0.ni_incld,state0.ni);
+    Kokkos::deep_copy(state0.qm_incld,state0.qm);
+    Kokkos::deep_copy(state0.bm_incld,state0.bm);
+  }
+
+  // Tables and workspace
+  P3F::view_1d_table mu_r_table_vals;
+  P3F::view_2d_table vn_table_vals, vm_table_vals, revap_table_vals;
+  P3F::view_ice_table ice_table_vals;
+  P3F::view_collect_table collect_table_vals;
+  P3F::view_dnu_table dnu_table_vals;
+  P3F::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
+  P3F::init_kokkos_tables(vn_table_vals, vm_table_vals, revap_table_vals, mu_r_table_vals, dnu_table_vals);
+
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncols, nk_pack);
+  P3F::WorkspaceManager workspace_mgr(nk_pack, 52, policy);
+
+  // Number of teams that can run concurrently
+  const int wave = std::max(1,KT::ExeSpace().concurrency() / policy.team_size());
+
+  // All columns are active
+  P3F::view_1d<bool> nucleationPossible("",ncols), hydrometeorsPresent("",ncols);
+  Kokkos::deep_copy(nucleationPossible,true);
+  Kokkos::deep_copy(hydrometeorsPresent,true);
+  view_1d_int all_cols("all_cols",ncols), binned_cols("binned_cols",ncols), nsubsteps("nsubsteps",ncols);
+  view_1d_int bin_offset("bin_offset",nk+1);
+  Kokkos::parallel_for(ncols, KOKKOS_LAMBDA(const int i) { all_cols(i) = i; });
+
+  auto team_efficiency = [&](const view_1d_int& cols) {
+    auto cols_h = Kokkos::create_mirror_view(cols);
+    auto nsub_h = Kokkos::create_mirror_view(nsubsteps);
+    Kokkos::deep_copy(cols_h,cols);
+    Kokkos::deep_copy(nsub_h,nsubsteps);
+    // nsubsteps is ordered as all_cols, so nsub_h(i) is the estimate for column i
+    long work = 0, slots = 0;
+    for (int start=0; start<ncols; start+=wave) {
+      const int end = std::min(ncols,start+wave);
+      int wave_max = 0;
+      for (int j=start; j<end; ++j) {
+        work += nsub_h(cols_h(j));
+        wave_max = std::max(wave_max,nsub_h(cols_h(j)));
+      }
+      slots += long(end-start)*wave_max;
+    }
+    return slots>0 ? double(work)/slots : 1.0;
+  };
+
+  // Time the sedimentation kernel over the given column order, and check
+  // that answers match those obtained with the natural order
+  auto run = [&](const std::string& name, auto&& estimate, auto&& sediment) {
+    state.deep_copy(state0);
+    estimate(state);
+    P3F::bin_columns_by_substeps_disp(all_cols, nsubsteps, nk, bin_offset, binned_cols);
+
+    auto time_it = [&](const view_1d_int& cols) {
+      double elapsed = 0;
+      for (int n=0; n<nrepeat; ++n) {
+        state.deep_copy(state0);
+        Kokkos::fence();
+        auto start = std::chrono::steady_clock::now();
+        sediment(state,cols);
+        Kokkos::fence();
+        auto finish = std::chrono::steady_clock::now();
+        elapsed += std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
+      }
+      return elapsed / (1e3*nrepeat);
+    };
+    const double ms_natural = time_it(all_cols);
+    state_ref.deep_copy(state);
+    const double ms_binned  = time_it(binned_cols);
+
+    if (comm.am_i_root()) {
+      printf(" -> %s sedimentation, %d cols x %d levs, %d teams per wave\n",name.c_str(),ncols,nk,wave);
+      printf("    - natural order: %.4f ms/call, team efficiency %.3f\n",ms_natural,team_efficiency(all_cols));
+      printf("    - binned order : %.4f ms/call, team efficiency %.3f\n",ms_binned,team_efficiency(binned_cols));
+    }
+
+    // Columns are independent, so the order must not change the answer
+    auto f   = state.fields();
+    auto ref = state_ref.fields();
+    for (size_t n=0; n<ref.size(); ++n) {
+      auto v_h   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),*f[n]);
+      auto ref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),*ref[n]);
+      auto s   = ekat::scalarize(v_h);
+      auto s_r = ekat::scalarize(ref_h);
+      for (size_t j=0; j<s.size(); ++j) {
+        REQUIRE (s.data()[j]==s_r.data()[j]);
+      }
+    }
+    for (auto p : {std::make_pair(state.precip_liq_surf,state_ref.precip_liq_surf),
+                   std::make_pair(state.precip_ice_surf,state_ref.precip_ice_surf)}) {
+      auto v_h   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),p.first);
+      auto ref_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),p.second);
+      for (int i=0; i<ncols; ++i) {
+        REQUIRE (v_h(i)==ref_h(i));
+      }
+    }
+  };
+
+  run("cloud",
+    [&](State& s) {
+      P3F::cloud_sedimentation_substeps_disp(
+        s.qc, s.qc_incld, s.nc_incld, rho, acn, inv_dz, dnu_table_vals,
+        ncols, nk, ktop, kbot, kdir, dt, all_cols, nsubsteps);
+    },
+    [&](State& s, const view_1d_int& cols) {
+      P3F::cloud_sedimentation_disp(
+        s.qc_incld, rho, inv_rho, cld_frac, acn, inv_dz, dnu_table_vals, workspace_mgr,
+        ncols, nk, ktop, kbot, kdir, dt, inv_dt, true,
+        s.qc, s.nc, s.nc_incld, s.mu_c, s.lamc, s.qc_tend, s.nc_tend,
+        s.precip_liq_surf, nucleationPossible, hydrometeorsPresent, cols);
+    });
+
+  run("rain",
+    [&](State& s) {
+      P3F::rain_sedimentation_substeps_disp(
+        s.qr, s.qr_incld, s.nr_incld, rhofacr, inv_dz, vn_table_vals, vm_table_vals,
+        ncols, nk, ktop, kbot, kdir, dt, all_cols, nsubsteps, p3constants);
+    },
+    [&](State& s, const view_1d_int& cols) {
+      P3F::rain_sedimentation_disp(
+        rho, inv_rho, rhofacr, cld_frac, inv_dz, s.qr_incld, workspace_mgr,
+        vn_table_vals, vm_table_vals, ncols, nk, ktop, kbot, kdir, dt, inv_dt,
+        s.qr, s.nr, s.nr_incld, s.mu_r, s.lamr, s.precip_liq_flux, s.qr_tend, s.nr_tend,
+        s.precip_liq_surf, nucleationPossible, hydrometeorsPresent, cols, p3constants);
+    });
+
+  run("ice",
+    [&](State& s) {
+      P3F::ice_sedimentation_substeps_disp(
+        s.qi, s.qi_incld, s.ni_incld, s.qm_incld, s.bm_incld, rhofaci, inv_dz, ice_table_vals,
+        ncols, nk, ktop, kbot, kdir, dt, all_cols, nsubsteps, p3constants);
+    },
+    [&](State& s, const view_1d_int& cols) {
+      P3F::ice_sedimentation_disp(
+        rho, inv_rho, rhofaci, cld_frac, inv_dz, workspace_mgr, ncols, nk, ktop, kbot, kdir, dt, inv_dt,
+        s.qi, s.qi_incld, s.ni, s.ni_incld, s.qm, s.qm_incld, s.bm, s.bm_incld, s.qi_tend, s.ni_tend,
+        ice_table_vals, s.precip_ice_surf, nucleationPossible, hydrometeorsPresent, cols, p3constants);
+    });
+}
+
+// Bins are capped: columns with more substeps than bins go in the first bin
+TEST_CASE ("p3_sed_binning")
+{
+  using P3F         = Functions<Real,DefaultDevice>;
+  using view_1d_int = P3F::view_1d<Int>;
+
+  const std::vector<Int> nsub = {0, 3, 1000, 2, 5, 1000000, 1, 4, 0};
+  const int ncols    = nsub.size();
+  const int max_bins = 4;
+
+  view_1d_int cols("cols",ncols), nsubsteps("nsubsteps",ncols), binned_cols("binned_cols",ncols);
+  view_1d_int bin_offset("bin_offset",max_bins+1);
+  auto cols_h = Kokkos::create_mirror_view(cols);
+  auto nsub_h = Kokkos::create_mirror_view(nsubsteps);
+  for (int i=0; i<ncols; ++i) {
+    cols_h(i) = 2*i;
+    nsub_h(i) = nsub[i];
+  }
+  Kokkos::deep_copy(cols,cols_h);
+  Kokkos::deep_copy(nsubsteps,nsub_h);
+
+  // Run twice, to check that bin_offset does not need to be zeroed by the caller
+  for (int n=0; n<2; ++n) {
+    P3F::bin_columns_by_substeps_disp(cols, nsubsteps, max_bins, bin_offset, binned_cols);
+
+    auto binned_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),binned_cols);
+    std::vector<Int> sorted(binned_h.data(),binned_h.data()+ncols);
+    std::sort(sorted.begin(),sorted.end());
+    for (int i=0; i<ncols; ++i) {
+      REQUIRE (sorted[i]==2*i);
+    }
+    auto capped = [&](const int j) { return std::min(nsub[binned_h(j)/2],max_bins); };
+    for (int j=1; j<ncols; ++j) {
+      REQUIRE (capped(j-1)>=capped(j));
+    }
+  }
+
+  REQUIRE_THROWS (P3F::bin_columns_by_substeps_disp(cols, nsubsteps, max_bins+1, bin_offset, binned_cols));
+}
+
+} // namespace p3
+} // namespace scream
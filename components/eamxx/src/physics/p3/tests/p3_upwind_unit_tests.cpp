@@ -350,6 +350,133 @@ static void run_bfb()
 
 };
 
+// The semi-Lagrangian scheme sediments two fields over the whole time step, for
+// a range of fall speeds whose Courant numbers go from below 1 to well past the
+// column depth. The test checks that mass is conserved (including what reaches
+// the ground), that the mixing ratios stay nonnegative, and that the fluxes are
+// consistent with the change of mass above each interface. As in P3, only the
+// cells in [k_qxtop, k_qxbot] fall, while the cells below k_qxbot hold some
+// non-falling mass that must be left in place unless mass lands on them.
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestSLSed {
+
+static void run_phys()
+{
+  static const Int nfield = 2;
+
+  const auto eps = std::numeric_limits<Scalar>::epsilon();
+
+  for (Int nk : {17, 32, 77, 128}) {
+    const Int npack = ekat::npack<Spack>(nk);
+    const Real min_dz = 20, dt = 300;
+
+    view_1d<Spack> rho("rho", npack), inv_rho("inv_rho", npack), inv_dz("inv_dz", npack);
+    Kokkos::Array<view_1d<Spack>, nfield> flux, V, r;
+    for (int i = 0; i < nfield; ++i) {
+      flux[i] = view_1d<Spack>("flux", npack);
+      V[i]    = view_1d<Spack>("V", npack);
+      r[i]    = view_1d<Spack>("r", npack);
+    }
+    view_1d<Scalar> out("out", 2); // prt_accum, dt_left
+    view_1d<Int> k_qxbot_out("k_qxbot", 1);
+
+    for (Int kdir : {-1, 1}) {
+      const Int kbot    = kdir == -1 ? nk-1 : 0;
+      const Int ktop    = kdir == -1 ? 0 : nk-1;
+      const Int k_qxtop = ktop - 2*kdir;
+      const Int k_qxbot = kbot + (nk/3)*kdir;
+
+      for (Real max_speed : {0.05, 1.0, 10.0, 1e3}) {
+        // Set rho, dz, mixing ratios r, and fall speeds V. Depth increases from
+        // ktop to kbot, so that the profiles are the same for both kdir.
+        Kokkos::parallel_for(RangePolicy(0, npack), KOKKOS_LAMBDA (const Int& k) {
+          const auto range = ekat::range<Spack>(k*Spack::n);
+          const auto depth = kdir == -1 ? range : Spack(nk-1) - range;
+          const auto falls = kdir == -1 ? (range >= k_qxtop && range <= k_qxbot) :
+                                          (range <= k_qxtop && range >= k_qxbot);
+          rho(k) = 1 + depth/nk;
+          inv_rho(k) = 1 / rho(k);
+          inv_dz(k) = 1 / (min_dz*(1 + 3*(1 - depth/nk)));
+          for (Int i = 0; i < nfield; ++i) {
+            r[i](k) = (1 + i) * 1e-3 * (1 + sin(depth));
+            V[i](k) = 0;
+            V[i](k).set(falls, (1 + 0.5*i) * max_speed * (2 + cos(depth))/4);
+          }
+        });
+
+        const auto sr0 = scalarize(r[0]), sr1 = scalarize(r[1]);
+        const auto get_masses = [&] () {
+          const auto rho_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), scalarize(rho));
+          const auto inv_dz_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), scalarize(inv_dz));
+          std::array<std::vector<Scalar>, nfield> m;
+          for (Int i = 0; i < nfield; ++i) {
+            const auto r_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), i == 0 ? sr0 : sr1);
+            for (Int k = 0; k < nk; ++k) {
+              REQUIRE(r_h(k) >= 0);
+              m[i].push_back(r_h(k)*rho_h(k)/inv_dz_h(k));
+            }
+          }
+          return m;
+        };
+        const auto m0 = get_masses();
+
+        Kokkos::parallel_for(ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(1, npack),
+                             KOKKOS_LAMBDA (const MemberType& team) {
+          Kokkos::Array<uview_1d<Spack>, nfield> lflux, lV, lr;
+          for (Int i = 0; i < nfield; ++i) {
+            lflux[i] = flux[i];
+            lV[i]    = V[i];
+            lr[i]    = r[i];
+          }
+          Int k_qxbot_lcl = k_qxbot;
+          Scalar dt_left = dt, prt_accum = 0;
+          Functions::template semi_lagrangian_sedimentation<nfield>(
+            rho, inv_rho, inv_dz, team, nk, k_qxtop, k_qxbot_lcl, kbot, kdir, dt_left, prt_accum,
+            {&lflux[0], &lflux[1]}, {&lV[0], &lV[1]}, {&lr[0], &lr[1]});
+          Kokkos::single(Kokkos::PerTeam(team), [&] () {
+            out(0) = prt_accum;
+            out(1) = dt_left;
+            k_qxbot_out(0) = k_qxbot_lcl;
+          });
+        });
+
+        const auto m1 = get_masses();
+        const auto out_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), out);
+        const auto k_qxbot_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), k_qxbot_out);
+        REQUIRE(out_h(1) == 0);
+        REQUIRE(k_qxbot_h(0) == kbot);
+
+        for (Int i = 0; i < nfield; ++i) {
+          const auto flux_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), scalarize(flux[i]));
+
+          // The mass that left the cells above each interface must have
+          // crossed it, and what crossed the bottom interface is precip.
+          Scalar total0 = 0, lost = 0;
+          for (Int k = ktop; k != kbot - kdir; k -= kdir) {
+            total0 += m0[i][k];
+            lost   += m0[i][k] - m1[i][k];
+            REQUIRE(std::abs(lost - flux_h(k)*dt) <= 1e2*eps*total0);
+          }
+          if (i == 0) {
+            REQUIRE(std::abs(out_h(0) - lost) <= 1e2*eps*total0);
+          }
+
+          // Beyond the column depth, all falling mass must have reached the ground.
+          if (max_speed/4*dt > nk*4*min_dz) {
+            Scalar falling = 0;
+            for (Int k = k_qxtop; k != k_qxbot - kdir; k -= kdir) {
+              falling += m0[i][k];
+            }
+            REQUIRE(std::abs(lost - falling) <= 1e2*eps*total0);
+          }
+        }
+      }
+    }
+  }
+}
+
+};
+
 }
 }
 }
@@ -372,4 +499,11 @@ TEST_CASE("p3_gen_sed", "[p3_functions]")
   TG::run_bfb();
 }
 
+TEST_CASE("p3_sl_sed", "[p3_functions]")
+{
+  using TS = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestSLSed;
+
+  TS::run_phys();
+}
+
 } // namespace
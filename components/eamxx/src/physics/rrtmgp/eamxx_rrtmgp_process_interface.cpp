@@ -815,7 +815,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         // h2o is (wet) mass mixing ratio in FM, otherwise known as "qv", which we've already read in above
         // Convert to vmr
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        Kokkos::parallel_for("RRTMGPRadiation::run_impl::h2o_vmr", policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int icol = team.league_rank();
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
             d_vmr(icol,k) = PF::calculate_vmr_from_mmr(gas_mol_weights[igas],d_qv(icol,k),d_qv(icol,k));
@@ -831,7 +831,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         // Back out volume mixing ratios
         const auto air_mol_weight = PC::MWdry;
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        Kokkos::parallel_for("RRTMGPRadiation::run_impl::gas_vmr", policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
             d_vmr(i,k) = air_mol_weight / gas_mol_weights[igas] * d_vmr(i,k);
@@ -1049,7 +1049,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         Kokkos::deep_copy(d_mu0,h_mu0);
 
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        Kokkos::parallel_for("RRTMGPRadiation::run_impl::prepare_state", policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
           const int icol = i+beg;
 
@@ -1218,7 +1218,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
         // Copy to YAKL
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        Kokkos::parallel_for("RRTMGPRadiation::run_impl::copy_gas_vmr", policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
           const int icol = i + beg;
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
@@ -1263,7 +1263,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
 #endif
       if (not do_subcol_sampling) {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        Kokkos::parallel_for("RRTMGPRadiation::run_impl::cldfrac_binary", policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
           const int icol = i + beg;
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
@@ -1287,7 +1287,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         });
       } else {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        Kokkos::parallel_for("RRTMGPRadiation::run_impl::cldfrac_copy", policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
           const int icol = i + beg;
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
@@ -1320,7 +1320,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       // Convert to g/m2 (needed by RRTMGP)
       {
       const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      Kokkos::parallel_for("RRTMGPRadiation::run_impl::water_path_to_g_per_m2", policy, KOKKOS_LAMBDA(const MemberType& team) {
         const int i = team.league_rank();
         Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
           // Note that for YAKL arrays i and k start with index 1
@@ -1437,7 +1437,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       );
       {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        Kokkos::parallel_for("RRTMGPRadiation::run_impl::net_heating_yakl", policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int idx = team.league_rank();
           const int icol = idx+beg;
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& ilay) {
@@ -1460,7 +1460,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       );
       {
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        Kokkos::parallel_for("RRTMGPRadiation::run_impl::net_heating", policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int idx = team.league_rank();
           const int icol = idx+beg;
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& ilay) {
@@ -1480,7 +1480,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       const int kbot = nlay+1;
 
       // Compute diffuse flux as difference between total and direct
-      Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,nswbands*(nlay+1)*ncol),
+      Kokkos::parallel_for("RRTMGPRadiation::run_impl::diffuse_flux_yakl", Kokkos::RangePolicy<ExeSpace>(0,nswbands*(nlay+1)*ncol),
                            KOKKOS_LAMBDA (const int idx) {
         // CAREFUL: these are YAKL arrays, with "LayoutLeft". So make the indices stride accordingly, and add 1.
         const int ibnd = (idx / ncol) / (nlay+1) + 1;
@@ -1500,7 +1500,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       const int kbot_k = nlay;
 
       // Compute diffuse flux as difference between total and direct
-      Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,nswbands*(nlay+1)*ncol),
+      Kokkos::parallel_for("RRTMGPRadiation::run_impl::diffuse_flux", Kokkos::RangePolicy<ExeSpace>(0,nswbands*(nlay+1)*ncol),
                            KOKKOS_LAMBDA (const int idx) {
         // CAREFUL: these are YAKL arrays, with "LayoutLeft". So make the indices stride accordingly, and add 1.
         const int ibnd = (idx / ncol) / (nlay+1);
@@ -1611,7 +1611,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       // Copy output data back to FieldManager
       const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
 #ifdef RRTMGP_ENABLE_YAKL
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      Kokkos::parallel_for("RRTMGPRadiation::run_impl::copy_outputs_yakl", policy, KOKKOS_LAMBDA(const MemberType& team) {
         const int i = team.league_rank();
         const int icol = i + beg;
         d_sfc_flux_dir_nir(icol) = sfc_flux_dir_nir(i+1);
@@ -1655,7 +1655,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       });
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      Kokkos::parallel_for("RRTMGPRadiation::run_impl::copy_outputs", policy, KOKKOS_LAMBDA(const MemberType& team) {
         const int i = team.league_rank();
         const int icol = i + beg;
         d_sfc_flux_dir_nir(icol) = sfc_flux_dir_nir_k(i);
@@ -1723,7 +1723,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
   const int ncols = m_ncol;
   const int nlays = m_nlay;
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, nlays);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+  Kokkos::parallel_for("RRTMGPRadiation::run_impl::update_tmid", policy, KOKKOS_LAMBDA(const MemberType& team) {
     const int i = team.league_rank();
     Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlays), [&] (const int& k) {
       if (update_rad) {
@@ -1747,7 +1747,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
     const int ncols = m_ncol;
     const int nlays = m_nlay;
     const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, nlays);
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    Kokkos::parallel_for("RRTMGPRadiation::run_impl::boundary_fluxes", policy, KOKKOS_LAMBDA(const MemberType& team) {
       const int icol = team.league_rank();
 
       vapor_flux(icol) = 0;
@@ -59,7 +59,7 @@ void compute_heating_rate (
   using physconst = scream::physics::Constants<Real>;
   auto ncol = flux_up.extent(0);
   auto nlay = flux_up.extent(1)-1;
-  Kokkos::parallel_for(conv::get_mdrp<2>({nlay,ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::compute_heating_rate", conv::get_mdrp<2>({nlay,ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
     heating_rate(icol,ilay) = (
       flux_up(icol,ilay+1) - flux_up(icol,ilay) -
       flux_dn(icol,ilay+1) + flux_dn(icol,ilay)
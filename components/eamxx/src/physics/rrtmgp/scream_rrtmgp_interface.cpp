@@ -259,7 +259,7 @@ OpticalProps2strK get_subsampled_clouds(
   // even when separated by layers with no cloud properties, when in fact those layers should be
   // randomly overlapped.
   auto cldfrac_rad = real2dk("cldfrac_rad", ncol, nlay);
-  Kokkos::parallel_for(conv::get_mdrp<3>({nbnd,nlay,ncol}), KOKKOS_LAMBDA (int ibnd, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::get_subsampled_clouds::sw_cldfrac_rad", conv::get_mdrp<3>({nbnd,nlay,ncol}), KOKKOS_LAMBDA (int ibnd, int ilay, int icol) {
     if (cloud_optics.tau(icol,ilay,ibnd) > 0) {
       cldfrac_rad(icol,ilay) = cld(icol,ilay);
     }
@@ -273,13 +273,13 @@ OpticalProps2strK get_subsampled_clouds(
   // Get unique seeds for each column that are reproducible across different MPI rank layouts;
   // use decimal part of pressure for this, consistent with the implementation in EAM
   auto seeds = int1dk("seeds", ncol);
-  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+  Kokkos::parallel_for("rrtmgp::get_subsampled_clouds::sw_seeds", ncol, KOKKOS_LAMBDA(int icol) {
     seeds(icol) = 1e9 * (p_lay(icol,nlay-1) - int(p_lay(icol,nlay-1)));
   });
   auto cldmask = get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
   // Assign optical properties to subcolumns (note this implements MCICA)
   auto gpoint_bands = kdist.get_gpoint_bands();
-  Kokkos::parallel_for(conv::get_mdrp<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::get_subsampled_clouds::sw_subsample", conv::get_mdrp<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
     auto ibnd = gpoint_bands(igpt);
     if (cldmask(icol,ilay,igpt) == 1) {
       subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
@@ -356,7 +356,7 @@ OpticalProps1sclK get_subsampled_clouds(
   // even when separated by layers with no cloud properties, when in fact those layers should be
   // randomly overlapped.
   auto cldfrac_rad = real2dk("cldfrac_rad", ncol, nlay);
-  Kokkos::parallel_for(conv::get_mdrp<3>({nbnd,nlay,ncol}), KOKKOS_LAMBDA (int ibnd, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::get_subsampled_clouds::lw_cldfrac_rad", conv::get_mdrp<3>({nbnd,nlay,ncol}), KOKKOS_LAMBDA (int ibnd, int ilay, int icol) {
     if (cloud_optics.tau(icol,ilay,ibnd) > 0) {
       cldfrac_rad(icol,ilay) = cld(icol,ilay);
     }
@@ -367,13 +367,13 @@ OpticalProps1sclK get_subsampled_clouds(
   // use decimal part of pressure for this, consistent with the implementation in EAM; use different
   // seed values for longwave and shortwave
   auto seeds = int1dk("seeds", ncol);
-  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+  Kokkos::parallel_for("rrtmgp::get_subsampled_clouds::lw_seeds", ncol, KOKKOS_LAMBDA(int icol) {
     seeds(icol) = 1e9 * (p_lay(icol,nlay-2) - int(p_lay(icol,nlay-2)));
   });
   auto cldmask = get_subcolumn_mask(ncol, nlay, ngpt, cldfrac_rad, overlap, seeds);
   // Assign optical properties to subcolumns (note this implements MCICA)
   auto gpoint_bands = kdist.get_gpoint_bands();
-  Kokkos::parallel_for(conv::get_mdrp<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::get_subsampled_clouds::lw_subsample", conv::get_mdrp<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
       auto ibnd = gpoint_bands(igpt);
       if (cldmask(icol,ilay,igpt) == 1) {
         subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
@@ -545,7 +545,7 @@ void compute_band_by_band_surface_albedos(
 
   // Loop over bands, and determine for each band whether it is broadly in the
   // visible or infrared part of the spectrum (visible or "not visible")
-  Kokkos::parallel_for(conv::get_mdrp<2>({nswbands, ncol}), KOKKOS_LAMBDA(const int ibnd, const int icol) {
+  Kokkos::parallel_for("rrtmgp::compute_band_by_band_surface_albedos", conv::get_mdrp<2>({nswbands, ncol}), KOKKOS_LAMBDA(const int ibnd, const int icol) {
 
     // Threshold between visible and infrared is 0.7 micron, or 14286 cm^-1.
     const real visible_wavenumber_threshold = 14286;
@@ -656,7 +656,7 @@ void compute_broadband_surface_fluxes(
   // Threshold between visible and infrared is 0.7 micron, or 14286 cm^-1.
   const real visible_wavenumber_threshold = 14286;
   auto wavenumber_limits = k_dist_sw_k.get_band_lims_wavenumber();
-  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(const int icol) {
+  Kokkos::parallel_for("rrtmgp::compute_broadband_surface_fluxes", ncol, KOKKOS_LAMBDA(const int icol) {
     for (int ibnd = 0; ibnd < nswbands; ++ibnd) {
       // Wavenumber is in the visible if it is above the visible wavenumber
       // threshold, and in the infrared if it is below the threshold
@@ -947,14 +947,14 @@ void rrtmgp_main(
   OpticalProps1sclK aerosol_lw;
   aerosol_sw.init(k_dist_sw_k.get_band_lims_wavenumber());
   aerosol_sw.alloc_2str(ncol, nlay);
-  Kokkos::parallel_for(conv::get_mdrp<3>({nswbands,nlay,ncol}) , KOKKOS_LAMBDA (int ibnd, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_main::copy_aerosol_sw", conv::get_mdrp<3>({nswbands,nlay,ncol}) , KOKKOS_LAMBDA (int ibnd, int ilay, int icol) {
     aerosol_sw.tau(icol,ilay,ibnd) = aer_tau_sw(icol,ilay,ibnd);
     aerosol_sw.ssa(icol,ilay,ibnd) = aer_ssa_sw(icol,ilay,ibnd);
     aerosol_sw.g  (icol,ilay,ibnd) = aer_asm_sw(icol,ilay,ibnd);
   });
   aerosol_lw.init(k_dist_lw_k.get_band_lims_wavenumber());
   aerosol_lw.alloc_1scl(ncol, nlay);
-  Kokkos::parallel_for(conv::get_mdrp<3>({nlwbands,nlay,ncol}) , KOKKOS_LAMBDA (int ibnd, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_main::copy_aerosol_lw", conv::get_mdrp<3>({nlwbands,nlay,ncol}) , KOKKOS_LAMBDA (int ibnd, int ilay, int icol) {
     aerosol_lw.tau(icol,ilay,ibnd) = aer_tau_lw(icol,ilay,ibnd);
   });
 
@@ -985,10 +985,10 @@ void rrtmgp_main(
 
   // Copy cloud properties to outputs (is this needed, or can we just use pointers?)
   // Alternatively, just compute and output a subcolumn cloud mask
-  Kokkos::parallel_for(conv::get_mdrp<3>({nswgpts, nlay, ncol}), KOKKOS_LAMBDA (int igpt, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_main::copy_cld_tau_sw", conv::get_mdrp<3>({nswgpts, nlay, ncol}), KOKKOS_LAMBDA (int igpt, int ilay, int icol) {
     cld_tau_sw_gpt(icol,ilay,igpt) = clouds_sw_gpt.tau(icol,ilay,igpt);
   });
-  Kokkos::parallel_for(conv::get_mdrp<3>({nlwgpts, nlay, ncol}), KOKKOS_LAMBDA (int igpt, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_main::copy_cld_tau_lw", conv::get_mdrp<3>({nlwgpts, nlay, ncol}), KOKKOS_LAMBDA (int igpt, int ilay, int icol) {
     cld_tau_lw_gpt(icol,ilay,igpt) = clouds_lw_gpt.tau(icol,ilay,igpt);
   });
 
@@ -1126,7 +1126,7 @@ int3dk get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d
     //     random_pool.free_state(generator);
     //   });
     // }
-    Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+    Kokkos::parallel_for("rrtmgp::get_subcolumn_mask::fill_cldx", ncol, KOKKOS_LAMBDA(int icol) {
       conv::Random rand(seeds(icol));
       for (int igpt = 0; igpt < ngpt; igpt++) {
         for (int ilay = 0; ilay < nlay; ilay++) {
@@ -1136,7 +1136,7 @@ int3dk get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d
     });
 
     // Step down columns and apply algorithm from eq (14)
-    Kokkos::parallel_for(conv::get_mdrp<2>({ngpt,ncol}), KOKKOS_LAMBDA(int igpt, int icol) {
+    Kokkos::parallel_for("rrtmgp::get_subcolumn_mask::max_random_overlap", conv::get_mdrp<2>({ngpt,ncol}), KOKKOS_LAMBDA(int igpt, int icol) {
       for (int ilay = 1; ilay < nlay; ilay++) {
         // Check cldx in level above and see if it satisfies conditions to create a cloudy subcolumn
         if (cldx(icol,ilay-1,igpt) > 1.0 - cldf(icol,ilay-1)) {
@@ -1156,7 +1156,7 @@ int3dk get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d
   }
 
   // Use cldx array to create subcolumn mask
-  Kokkos::parallel_for(conv::get_mdrp<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::get_subcolumn_mask::set_mask", conv::get_mdrp<3>({ngpt,nlay,ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
     if (cldx(icol,ilay,igpt) > 1.0 - cldf(icol,ilay)) {
       subcolumn_mask(icol,ilay,igpt) = 1;
     } else {
@@ -1460,7 +1460,7 @@ void rrtmgp_sw(
   auto &clnsky_flux_dn_dir = clnsky_fluxes.flux_dn_dir;
 
   // Reset fluxes to zero
-  Kokkos::parallel_for(conv::get_mdrp<2>({nlay+1,ncol}), KOKKOS_LAMBDA(int ilev, int icol) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::reset_fluxes", conv::get_mdrp<2>({nlay+1,ncol}), KOKKOS_LAMBDA(int ilev, int icol) {
     flux_up    (icol,ilev) = 0;
     flux_dn    (icol,ilev) = 0;
     flux_dn_dir(icol,ilev) = 0;
@@ -1474,7 +1474,7 @@ void rrtmgp_sw(
     clnsky_flux_dn    (icol,ilev) = 0;
     clnsky_flux_dn_dir(icol,ilev) = 0;
   });
-  Kokkos::parallel_for(conv::get_mdrp<3>({nbnd,nlay+1,ncol}), KOKKOS_LAMBDA(int ibnd, int ilev, int icol) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::reset_bnd_fluxes", conv::get_mdrp<3>({nbnd,nlay+1,ncol}), KOKKOS_LAMBDA(int ibnd, int ilev, int icol) {
     bnd_flux_up    (icol,ilev,ibnd) = 0;
     bnd_flux_dn    (icol,ilev,ibnd) = 0;
     bnd_flux_dn_dir(icol,ilev,ibnd) = 0;
@@ -1486,7 +1486,7 @@ void rrtmgp_sw(
 
   int nday = 0;
   // Serialized for now.
-  Kokkos::parallel_reduce(1, KOKKOS_LAMBDA(int, int& nday_inner) {
+  Kokkos::parallel_reduce("rrtmgp::rrtmgp_sw::find_day_cols", 1, KOKKOS_LAMBDA(int, int& nday_inner) {
     for (int icol = 0; icol < ncol; ++icol) {
       if (mu0(icol) > 0) {
         dayIndices(nday_inner++) = icol;
@@ -1501,20 +1501,20 @@ void rrtmgp_sw(
 
   // Subset mu0
   auto mu0_day = real1dk("mu0_day", nday);
-  Kokkos::parallel_for(nday, KOKKOS_LAMBDA(int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::subset_mu0", nday, KOKKOS_LAMBDA(int iday) {
       mu0_day(iday) = mu0(dayIndices(iday));
   });
 
   // subset state variables
   auto p_lay_day = real2dk("p_lay_day", nday, nlay);
   auto t_lay_day = real2dk("t_lay_day", nday, nlay);
-  Kokkos::parallel_for(conv::get_mdrp<2>({nlay,nday}), KOKKOS_LAMBDA(int ilay, int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::subset_lay_state", conv::get_mdrp<2>({nlay,nday}), KOKKOS_LAMBDA(int ilay, int iday) {
     p_lay_day(iday,ilay) = p_lay(dayIndices(iday),ilay);
     t_lay_day(iday,ilay) = t_lay(dayIndices(iday),ilay);
   });
   auto p_lev_day = real2dk("p_lev_day", nday, nlay+1);
   auto t_lev_day = real2dk("t_lev_day", nday, nlay+1);
-  Kokkos::parallel_for(conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::subset_lev_state", conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
     p_lev_day(iday,ilev) = p_lev(dayIndices(iday),ilev);
     t_lev_day(iday,ilev) = t_lev(dayIndices(iday),ilev);
   });
@@ -1527,7 +1527,7 @@ void rrtmgp_sw(
     auto vmr_day = real2dk("vmr_day", nday, nlay);
     auto vmr     = real2dk("vmr"    , ncol, nlay);
     gas_concs.get_vmr(gas_names[igas], vmr);
-    Kokkos::parallel_for(conv::get_mdrp<2>({nlay,nday}), KOKKOS_LAMBDA(int ilay, int iday) {
+    Kokkos::parallel_for("rrtmgp::rrtmgp_sw::subset_vmr", conv::get_mdrp<2>({nlay,nday}), KOKKOS_LAMBDA(int ilay, int iday) {
       vmr_day(iday,ilay) = vmr(dayIndices(iday),ilay);
     });
     gas_concs_day.set_vmr(gas_names[igas], vmr_day);
@@ -1537,7 +1537,7 @@ void rrtmgp_sw(
   OpticalProps2strK aerosol_day;
   aerosol_day.init(k_dist.get_band_lims_wavenumber());
   aerosol_day.alloc_2str(nday, nlay);
-  Kokkos::parallel_for(conv::get_mdrp<3>({nbnd,nlay,nday}), KOKKOS_LAMBDA(int ibnd, int ilay, int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::subset_aerosol", conv::get_mdrp<3>({nbnd,nlay,nday}), KOKKOS_LAMBDA(int ibnd, int ilay, int iday) {
     aerosol_day.tau(iday,ilay,ibnd) = aerosol.tau(dayIndices(iday),ilay,ibnd);
     aerosol_day.ssa(iday,ilay,ibnd) = aerosol.ssa(dayIndices(iday),ilay,ibnd);
     aerosol_day.g  (iday,ilay,ibnd) = aerosol.g  (dayIndices(iday),ilay,ibnd);
@@ -1548,7 +1548,7 @@ void rrtmgp_sw(
   OpticalProps2strK clouds_day;
   clouds_day.init(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint());
   clouds_day.alloc_2str(nday, nlay);
-  Kokkos::parallel_for(conv::get_mdrp<3>({ngpt,nlay,nday}), KOKKOS_LAMBDA(int igpt, int ilay, int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::subset_clouds", conv::get_mdrp<3>({ngpt,nlay,nday}), KOKKOS_LAMBDA(int igpt, int ilay, int iday) {
     clouds_day.tau(iday,ilay,igpt) = clouds.tau(dayIndices(iday),ilay,igpt);
     clouds_day.ssa(iday,ilay,igpt) = clouds.ssa(dayIndices(iday),ilay,igpt);
     clouds_day.g  (iday,ilay,igpt) = clouds.g  (dayIndices(iday),ilay,igpt);
@@ -1559,7 +1559,7 @@ void rrtmgp_sw(
   // daytime subsetting in the same kernel
   real2dk sfc_alb_dir_T("sfc_alb_dir", nbnd, nday);
   real2dk sfc_alb_dif_T("sfc_alb_dif", nbnd, nday);
-  Kokkos::parallel_for(conv::get_mdrp<2>({nbnd,nday}), KOKKOS_LAMBDA(int ibnd, int icol) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::subset_sfc_alb", conv::get_mdrp<2>({nbnd,nday}), KOKKOS_LAMBDA(int ibnd, int icol) {
     sfc_alb_dir_T(ibnd,icol) = sfc_alb_dir(dayIndices(icol),ibnd);
     sfc_alb_dif_T(ibnd,icol) = sfc_alb_dif(dayIndices(icol),ibnd);
   });
@@ -1596,7 +1596,7 @@ void rrtmgp_sw(
   // Do gas optics
   real2dk toa_flux("toa_flux", nday, ngpt);
   bool top_at_1 = false;
-  Kokkos::parallel_reduce(1, KOKKOS_LAMBDA(int, bool& val) {
+  Kokkos::parallel_reduce("rrtmgp::rrtmgp_sw::top_at_1", 1, KOKKOS_LAMBDA(int, bool& val) {
     val |= p_lay(0, 0) < p_lay(0, nlay-1);
   }, Kokkos::LOr<bool>(top_at_1));
 
@@ -1615,7 +1615,7 @@ void rrtmgp_sw(
 #endif
 
   // Apply tsi_scaling
-  Kokkos::parallel_for(conv::get_mdrp<2>({ngpt,nday}), KOKKOS_LAMBDA(int igpt, int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::tsi_scaling", conv::get_mdrp<2>({ngpt,nday}), KOKKOS_LAMBDA(int igpt, int iday) {
     toa_flux(iday,igpt) = tsi_scaling * toa_flux(iday,igpt);
   });
 
@@ -1623,7 +1623,7 @@ void rrtmgp_sw(
     // Compute clear-clean-sky (just gas) fluxes on daytime columns
     rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
     // Expand daytime fluxes to all columns
-    Kokkos::parallel_for(conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
+    Kokkos::parallel_for("rrtmgp::rrtmgp_sw::expand_clnclrsky_fluxes", conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
       const int icol = dayIndices(iday);
       clnclrsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
       clnclrsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
@@ -1639,7 +1639,7 @@ void rrtmgp_sw(
   rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
 
   // Expand daytime fluxes to all columns
-  Kokkos::parallel_for(conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::expand_clrsky_fluxes", conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
     const int icol = dayIndices(iday);
     clrsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
     clrsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
@@ -1654,13 +1654,13 @@ void rrtmgp_sw(
   // Compute fluxes on daytime columns
   rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
   // Expand daytime fluxes to all columns
-  Kokkos::parallel_for(conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::expand_fluxes", conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
     const int icol = dayIndices(iday);
     flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
     flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
     flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
   });
-  Kokkos::parallel_for(conv::get_mdrp<3>({nbnd,nlay+1,nday}), KOKKOS_LAMBDA(int ibnd, int ilev, int iday) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_sw::expand_bnd_fluxes", conv::get_mdrp<3>({nbnd,nlay+1,nday}), KOKKOS_LAMBDA(int ibnd, int ilev, int iday) {
     const int icol = dayIndices(iday);
     bnd_flux_up    (icol,ilev,ibnd) = bnd_flux_up_day    (iday,ilev,ibnd);
     bnd_flux_dn    (icol,ilev,ibnd) = bnd_flux_dn_day    (iday,ilev,ibnd);
@@ -1673,7 +1673,7 @@ void rrtmgp_sw(
     // Compute cleansky (gas + clouds) fluxes on daytime columns
     rte_sw(optics_no_aerosols, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
     // Expand daytime fluxes to all columns
-    Kokkos::parallel_for(conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
+    Kokkos::parallel_for("rrtmgp::rrtmgp_sw::expand_clnsky_fluxes", conv::get_mdrp<2>({nlay+1,nday}), KOKKOS_LAMBDA(int ilev, int iday) {
       const int icol = dayIndices(iday);
       clnsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
       clnsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
@@ -1844,7 +1844,7 @@ void rrtmgp_lw(
   auto &clnsky_flux_dn    = clnsky_fluxes.flux_dn;
 
   // Reset fluxes to zero
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("rrtmgp::rrtmgp_lw::reset_fluxes",
     conv::get_mdrp<2>({nlay + 1, ncol}), KOKKOS_LAMBDA(int ilev, int icol) {
       flux_up(icol, ilev)           = 0;
       flux_dn(icol, ilev)           = 0;
@@ -1855,7 +1855,7 @@ void rrtmgp_lw(
       clnsky_flux_up(icol, ilev)    = 0;
       clnsky_flux_dn(icol, ilev)    = 0;
     });
-  Kokkos::parallel_for(
+  Kokkos::parallel_for("rrtmgp::rrtmgp_lw::reset_bnd_fluxes",
     conv::get_mdrp<3>({nbnd, nlay + 1, ncol}),
     KOKKOS_LAMBDA(int ibnd, int ilev, int icol) {
       bnd_flux_up(icol, ilev, ibnd) = 0;
@@ -1878,12 +1878,12 @@ void rrtmgp_lw(
   real2dk emis_sfc("emis_sfc",nbnd,ncol);
 
   bool top_at_1 = false;
-  Kokkos::parallel_reduce(1, KOKKOS_LAMBDA(int, bool& val) {
+  Kokkos::parallel_reduce("rrtmgp::rrtmgp_lw::top_at_1", 1, KOKKOS_LAMBDA(int, bool& val) {
     val |= p_lay(0, 0) < p_lay(0, nlay-1);
   }, Kokkos::LOr<bool>(top_at_1));
 
   // Surface temperature
-  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+  Kokkos::parallel_for("rrtmgp::rrtmgp_lw::t_sfc", ncol, KOKKOS_LAMBDA(int icol) {
     t_sfc(icol) = t_lev(icol, conv::merge(nlay, 0, top_at_1));
   });
   Kokkos::deep_copy(emis_sfc , 0.98);
@@ -1989,7 +1989,7 @@ void compute_cloud_area(
   // Subcolumn binary cld mask; if any layers with pressure between pmin and pmax are cloudy
   // then 2d subcol mask is 1, otherwise it is 0
   auto subcol_mask = real2dk("subcol_mask", ncol, ngpt);
-  Kokkos::parallel_for(conv::get_mdrp<3>({ngpt, nlay, ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::compute_cloud_area::subcol_mask", conv::get_mdrp<3>({ngpt, nlay, ncol}), KOKKOS_LAMBDA(int igpt, int ilay, int icol) {
     // NOTE: using plev would need to assume level ordering (top to bottom or bottom to top), but
     // using play/pmid does not
     if (cld_tau_gpt(icol,ilay,igpt) > 0 && pmid(icol,ilay) >= pmin && pmid(icol,ilay) < pmax) {
@@ -1999,7 +1999,7 @@ void compute_cloud_area(
   // Compute average over subcols to get cloud area
   auto ngpt_inv = 1.0 / ngpt;
   Kokkos::deep_copy(cld_area, 0);
-  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+  Kokkos::parallel_for("rrtmgp::compute_cloud_area::average", ncol, KOKKOS_LAMBDA(int icol) {
     // This loop needs to be serial because of the atomic reduction
     for (int igpt = 0; igpt < ngpt; ++igpt) {
       cld_area(icol) += subcol_mask(icol,igpt) * ngpt_inv;
@@ -2054,7 +2054,7 @@ int get_wavelength_index(OpticalPropsK &kdist, double wavelength) {
   // in units of meters, we need a conversion factor of 10^2
   const int nbnds = kdist.get_nband();
   int band_index = -1;
-  Kokkos::parallel_reduce(nbnds, KOKKOS_LAMBDA(int ibnd, int& band_index_inner) {
+  Kokkos::parallel_reduce("rrtmgp::get_wavelength_index", nbnds, KOKKOS_LAMBDA(int ibnd, int& band_index_inner) {
     if (wavelength_bounds(0,ibnd) < wavelength_bounds(1,ibnd)) {
       if (wavelength_bounds(0,ibnd) <= wavelength * 1e2 && wavelength * 1e2 <= wavelength_bounds(1,ibnd)) {
         band_index_inner = ibnd;
@@ -2207,7 +2207,7 @@ void compute_aerocom_cloudtop(
   constexpr real cldfrac_tot_threshold = 0.001;  // BAD_CONSTANT!
 
   // Loop over all columns in parallel
-  Kokkos::parallel_for(ncol, KOKKOS_LAMBDA(int icol) {
+  Kokkos::parallel_for("rrtmgp::compute_aerocom_cloudtop", ncol, KOKKOS_LAMBDA(int icol) {
     // Loop over all layers in serial (due to accumulative
     // product), starting at 2 (second highest) layer because the
     // highest is assumed to hav no clouds
@@ -315,7 +315,7 @@ void mixing_ratio_to_cloud_mass(
   int ncol = mixing_ratio.extent(0);
   int nlay = mixing_ratio.extent(1);
   using physconst = scream::physics::Constants<Real>;
-  Kokkos::parallel_for(conv::get_mdrp<2>({nlay, ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
+  Kokkos::parallel_for("rrtmgp::mixing_ratio_to_cloud_mass", conv::get_mdrp<2>({nlay, ncol}), KOKKOS_LAMBDA(int ilay, int icol) {
     // Compute in-cloud mixing ratio (mixing ratio of the cloudy part of the layer)
     // NOTE: these thresholds (from E3SM) seem arbitrary, but included here for consistency
     // This limits in-cloud mixing ratio to 0.005 kg/kg. According to note in cloud_diagnostics
@@ -348,7 +348,7 @@ void limit_to_bounds(S const &arr_in, T const lower, T const upper, S &arr_out)
 #ifdef RRTMGP_ENABLE_KOKKOS
 template<class S, class T>
 void limit_to_bounds_k(S const &arr_in, T const lower, T const upper, S &arr_out) {
-  Kokkos::parallel_for(arr_in.size(), KOKKOS_LAMBDA(int i) {
+  Kokkos::parallel_for("rrtmgp::limit_to_bounds_k", arr_in.size(), KOKKOS_LAMBDA(int i) {
     arr_out.data()[i] = std::min(std::max(arr_in.data()[i], lower), upper);
   });
 }
@@ -138,6 +138,7 @@ struct P3_Constants
   Scalar p3_dep_nucleation_exponent   = 0.304;
   Scalar p3_ice_sed_knob              = 1.0;
   Scalar p3_d_breakup_cutoff          = 0.00028;
+  bool   p3_tabulated_svp             = false; // use MurphyKoopTable in p3_main_part1
 
   void set_p3_from_namelist(ekat::ParameterList &params){
 
@@ -189,6 +190,10 @@ struct P3_Constants
     if(params.isParameter(nname))
        p3_d_breakup_cutoff = params.get<double>(nname);
 
+    nname = "p3_tabulated_svp";
+    if(params.isParameter(nname))
+       p3_tabulated_svp = params.get<bool>(nname);
+
   };
 
   void print_p3constants(std::shared_ptr<ekat::logger::LoggerBase> logger){
@@ -230,6 +235,9 @@ struct P3_Constants
       nname = "p3_d_breakup_cutoff";
       logger->info(std::string("P3   ") + nname + std::string(" = ") + std::to_string(p3_d_breakup_cutoff));
 
+      nname = "p3_tabulated_svp";
+      logger->info(std::string("P3   ") + nname + std::string(" = ") + (p3_tabulated_svp ? "true" : "false"));
+
       logger->info(" ");
   };
 
@@ -24,7 +24,7 @@ template <typename ScalarT, typename DeviceT>
 struct Functions
 {
 
-  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1};
+  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1, MurphyKoopTable = 2};
 
   //
   // ------- Types --------
@@ -92,6 +92,12 @@ struct Functions
   KOKKOS_FUNCTION
   static Spack MurphyKoop_svp(const Spack& t, const bool ice, const Smask& range_mask, const char* caller=nullptr);
 
+  //  same as MurphyKoop_svp, but interpolating a precomputed table (see
+  //  physics_saturation_table.hpp for the max relative error). Temperatures
+  //  outside of the table range fall back to MurphyKoop_svp.
+  KOKKOS_FUNCTION
+  static Spack MurphyKoop_svp_table(const Spack& t, const bool ice, const Smask& range_mask, const char* caller=nullptr);
+
   // Calls a function to obtain the saturation vapor pressure, and then computes
   // and returns the dry saturation mixing ratio, with respect to either liquid or ice,
   // depending on value of 'ice'
@@ -2,6 +2,7 @@
 #define PHYSICS_SATURATION_IMPL_HPP
 
 #include "physics_functions.hpp" // for ETI only but harmless for GPU
+#include "physics_saturation_table.hpp"
 
 namespace scream {
 namespace physics {
@@ -81,6 +82,53 @@ Functions<S,D>::MurphyKoop_svp(const Spack& t_atm, const bool ice, const Smask&
   return result;
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Spack
+Functions<S,D>::MurphyKoop_svp_table(const Spack& t_atm, const bool ice, const Smask& range_mask, const char* caller)
+{
+  //First check if the temperature is legitimate or not
+  check_temperature(t_atm, caller ? caller : "MurphyKoop_svp_table", range_mask);
+
+  using Table = MurphyKoopSvpTable;
+  static constexpr  auto tmelt = C::Tmelt;
+  static constexpr Scalar t_first = Table::t_first;
+  static constexpr Scalar inv_dt  = 1/Table::dt;
+  static constexpr Scalar t_min   = Table::t_min;
+  static constexpr Scalar t_max   = Table::t_max;
+  static constexpr int    jmax    = Table::size - 3;
+
+  const Smask ice_mask = (t_atm < tmelt) && ice;
+  const Smask in_table = (t_atm >= t_min) && (t_atm <= t_max);
+  const Scalar* ice_svp = Table::data<Scalar>(true);
+  const Scalar* liq_svp = Table::data<Scalar>(false);
+
+  // Cubic Lagrange interpolation on the 4 nodes surrounding t_atm. The table
+  // has one extra node on each side of [t_min,t_max], so that j-1 and j+2 are
+  // always valid indices.
+  Spack result;
+  for (int s=0; s<Spack::n; ++s) {
+    if (in_table[s]) {
+      const Scalar x = (t_atm[s] - t_first)*inv_dt;
+      const int j = x < jmax ? static_cast<int>(x) : jmax;
+      const Scalar f = x - j;
+      const Scalar* e = (ice_mask[s] ? ice_svp : liq_svp) + (j-1);
+
+      const Scalar fp1 = f + 1, fm1 = f - 1, fm2 = f - 2;
+      result[s] = - f*fm1*fm2*e[0]/6 + fp1*fm1*fm2*e[1]/2
+                  - fp1*f*fm2*e[2]/2 + fp1*f*fm1*e[3]/6;
+    }
+  }
+
+  // Use the analytic formulas outside the table range
+  const Smask out_of_table = !in_table && range_mask;
+  if (out_of_table.any()) {
+    result.set(out_of_table, MurphyKoop_svp(t_atm, ice, range_mask, caller));
+  }
+
+  return result;
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 typename Functions<S,D>::Spack
@@ -137,7 +185,8 @@ Functions<S,D>::qv_sat_dry(const Spack& t_atm, const Spack& p_atm_dry, const boo
   func_idx is an optional argument to decide which scheme is to be called for saturation vapor pressure
   Currently default is set to "MurphyKoop_svp"
   func_idx = Polysvp1 (=0) --> polysvp1 (Flatau et al. 1992)
-  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)*/
+  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)
+  func_idx = MurphyKoopTable (=2) --> MurphyKoop_svp_table (tabulated MurphyKoop_svp)*/
 
   Spack e_pres; // saturation vapor pressure [Pa]
 
@@ -148,6 +197,9 @@ Functions<S,D>::qv_sat_dry(const Spack& t_atm, const Spack& p_atm_dry, const boo
     case MurphyKoop:
       e_pres = MurphyKoop_svp(t_atm, ice, range_mask, caller);
       break;
+    case MurphyKoopTable:
+      e_pres = MurphyKoop_svp_table(t_atm, ice, range_mask, caller);
+      break;
     default:
       EKAT_KERNEL_ERROR_MSG("Error! Invalid func_idx supplied to qv_sat_dry.");
     }
@@ -171,6 +223,7 @@ Functions<S,D>::qv_sat_wet(const Spack& t_atm, const Spack& p_atm_dry, const boo
   Currently default is set to "MurphyKoop_svp"
   func_idx = Polysvp1 (=0) --> polysvp1 (Flatau et al. 1992)
   func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)
+  func_idx = MurphyKoopTable (=2) --> MurphyKoop_svp_table (tabulated MurphyKoop_svp)
   dp_wet: pseudo_density
   dp_dry: pseudo_density_dry */
 
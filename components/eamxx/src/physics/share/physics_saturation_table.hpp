@@ -0,0 +1,588 @@
+#ifndef PHYSICS_SATURATION_TABLE_HPP
+#define PHYSICS_SATURATION_TABLE_HPP
+
+#include <Kokkos_Core.hpp>
+
+namespace scream {
+namespace physics {
+
+/*
+ * Tabulated Murphy and Koop (2005) saturation vapor pressure [Pa], over ice and
+ * over liquid, used by Functions::MurphyKoop_svp_table.
+ *
+ * The nodes are T_i = t_first + i*dt, i=0,...,size-1, and the values were
+ * computed in double precision from the same formulas used in
+ * Functions::MurphyKoop_svp. For t_min <= T <= t_max, the 4-point (cubic)
+ * Lagrange interpolant built on nodes T_(j-1),...,T_(j+2), with
+ * T_j <= T < T_(j+1), has a max relative error (w.r.t. MurphyKoop_svp) of
+ * 3.6e-07 over ice (T < Tmelt) and 3.1e-07 over liquid. The error is largest
+ * at the cold end of the table, and decreases with temperature.
+ *
+ * Temperatures outside of [t_min,t_max] are not tabulated, and must be handled
+ * with the analytic formulas.
+ *
+ * This table was generated offline; if the formulas in MurphyKoop_svp change,
+ * it must be regenerated.
+ */
+
+struct MurphyKoopSvpTable {
+  static constexpr double t_first = 149.75;  // temperature of the first node [K]
+  static constexpr double dt      = 0.25;    // node spacing [K]
+  static constexpr int    size    = 804;
+
+  // Range of temperatures where the table can be interpolated [K]
+  static constexpr double t_min = 150.0;
+  static constexpr double t_max = 350.0;
+
+  // Returns a pointer to the first node of the ice (ice=true) or liquid (ice=false) table
+  template <typename Scalar>
+  KOKKOS_INLINE_FUNCTION
+  static const Scalar* data (const bool ice) {
+    static constexpr Scalar ice_svp[size] = {
+      5.7060204436494496e-06, 6.1061006509816675e-06, 6.5327836564024757e-06,
+      6.9877401724356185e-06, 7.4727395286203634e-06, 7.9896551102150201e-06,
+      8.5404700750672804e-06, 9.1272833617215797e-06, 9.7523160023869628e-06,
+      1.0417917754970358e-05, 1.1126574068977017e-05, 1.1880913400703912e-05,
+      1.2683714893796142e-05, 1.3537916441907468e-05, 1.4446623150897926e-05,
+      1.5413116218724622e-05, 1.6440862251924569e-05, 1.7533523038364084e-05,
+      1.8694965796731100e-05, 1.9929273924074597e-05, 2.1240758263558835e-05,
+      2.2633968915488994e-05, 2.4113707615588979e-05, 2.5685040705466083e-05,
+      2.7353312721187572e-05, 2.9124160626917330e-05, 3.1003528721623132e-05,
+      3.2997684247954029e-05, 3.5113233733530619e-05, 3.7357140096059335e-05,
+      3.9736740544894619e-05, 4.2259765312927482e-05, 4.4934357253983802e-05,
+      4.7769092342241834e-05, 5.0773001111578904e-05, 5.3955591074180019e-05,
+      5.7326870159228106e-05, 6.0897371214012908e-05, 6.4678177611390079e-05,
+      6.8680950009142113e-05, 7.2917954308474779e-05, 7.7402090860629528e-05,
+      8.2146924972381684e-05, 8.7166718763050257e-05, 9.2476464427542959e-05,
+      9.8091918961954282e-05, 1.0402964041025583e-04, 1.1030702569270300e-04,
+      1.1694235007878536e-04, 1.2395480836972577e-04, 1.3136455785789638e-04,
+      1.3919276313282668e-04, 1.4746164280598028e-04, 1.5619451822894786e-04,
+      1.6541586428235806e-04, 1.7515136231540130e-04, 1.8542795531870256e-04,
+      1.9627390541606798e-04, 2.0771885376353531e-04, 2.1979388294724448e-04,
+      2.3253158197463633e-04, 2.4596611395677660e-04, 2.6013328658281462e-04,
+      2.7507062549099790e-04, 2.9081745064412349e-04, 3.0741495582090994e-04,
+      3.2490629133838291e-04, 3.4333665012428391e-04, 3.6275335726220658e-04,
+      3.8320596313638094e-04, 4.0474634030695351e-04, 4.2742878425096868e-04,
+      4.5131011810854162e-04, 4.7644980157815064e-04, 5.0291004410968343e-04,
+      5.3075592254841944e-04, 5.6005550338811977e-04, 5.9087996979631356e-04,
+      6.2330375357993410e-04, 6.5740467226479331e-04, 6.9326407146770347e-04,
+      7.3096697274561365e-04, 7.7060222711181341e-04, 8.1226267441502752e-04,
+      8.5604530878329737e-04, 9.0205145034060255e-04, 9.5038692341046463e-04,
+      1.0011622414273658e-03, 1.0544927987831806e-03, 1.1104990698429260e-03,
+      1.1693068153708684e-03, 1.2310472966151791e-03, 1.2958574973068262e-03,
+      1.3638803538357964e-03, 1.4352649938752134e-03, 1.5101669837323218e-03,
+      1.5887485847128017e-03, 1.6711790187935636e-03, 1.7576347439074950e-03,
+      1.8482997391523071e-03, 1.9433658002446566e-03, 2.0430328455494869e-03,
+      2.1475092330243699e-03, 2.2570120884278563e-03, 2.3717676451503735e-03,
+      2.4920115960370966e-03, 2.6179894575812730e-03, 2.7499569468778613e-03,
+      2.8881803717380390e-03, 3.0329370343752087e-03, 3.1845156490856782e-03,
+      3.3432167743575308e-03, 3.5093532598535425e-03, 3.6832507087262239e-03,
+      3.8652479557342362e-03, 4.0556975616436010e-03, 4.2549663244087644e-03,
+      4.4634358076417451e-03, 4.6815028868919676e-03, 4.9095803142719203e-03,
+      5.1480973019785107e-03, 5.3975001252742974e-03, 5.6582527455066511e-03,
+      5.9308374537589701e-03, 6.2157555357426585e-03, 6.5135279585536348e-03,
+      6.8246960799348893e-03, 7.1498223806999188e-03, 7.4894912209922211e-03,
+      7.8443096210690979e-03, 8.2149080673180903e-03, 8.6019413442309459e-03,
+      9.0060893930778985e-03, 9.4280581980437476e-03, 9.8685807006062085e-03,
+      1.0328417742954942e-02, 1.0808359041270813e-02, 1.1309224189704325e-02,
+      1.1831863695910416e-02, 1.2377160049022234e-02, 1.2946028820961564e-02,
+      1.3539419802010670e-02, 1.4158318171588351e-02, 1.4803745705197088e-02,
+      1.5476762018531976e-02, 1.6178465849761653e-02, 1.6909996381019893e-02,
+      1.7672534600167416e-02, 1.8467304703908463e-02, 1.9295575543373279e-02,
+      2.0158662113301425e-02, 2.1057927085988085e-02, 2.1994782391180051e-02,
+      2.2970690843138856e-02, 2.3987167816111675e-02, 2.5045782969480644e-02,
+      2.6148162023890340e-02, 2.7295988589680711e-02, 2.8491006048982172e-02,
+      2.9735019492862353e-02, 3.1029897714939789e-02, 3.2377575262915653e-02,
+      3.3780054549501976e-02, 3.5239408024262543e-02, 3.6757780407906920e-02,
+      3.8337390990623388e-02, 3.9980535996054403e-02, 4.1689591012572642e-02,
+      4.3467013493526829e-02, 4.5315345328190329e-02, 4.7237215485149343e-02,
+      4.9235342729938195e-02, 5.1312538418738375e-02, 5.3471709370010188e-02,
+      5.5715860815966120e-02, 5.8048099435825139e-02, 6.0471636472832477e-02,
+      6.2989790937076420e-02, 6.5605992896154194e-02, 6.8323786855811433e-02,
+      7.1146835232690317e-02, 7.4078921921392496e-02, 7.7123955958084162e-02,
+      8.0285975282929856e-02, 8.3569150603685680e-02, 8.6977789362815819e-02,
+      9.0516339810561730e-02, 9.4189395186423316e-02, 9.8001698011575669e-02,
+      1.0195814449477383e-01, 1.0606378905437484e-01, 1.1032384895912269e-01,
+      1.1474370909042668e-01, 1.1932892682889128e-01, 1.2408523706791594e-01,
+      1.2901855735724516e-01, 1.3413499317938585e-01, 1.3944084336187634e-01,
+      1.4494260562844669e-01, 1.5064698229215956e-01, 1.5656088609368568e-01,
+      1.6269144618791537e-01, 1.6904601428218377e-01, 1.7563217092941996e-01,
+      1.8245773197963142e-01, 1.8953075519314200e-01, 1.9685954701912373e-01,
+      2.0445266954296509e-01, 2.1231894760614312e-01, 2.2046747610227965e-01,
+      2.2890762745314433e-01, 2.3764905926847479e-01, 2.4670172219345057e-01,
+      2.5607586794786191e-01, 2.6578205756094747e-01, 2.7583116980604344e-01,
+      2.8623440983921472e-01, 2.9700331804611479e-01, 3.0814977910139707e-01,
+      3.1968603124505884e-01, 3.3162467578021221e-01, 3.4397868679681776e-01,
+      3.5676142112598869e-01, 3.6998662852955821e-01, 3.8366846212973033e-01,
+      3.9782148908361392e-01, 4.1246070150759484e-01, 4.2760152765657944e-01,
+      4.4325984336316010e-01, 4.5945198374196639e-01, 4.7619475516433019e-01,
+      4.9350544750876152e-01, 5.1140184669255473e-01, 5.2990224749011849e-01,
+      5.4902546664356988e-01, 5.6879085627135217e-01, 5.8921831758062182e-01,
+      6.1032831488928962e-01, 6.3214188996367870e-01, 6.5468067667788099e-01,
+      6.7796691600092140e-01, 7.0202347131802179e-01, 7.2687384409226841e-01,
+      7.5254218987317989e-01, 7.7905333465861648e-01, 8.0643279161675863e-01,
+      8.3470677817484962e-01, 8.6390223348152440e-01, 8.9404683624966497e-01,
+      9.2516902298690284e-01, 9.5729800662073095e-01, 9.9046379552564701e-01,
+      1.0246972129596212e+00, 1.0600299169173009e+00, 1.0964944204075742e+00,
+      1.1341241121631813e+00, 1.1729532777900760e+00, 1.2130171213645202e+00,
+      1.2543517874858856e+00, 1.2969943837932951e+00, 1.3409830039542554e+00,
+      1.3863567511338233e+00, 1.4331557619525774e+00, 1.4814212309419863e+00,
+      1.5311954355061117e+00, 1.5825217613981541e+00, 1.6354447287209650e+00,
+      1.6900100184605180e+00, 1.7462644995616539e+00, 1.8042562565551250e+00,
+      1.8640346177457334e+00, 1.9256501839707885e+00, 1.9891548579388036e+00,
+      2.0546018741581240e+00, 2.1220458294654581e+00, 2.1915427141643509e+00,
+      2.2631499437838958e+00, 2.3369263914678591e+00, 2.4129324210048866e+00,
+      2.4912299205101394e+00, 2.5718823367693848e+00, 2.6549547102560727e+00,
+      2.7405137108327877e+00, 2.8286276741478513e+00, 2.9193666387386705e+00,
+      3.0128023838529434e+00, 3.1090084679996153e+00, 3.2080602682411397e+00,
+      3.3100350202386419e+00, 3.4150118590626040e+00, 3.5230718607804166e+00,
+      3.6342980848338597e+00, 3.7487756172184299e+00, 3.8665916144770414e+00,
+      3.9878353485214650e+00, 4.1125982522935773e+00, 4.2409739662799213e+00,
+      4.3730583858928886e+00, 4.5089497097312270e+00, 4.6487484887341131e+00,
+      4.7925576762419189e+00, 4.9404826789776779e+00, 5.0926314089633236e+00,
+      5.2491143363843129e+00, 5.4100445434175599e+00, 5.5755377790368410e+00,
+      5.7457125148099131e+00, 5.9206900017028676e+00, 6.1005943279057639e+00,
+      6.2855524776953731e+00, 6.4756943913498848e+00, 6.6711530261308951e+00,
+      6.8720644183485904e+00, 7.0785677465258221e+00, 7.2908053956764549e+00,
+      7.5089230227148418e+00, 7.7330696230122866e+00, 7.9633975981166500e+00,
+      8.2000628246524290e+00, 8.4432247244171439e+00, 8.6930463356917276e+00,
+      8.9496943857818163e+00, 9.2133393648069184e+00, 9.4841556007552921e+00,
+      9.7623213358221506e+00, 1.0048018804048528e+01, 1.0341434310279794e+01,
+      1.0642758310460454e+01, 1.0952185493285409e+01, 1.1269914863224734e+01,
+      1.1596149824941291e+01, 1.1931098269119982e+01, 1.2274972659728126e+01,
+      1.2627990122725167e+01, 1.2990372536242223e+01, 1.3362346622250762e+01,
+      1.3744144039739597e+01, 1.4136001479421450e+01, 1.4538160759987914e+01,
+      1.4950868925933962e+01, 1.5374378346972744e+01, 1.5808946819060465e+01,
+      1.6254837667053195e+01, 1.6712319849016421e+01, 1.7181668062208498e+01,
+      1.7663162850759612e+01, 1.8157090715067660e+01, 1.8663744222934131e+01,
+      1.9183422122459607e+01, 1.9716429456724512e+01, 2.0263077680273607e+01,
+      2.0823684777430952e+01, 2.1398575382464955e+01, 2.1988080901627960e+01,
+      2.2592539637093871e+01, 2.3212296912816100e+01, 2.3847705202331092e+01,
+      2.4499124258529143e+01, 2.5166921245418173e+01, 2.5851470871904677e+01,
+      2.6553155527614685e+01, 2.7272365420780556e+01, 2.8009498718219199e+01,
+      2.8764961687424211e+01, 2.9539168840799526e+01, 3.0332543082058962e+01,
+      3.1145515854816978e+01, 3.1978527293396297e+01, 3.2832026375880403e+01,
+      3.3706471079434401e+01, 3.4602328537920442e+01, 3.5520075201838615e+01,
+      3.6460197000614357e+01, 3.7423189507263139e+01, 3.8409558105458181e+01,
+      3.9419818159028743e+01, 4.0454495183917409e+01, 4.1514125022622082e+01,
+      4.2599254021152461e+01, 4.3710439208529337e+01, 4.4848248478853343e+01,
+      4.6013260775973556e+01, 4.7206066280782323e+01, 4.8427266601169208e+01,
+      4.9677474964659034e+01, 5.0957316413765341e+01, 5.2267428004089091e+01,
+      5.3608459005191634e+01, 5.4981071104272800e+01, 5.6385938612681443e+01,
+      5.7823748675293984e+01, 5.9295201482786304e+01, 6.0801010486832112e+01,
+      6.2341902618259496e+01, 6.3918618508192878e+01, 6.5531912712219366e+01,
+      6.7182553937601170e+01, 6.8871325273574428e+01, 7.0599024424760174e+01,
+      7.2366463947723076e+01, 7.4174471490709564e+01, 7.6023890036598360e+01,
+      7.7915578149092426e+01, 7.9850410222189652e+01, 8.1829276732965226e+01,
+      8.3853084497692834e+01, 8.5922756931349184e+01, 8.8039234310522772e+01,
+      9.0203474039770043e+01, 9.2416450921450206e+01, 9.4679157429069221e+01,
+      9.6992603984176242e+01, 9.9357819236835454e+01, 1.0177585034971747e+02,
+      1.0424776328584059e+02, 1.0677464310000052e+02, 1.0935759423391640e+02,
+      1.1199774081514062e+02, 1.1469622695975444e+02, 1.1745421707889874e+02,
+      1.2027289618916285e+02, 1.2315347022687803e+02, 1.2609716636634803e+02,
+      1.2910523334205212e+02, 1.3217894177485823e+02, 1.3531958450228163e+02,
+      1.3852847691283506e+02, 1.4180695728449183e+02, 1.4515638712731288e+02,
+      1.4857815153026661e+02, 1.5207365951229062e+02, 1.5564434437761739e+02,
+      1.5929166407541453e+02, 1.6301710156377155e+02, 1.6682216517807694e+02,
+      1.7070838900382006e+02, 1.7467733325385203e+02, 1.7873058465015825e+02,
+      1.8286975681017117e+02, 1.8709649063765434e+02, 1.9141245471822742e+02,
+      1.9581934571953161e+02, 2.0031888879610932e+02, 2.0491283799901385e+02,
+      2.0960297669021182e+02, 2.1439111796179134e+02, 2.1927910506003573e+02,
+      2.2426881181441121e+02, 2.2936214307146858e+02, 2.3456103513376218e+02,
+      2.3986745620375297e+02, 2.4528340683281539e+02, 2.5081092037531573e+02,
+      2.5645206344785794e+02, 2.6220893639371042e+02, 2.6808367375246445e+02,
+      2.7407844473495771e+02, 2.8019545370351693e+02, 2.8643694065756102e+02,
+      2.9280518172458142e+02, 2.9930248965658620e+02, 3.0593121433200787e+02,
+      3.1269374326313869e+02, 3.1959250210914649e+02, 3.2662995519467194e+02,
+      3.3380860603410974e+02, 3.4113099786155414e+02, 3.4859971416650745e+02,
+      3.5621737923535972e+02, 3.6398665869868188e+02, 3.7191026008440338e+02,
+      3.7999093337689698e+02, 3.8823147158200652e+02, 3.9663471129808147e+02,
+      4.0520353329306425e+02, 4.1394086308763525e+02, 4.2284967154451215e+02,
+      4.3193297546391813e+02, 4.4119383818525114e+02, 4.5063537019504196e+02,
+      4.6026072974118665e+02, 4.7007312345356365e+02, 4.8007580697101531e+02,
+      4.9027208557478684e+02, 5.0066531482844010e+02, 5.1125890122430593e+02,
+      5.2205630283648725e+02, 5.3306102998051472e+02, 5.4427664587963159e+02,
+      5.5570676733780374e+02, 5.6735506541947825e+02, 5.7922526613614002e+02,
+      5.9132115113970872e+02, 6.0364655842282912e+02, 6.1620538302607520e+02,
+      6.2900157775217133e+02, 6.4203915388719111e+02, 6.5532218192884784e+02,
+      6.6885479232190653e+02, 6.8264117620073841e+02, 6.9668558613908181e+02,
+      7.1099233690707194e+02, 7.2556580623552645e+02, 7.4041043558762806e+02,
+      7.5553073093792909e+02, 7.7093126355885079e+02, 7.8661667081461701e+02,
+      8.0259165696271577e+02, 8.1886099396294946e+02, 8.3542952229408365e+02,
+      8.5230215177815001e+02, 8.6948386241248272e+02, 8.8697970520947183e+02,
+      9.0479480304411470e+02, 9.2293435150945220e+02, 9.4140361977983582e+02,
+      9.6020795148216610e+02, 9.7935276557508359e+02, 9.9884355723621911e+02,
+      1.0186858987574703e+03, 1.0388854404484211e+03, 1.0594479115479151e+03,
+      1.0803791211438411e+03, 1.1016849591011330e+03, 1.1233713969981366e+03,
+      1.1454444890712518e+03, 1.1679103731679882e+03, 1.1907752717084504e+03,
+      1.2140454926553182e+03, 1.2377274304923076e+03, 1.2618275672112493e+03,
+      1.2863524733077286e+03, 1.3113088087854287e+03, 1.3367033241691497e+03,
+      1.3625428615265880e+03, 1.3888343554988778e+03, 1.4155848343400173e+03,
+      1.4428014209651415e+03, 1.4704913340077219e+03, 1.4986618888857615e+03,
+      1.5273204988769528e+03, 1.5564746762029804e+03, 1.5861320331228196e+03,
+      1.6163002830352641e+03, 1.6469872415906125e+03, 1.6782008278115893e+03,
+      1.7099490652235668e+03, 1.7422400829940393e+03, 1.7750821170815711e+03,
+      1.8084835113940635e+03, 1.8424527189565129e+03, 1.8769983030882549e+03,
+      1.9121289385897439e+03, 1.9478534129389454e+03, 1.9841806274972914e+03,
+      2.0211195987253591e+03, 2.0586794594082025e+03, 2.0968694598905486e+03,
+      2.1356989693216096e+03, 2.1751774769098838e+03, 2.2153145931877930e+03,
+      2.2561200512861765e+03, 2.2976037082188577e+03, 2.3397755461770876e+03,
+      2.3826456738341362e+03, 2.4262243276599270e+03, 2.4705218732457852e+03,
+      2.5155488066393586e+03, 2.5613157556898077e+03, 2.6078334814031018e+03,
+      2.6551128793077655e+03, 2.7031649808308034e+03, 2.7520009546841720e+03,
+      2.8016321082614586e+03, 2.8520698890451013e+03, 2.9033258860241895e+03,
+      2.9554118311225702e+03, 3.0083396006377561e+03, 3.0621212166902355e+03,
+      3.1167688486835286e+03, 3.1722948147749416e+03, 3.2287115833569692e+03,
+      3.2860317745494672e+03, 3.3442681617026706e+03, 3.4034336729109459e+03,
+      3.4635413925375137e+03, 3.5246045627500021e+03, 3.5866365850669627e+03,
+      3.6496510219153729e+03, 3.7136615981991149e+03, 3.7786822028785264e+03,
+      3.8447268905610886e+03, 3.9118098831030889e+03, 3.9799455712225654e+03,
+      4.0491485161234073e+03, 4.1194334511306970e+03, 4.1908152833371569e+03,
+      4.2633090952611647e+03, 4.3369301465158132e+03, 4.4116938754895373e+03,
+      4.4876159010379797e+03, 4.5647120241873617e+03, 4.6429982298493305e+03,
+      4.7224906885471519e+03, 4.8032057581536865e+03, 4.8851599856405528e+03,
+      4.9683701088392381e+03, 5.0528530582136455e+03, 5.1386259586441493e+03,
+      5.2257061312236156e+03, 5.3141110950649409e+03, 5.4038585691203516e+03,
+      5.4949664740124745e+03, 5.5874529338772218e+03, 5.6813362782184749e+03,
+      5.7766350437746296e+03, 5.8733679763969003e+03, 5.9715540329399009e+03,
+      6.0712123831635145e+03, 6.1723624116473757e+03, 6.2750237197170463e+03,
+      6.3792161273820466e+03, 6.4849596752862417e+03, 6.5922746266700924e+03,
+      6.7011814693450033e+03, 6.8117009176798610e+03, 6.9238539145996347e+03,
+      7.0376616335962481e+03, 7.1531454807514065e+03, 7.2703270967720100e+03,
+      7.3892283590373181e+03, 7.5098713836586876e+03, 7.6322785275516844e+03,
+      7.7564723905200171e+03, 7.8824758173524642e+03, 8.0103118999313492e+03,
+      8.1400039793541264e+03, 8.2715756480668260e+03, 8.4050507520102328e+03,
+      8.5404533927780467e+03, 8.6778079297880668e+03, 8.8171389824655053e+03,
+      8.9584714324384622e+03, 9.1018304257466407e+03, 9.2472413750619453e+03,
+      9.3947299619217483e+03, 9.5443221389749324e+03, 9.6960441322402075e+03,
+      9.8499224433770996e+03, 1.0005983851969555e+04, 1.0164255417822169e+04,
+      1.0324764483268978e+04, 1.0487538675494779e+04, 1.0652605908869285e+04,
+      1.0819994387293887e+04, 1.0989732606561010e+04, 1.1161849356726101e+04,
+      1.1336373724492438e+04, 1.1513335095608709e+04, 1.1692763157279092e+04,
+      1.1874687900585874e+04, 1.2059139622925699e+04, 1.2246148930457246e+04,
+      1.2435746740562865e+04, 1.2627964284322166e+04, 1.2822833108998586e+04,
+      1.3020385080539081e+04, 1.3220652386086063e+04, 1.3423667536502368e+04,
+      1.3629463368909042e+04, 1.3838073049236200e+04, 1.4049530074785589e+04,
+      1.4263868276807667e+04, 1.4481121823089637e+04, 1.4701325220557870e+04,
+      1.4924513317892422e+04, 1.5150721308153943e+04, 1.5379984731424407e+04,
+      1.5612339477459722e+04, 1.5847821788355886e+04, 1.6086468261227328e+04,
+      1.6328315850898587e+04, 1.6573401872608662e+04, 1.6821764004727611e+04,
+      1.7073440291487237e+04, 1.7328469145723120e+04, 1.7586889351630460e+04,
+      1.7848740067532210e+04, 1.8114060828660546e+04, 1.8382891549950407e+04,
+      1.8655272528846188e+04, 1.8931244448121633e+04, 1.9210848378711762e+04,
+      1.9494125782557796e+04, 1.9781118515465336e+04, 2.0071868829974614e+04,
+      2.0366419378243590e+04, 2.0664813214944803e+04, 2.0967093800172956e+04,
+      2.1273305002367491e+04, 2.1583491101245800e+04, 2.1897696790750870e+04,
+      2.2215967182010492e+04, 2.2538347806309470e+04, 2.2864884618074186e+04,
+      2.3195623997870975e+04, 2.3530612755415619e+04, 2.3869898132595932e+04,
+      2.4213527806507944e+04, 2.4561549892503055e+04, 2.4914012947248786e+04,
+      2.5270965971802096e+04, 2.5632458414694785e+04, 2.5998540175031674e+04,
+      2.6369261605600746e+04, 2.6744673515997245e+04, 2.7124827175758233e+04,
+      2.7509774317511237e+04, 2.7899567140134095e+04, 2.8294258311928308e+04,
+      2.8693900973803902e+04, 2.9098548742476814e+04, 2.9508255713679027e+04,
+      2.9923076465380764e+04, 3.0343066061024645e+04, 3.0768280052772174e+04,
+      3.1198774484763468e+04, 3.1634605896387420e+04, 3.2075831325565869e+04,
+      3.2522508312048067e+04, 3.2974694900719078e+04, 3.3432449644919005e+04,
+      3.3895831609774999e+04, 3.4364900375544188e+04, 3.4839716040970859e+04,
+      3.5320339226652482e+04, 3.5806831078420946e+04, 3.6299253270732974e+04,
+      3.6797668010073794e+04, 3.7302138038373283e+04, 3.7812726636431391e+04,
+      3.8329497627358840e+04, 3.8852515380026423e+04, 3.9381844812528027e+04,
+      3.9917551395653674e+04, 4.0459701156376628e+04, 4.1008360681349128e+04,
+      4.1563597120411730e+04, 4.2125478190114009e+04, 4.2694072177245122e+04,
+      4.3269447942378458e+04, 4.3851674923425177e+04, 4.4440823139199958e+04,
+      4.5036963192999348e+04, 4.5640166276189404e+04, 4.6250504171805522e+04,
+      4.6868049258163788e+04, 4.7492874512482274e+04, 4.8125053514515312e+04,
+      4.8764660450196381e+04, 4.9411770115294632e+04, 5.0066457919080094e+04,
+      5.0728799888001267e+04, 5.1398872669373231e+04, 5.2076753535075870e+04,
+      5.2762520385263531e+04, 5.3456251752085635e+04, 5.4158026803417655e+04,
+      5.4867925346602213e+04, 5.5586027832201340e+04, 5.6312415357759528e+04,
+      5.7047169671576434e+04, 5.7790373176490088e+04, 5.8542108933671378e+04,
+      5.9302460666428480e+04, 6.0071512764019833e+04, 6.0849350285480468e+04,
+      6.1636058963454860e+04, 6.2431725208044518e+04, 6.3236436110660063e+04,
+      6.4050279447887195e+04, 6.4873343685362357e+04, 6.5705717981654321e+04,
+      6.6547492192162696e+04, 6.7398756873018836e+04, 6.8259603285001169e+04,
+      6.9130123397457108e+04, 7.0010409892238036e+04, 7.0900556167640156e+04,
+      7.1800656342356160e+04, 7.2710805259437839e+04, 7.3631098490265344e+04,
+      7.4561632338527721e+04, 7.5502503844210209e+04, 7.6453810787593742e+04,
+      7.7415651693263077e+04, 7.8388125834118153e+04, 7.9371333235404716e+04,
+      8.0365374678744105e+04, 8.1370351706176443e+04, 8.2386366624213129e+04,
+      8.3413522507895075e+04, 8.4451923204862309e+04, 8.5501673339428831e+04
+    };
+    static constexpr Scalar liq_svp[size] = {
+      1.4626824611526854e-05, 1.5621037177920032e-05, 1.6679228450389327e-05,
+      1.7805279024006475e-05, 1.9003290168010412e-05, 2.0277595513794553e-05,
+      2.1632773314699493e-05, 2.3073659303163707e-05, 2.4605360171825052e-05,
+      2.6233267706218502e-05, 2.7963073597828603e-05, 2.9800784967383336e-05,
+      3.1752740629468646e-05, 3.3825628130760664e-05, 3.6026501595426290e-05,
+      3.8362800412570265e-05, 4.0842368801933504e-05, 4.3473476295470331e-05,
+      4.6264839173856607e-05, 4.9225642898485103e-05, 5.2365565581042975e-05,
+      5.5694802534366909e-05, 5.9224091949912068e-05, 6.2964741748873859e-05,
+      6.6928657655765993e-05, 7.1128372545066181e-05, 7.5577077113409298e-05,
+      8.0288651931762021e-05, 8.5277700933989768e-05, 9.0559586400285614e-05,
+      9.6150465496078010e-05, 1.0206732842920286e-04, 1.0832803829039979e-04,
+      1.1495137264452150e-04, 1.2195706694224063e-04, 1.2936585982455294e-04,
+      1.3719954039486098e-04, 1.4548099753614627e-04, 1.5423427135337396e-04,
+      1.6348460682410923e-04, 1.7325850974320086e-04, 1.8358380505034959e-04,
+      1.9448969763242243e-04, 2.0600683569555714e-04, 2.1816737680527864e-04,
+      2.3100505669624210e-04, 2.4455526095663524e-04, 2.5885509969575068e-04,
+      2.7394348530693382e-04, 2.8986121344186291e-04, 3.0665104731584603e-04,
+      3.2435780546790440e-04, 3.4302845310345162e-04, 3.6271219715140518e-04,
+      3.8346058517215598e-04, 4.0532760825689654e-04, 4.2836980806360795e-04,
+      4.5264638813957632e-04, 4.7821932968499154e-04, 5.0515351191735339e-04,
+      5.3351683720112824e-04, 5.6338036111263777e-04, 5.9481842761515303e-04,
+      6.2790880952495059e-04, 6.6273285445437604e-04, 6.9937563642405757e-04,
+      7.3792611334195385e-04, 7.7847729055340498e-04, 8.2112639067208153e-04,
+      8.6597502990861329e-04, 9.1312940111977253e-04, 9.6270046380813690e-04,
+      1.0148041413087846e-03, 1.0695615254067386e-03, 1.1270990886361448e-03,
+      1.1875489045194080e-03, 1.2510488760122110e-03, 1.3177429724280628e-03,
+      1.3877814751241219e-03, 1.4613212322377737e-03, 1.5385259227723423e-03,
+      1.6195663303383253e-03, 1.7046206268656616e-03, 1.7938746666113720e-03,
+      1.8875222907958687e-03, 1.9857656432106206e-03, 2.0888154971501816e-03,
+      2.1968915940299219e-03, 2.3102229940620608e-03, 2.4290484393726529e-03,
+      2.5536167299515821e-03, 2.6841871128401923e-03, 2.8210296849700547e-03,
+      2.9644258100788392e-03, 3.1146685501408766e-03, 3.2720631117598691e-03,
+      3.4369273079854663e-03, 3.6095920360254261e-03, 3.7904017713392829e-03,
+      3.9797150786101271e-03, 4.1779051401061871e-03, 4.3853603019548288e-03,
+      4.6024846388667976e-03, 4.8296985378611006e-03, 5.0674393015551090e-03,
+      5.3161617715991663e-03, 5.5763389728482700e-03, 5.8484627788796184e-03,
+      6.1330445994783505e-03, 6.4306160907305404e-03, 6.7417298883759996e-03,
+      7.0669603650920787e-03, 7.4069044123928930e-03, 7.7621822478467625e-03,
+      8.1334382483294540e-03, 8.5213418100509655e-03, 8.9265882361059517e-03,
+      9.3498996523197261e-03, 9.7920259521772721e-03, 1.0253745771640793e-02,
+      1.0735867494680961e-02, 1.1239230290362480e-02, 1.1764705182347594e-02,
+      1.2313196151697245e-02, 1.2885641273868497e-02, 1.3483013890828953e-02,
+      1.4106323819226612e-02, 1.4756618595574507e-02, 1.5434984759428368e-02,
+      1.6142549175559941e-02, 1.6880480396142022e-02, 1.7649990063992142e-02,
+      1.8452334357932750e-02, 1.9288815481355005e-02, 2.0160783195090421e-02,
+      2.1069636395717666e-02, 2.2016824740454750e-02, 2.3003850319805917e-02,
+      2.4032269379158578e-02, 2.5103694090546483e-02, 2.6219794375812785e-02,
+      2.7382299782441867e-02, 2.8593001413337149e-02, 2.9853753911851123e-02,
+      3.1166477503404153e-02, 3.2533160095032779e-02, 3.3955859434253166e-02,
+      3.5436705328632224e-02, 3.6977901927486706e-02, 3.8581730067157795e-02,
+      4.0250549681325021e-02, 4.1986802277849129e-02, 4.3793013483659125e-02,
+      4.5671795659214039e-02, 4.7625850584100113e-02, 4.9657972215342600e-02,
+      5.1771049520031164e-02, 5.3968069383889428e-02, 5.6252119597424745e-02,
+      5.8626391921333981e-02, 6.1094185232851560e-02, 6.3658908754743032e-02,
+      6.6324085368678787e-02, 6.9093355014745200e-02, 7.1970478178844721e-02,
+      7.4959339469791761e-02, 7.8063951287903069e-02, 8.1288457586914178e-02,
+      8.4637137731057924e-02, 8.8114410449182778e-02, 9.1724837887775829e-02,
+      9.5473129764789819e-02, 9.9364147626191640e-02, 1.0340290920715194e-01,
+      1.0759459289982358e-01, 1.1194454232965392e-01, 1.1645827104220989e-01,
+      1.2114146730249836e-01, 1.2599999900875822e-01, 1.3103991872275358e-01,
+      1.3626746881856019e-01, 1.4168908675187794e-01, 1.4731141045191623e-01,
+      1.5314128383787140e-01, 1.5918576246206309e-01, 1.6545211928177156e-01,
+      1.7194785056186998e-01, 1.7868068191027273e-01, 1.8565857444831224e-01,
+      1.9288973111811752e-01, 2.0038260312904840e-01, 2.0814589654530974e-01,
+      2.1618857901680355e-01, 2.2451988665531891e-01, 2.3314933105816077e-01,
+      2.4208670648129216e-01, 2.5134209716409667e-01, 2.6092588480785933e-01,
+      2.7084875621004068e-01, 2.8112171105647987e-01, 2.9175606987357039e-01,
+      3.0276348214256282e-01, 3.1415593457804641e-01, 3.2594575957274480e-01,
+      3.3814564381070639e-01, 3.5076863705100336e-01, 3.6382816108403132e-01,
+      3.7733801886257101e-01, 3.9131240380964938e-01, 4.0576590930539069e-01,
+      4.2071353835494940e-01, 4.3617071343968528e-01, 4.5215328655371190e-01,
+      4.6867754942798417e-01, 4.8576024394408490e-01, 5.0341857273995150e-01,
+      5.2167021000967151e-01, 5.4053331249962455e-01, 5.6002653070323116e-01,
+      5.8016902025652162e-01, 6.0098045353692042e-01, 6.2248103146745171e-01,
+      6.4469149552891714e-01, 6.6763313998222906e-01, 6.9132782430355921e-01,
+      7.1579798583462506e-01, 7.4106665265076577e-01, 7.6715745664934631e-01,
+      7.9409464686112696e-01, 8.2190310298735469e-01, 8.5060834916526729e-01,
+      8.8023656796494210e-01, 9.1081461462028879e-01, 9.4237003149728193e-01,
+      9.7493106280238817e-01, 1.0085266695344151e+00, 1.0431865446829556e+00,
+      1.0789411286768067e+00, 1.1158216250857476e+00, 1.1538600165791857e+00,
+      1.1930890811453392e+00, 1.2335424085746476e+00, 1.2752544172112097e+00,
+      1.3182603709763414e+00, 1.3625963966681105e+00, 1.4082995015412541e+00,
+      1.4554075911715956e+00, 1.5039594876095002e+00, 1.5539949478268715e+00,
+      1.6055546824624263e+00, 1.6586803748699472e+00, 1.7134147004745868e+00,
+      1.7698013464421287e+00, 1.8278850316665665e+00, 1.8877115270811233e+00,
+      1.9493276762984204e+00, 2.0127814165850451e+00, 2.0781218001764845e+00,
+      2.1453990159381480e+00, 2.2146644113784055e+00, 2.2859705150196472e+00,
+      2.3593710591337302e+00, 2.4349210028478612e+00, 2.5126765556274857e+00,
+      2.5926952011425191e+00, 2.6750357215237028e+00, 2.7597582220155652e+00,
+      2.8469241560328866e+00, 2.9365963506274575e+00, 3.0288390323721361e+00,
+      3.1237178536689796e+00, 3.2212999194888194e+00, 3.3216538145491450e+00,
+      3.4248496309374734e+00, 3.5309589961875427e+00, 3.6400551018153600e+00,
+      3.7522127323225267e+00, 3.8675082946740216e+00, 3.9860198482576479e+00,
+      4.1078271353326201e+00, 4.2330116119744261e+00, 4.3616564795231483e+00,
+      4.4938467165428353e+00, 4.6296691112985444e+00, 4.7692122947589315e+00,
+      4.9125667741310854e+00, 5.0598249669346620e+00, 5.2110812356226806e+00,
+      5.3664319227558988e+00, 5.5259753867371835e+00, 5.6898120381136410e+00,
+      5.8580443764524306e+00, 6.0307770277974146e+00, 6.2081167827132155e+00,
+      6.3901726349230303e+00, 6.5770558205469403e+00, 6.7688798579467822e+00,
+      6.9657605881839197e+00, 7.1678162160962042e+00, 7.3751673520001555e+00,
+      7.5879370540242332e+00, 7.8062508710787597e+00, 8.0302368864692699e+00,
+      8.2600257621577331e+00, 8.4957507836783410e+00, 8.7375479057119225e+00,
+      8.9855557983264003e+00, 9.2399158938864296e+00, 9.5007724346388969e+00,
+      9.7682725209787549e+00, 1.0042566160400661e+01, 1.0323806317140441e+01,
+      1.0612148962512435e+01, 1.0907753125946888e+01, 1.1210780946732001e+01,
+      1.1521397726465493e+01, 1.1839771982220068e+01, 1.2166075500427963e+01,
+      1.2500483391488036e+01, 1.2843174145100365e+01, 1.3194329686333361e+01,
+      1.3554135432425777e+01, 1.3922780350330665e+01, 1.4300457015002598e+01,
+      1.4687361668434853e+01, 1.5083694279449384e+01, 1.5489658604243486e+01,
+      1.5905462247699520e+01, 1.6331316725457970e+01, 1.6767437526761725e+01,
+      1.7214044178074470e+01, 1.7671360307475585e+01, 1.8139613709838248e+01,
+      1.8619036412792870e+01, 1.9109864743481840e+01, 1.9612339396108172e+01,
+      2.0126705500281972e+01, 2.0653212690170918e+01, 2.1192115174456529e+01,
+      2.1743671807101858e+01, 2.2308146158935347e+01, 2.2885806590051729e+01,
+      2.3476926323039635e+01, 2.4081783517035035e+01, 2.4700661342606463e+01,
+      2.5333848057479639e+01, 2.5981637083100114e+01, 2.6644327082041752e+01,
+      2.7322222036265995e+01, 2.8015631326233247e+01, 2.8724869810874122e+01,
+      2.9450257908422614e+01, 3.0192121678117577e+01, 3.0950792902773788e+01,
+      3.1726609172231736e+01, 3.2519913967687053e+01, 3.3331056746905212e+01,
+      3.4160393030324968e+01, 3.5008284488060013e+01, 3.5875099027794548e+01,
+      3.6761210883586074e+01, 3.7667000705576093e+01, 3.8592855650611860e+01,
+      3.9539169473786473e+01, 4.0506342620902579e+01, 4.1494782321861244e+01,
+      4.2504902684981417e+01, 4.3537124792258609e+01, 4.4591876795562207e+01,
+      4.5669594013775821e+01, 4.6770719030894277e+01, 4.7895701795068184e+01,
+      4.9044999718612608e+01, 5.0219077778977642e+01, 5.1418408620687032e+01,
+      5.2643472658252662e+01, 5.3894758180063867e+01, 5.5172761453261579e+01,
+      5.6477986829597008e+01, 5.7810946852283827e+01, 5.9172162363843896e+01,
+      6.0562162614958041e+01, 6.1981485374316186e+01, 6.3430677039482141e+01,
+      6.4910292748766594e+01, 6.6420896494125515e+01, 6.7963061235073539e+01,
+      6.9537369013631462e+01, 7.1144411070299356e+01, 7.2784787961068005e+01,
+      7.4459109675471282e+01, 7.6167995755678419e+01, 7.7912075416639297e+01,
+      7.9691987667278724e+01, 8.1508381432749644e+01, 8.3361915677745145e+01,
+      8.5253259530872327e+01, 8.7183092410101395e+01, 8.9152104149283176e+01,
+      9.1160995125740826e+01, 9.3210476388946077e+01, 9.5301269790276280e+01,
+      9.7434108113858315e+01, 9.9609735208511196e+01, 1.0182890612077125e+02,
+      1.0409238722903191e+02, 1.0640095637876045e+02, 1.0875540301885835e+02,
+      1.1115652833909122e+02, 1.1360514540865763e+02, 1.1610207931586052e+02,
+      1.1864816730890706e+02, 1.2124425893782669e+02, 1.2389121619750483e+02,
+      1.2658991367186792e+02, 1.2934123867917725e+02, 1.3214609141847555e+02,
+      1.3500538511715723e+02, 1.3792004617968718e+02, 1.4089101433746393e+02,
+      1.4391924279982294e+02, 1.4700569840619957e+02, 1.5015136177942873e+02,
+      1.5335722748021206e+02, 1.5662430416274020e+02, 1.5995361473146909e+02,
+      1.6334619649905531e+02, 1.6680310134547710e+02, 1.7032539587828722e+02,
+      1.7391416159407390e+02, 1.7757049504106217e+02, 1.8129550798289384e+02,
+      1.8509032756360995e+02, 1.8895609647376733e+02, 1.9289397311777367e+02,
+      1.9690513178237791e+02, 2.0099076280636010e+02, 2.0515207275139383e+02,
+      2.0939028457410592e+02, 2.1370663779932556e+02, 2.1810238869450171e+02,
+      2.2257881044535270e+02, 2.2713719333265703e+02, 2.3177884491030375e+02,
+      2.3650509018446078e+02, 2.4131727179401003e+02, 2.4621675019215218e+02,
+      2.5120490382919417e+02, 2.5628312933657492e+02, 2.6145284171206282e+02,
+      2.6671547450616282e+02, 2.7207248000974960e+02, 2.7752532944286514e+02,
+      2.8307551314476513e+02, 2.8872454076513156e+02, 2.9447394145651708e+02,
+      3.0032526406800690e+02, 3.0628007734004609e+02, 3.1233997010052821e+02,
+      3.1850655146204394e+02, 3.2478145102038656e+02, 3.3116631905421639e+02,
+      3.3766282672599647e+02, 3.4427266628406534e+02, 3.5099755126599263e+02,
+      3.5783921670308251e+02, 3.6479941932614531e+02, 3.7187993777242968e+02,
+      3.7908257279378705e+02, 3.8640914746605546e+02, 3.9386150739963119e+02,
+      4.0144152095126549e+02, 4.0915107943707136e+02, 4.1699209734671985e+02,
+      4.2496651255886860e+02, 4.3307628655777887e+02, 4.4132340465116903e+02,
+      4.4970987618920037e+02, 4.5823773478479046e+02, 4.6690903853500566e+02,
+      4.7572587024373547e+02, 4.8469033764553814e+02, 4.9380457363071639e+02,
+      5.0307073647153749e+02, 5.1249101004973295e+02, 5.2206760408509126e+02,
+      5.3180275436538375e+02, 5.4169872297736174e+02, 5.5175779853897927e+02,
+      5.6198229643289949e+02, 5.7237455904104309e+02, 5.8293695598043632e+02,
+      5.9367188434021637e+02, 6.0458176891980509e+02, 6.1566906246829842e+02,
+      6.2693624592500987e+02, 6.3838582866118816e+02, 6.5002034872298395e+02,
+      6.6184237307550040e+02, 6.7385449784804416e+02, 6.8605934858062790e+02,
+      6.9845958047150884e+02, 7.1105787862604961e+02, 7.2385695830653151e+02,
+      7.3685956518341641e+02, 7.5006847558751156e+02, 7.6348649676340881e+02,
+      7.7711646712410243e+02, 7.9096125650670331e+02, 8.0502376642931540e+02,
+      8.1930693034909586e+02, 8.3381371392142523e+02, 8.4854711526019355e+02,
+      8.6351016519933796e+02, 8.7870592755534778e+02, 8.9413749939107765e+02,
+      9.0980801128057874e+02, 9.2572062757503954e+02, 9.4187854666997612e+02,
+      9.5828500127342829e+02, 9.7494325867530597e+02, 9.9185662101784112e+02,
+      1.0090284255672129e+03, 1.0264620449861764e+03, 1.0441608876079042e+03,
+      1.0621283977107607e+03, 1.0803680557944201e+03, 1.0988833788568834e+03,
+      1.1176779206726105e+03, 1.1367552720718224e+03, 1.1561190612207658e+03,
+      1.1757729539031941e+03, 1.1957206538028081e+03, 1.2159659027867801e+03,
+      1.2365124811904097e+03, 1.2573642081027963e+03, 1.2785249416535498e+03,
+      1.2999985793005774e+03, 1.3217890581189254e+03, 1.3439003550906548e+03,
+      1.3663364873957523e+03, 1.3891015127040637e+03, 1.4121995294683443e+03,
+      1.4356346772181728e+03, 1.4594111368550268e+03, 1.4835331309483665e+03,
+      1.5080049240325934e+03, 1.5328308229052179e+03, 1.5580151769258637e+03,
+      1.5835623783163740e+03, 1.6094768624618166e+03, 1.6357631082125665e+03,
+      1.6624256381873715e+03, 1.6894690190772751e+03, 1.7168978619506659e+03,
+      1.7447168225591977e+03, 1.7729306016446703e+03, 1.8015439452469884e+03,
+      1.8305616450128618e+03, 1.8599885385056712e+03, 1.8898295095161677e+03,
+      1.9200894883739800e+03, 1.9507734522604360e+03, 1.9818864255218377e+03,
+      2.0134334799840369e+03, 2.0454197352675751e+03, 2.0778503591042195e+03,
+      2.1107305676538854e+03, 2.1440656258226632e+03, 2.1778608475819569e+03,
+      2.2121215962881201e+03, 2.2468532850032207e+03, 2.2820613768166677e+03,
+      2.3177513851674730e+03, 2.3539288741678979e+03, 2.3905994589272677e+03,
+      2.4277688058771523e+03, 2.4654426330972919e+03, 2.5036267106420441e+03,
+      2.5423268608683279e+03, 2.5815489587635416e+03, 2.6212989322750041e+03,
+      2.6615827626399596e+03, 2.7024064847161517e+03, 2.7437761873137774e+03,
+      2.7856980135275312e+03, 2.8281781610700082e+03, 2.8712228826056980e+03,
+      2.9148384860856145e+03, 2.9590313350827942e+03, 3.0038078491287893e+03,
+      3.0491745040504375e+03, 3.0951378323079671e+03, 3.1417044233330880e+03,
+      3.1888809238688441e+03, 3.2366740383090446e+03, 3.2850905290395158e+03,
+      3.3341372167791365e+03, 3.3838209809221953e+03, 3.4341487598813546e+03,
+      3.4851275514309618e+03, 3.5367644130514645e+03, 3.5890664622743739e+03,
+      3.6420408770279032e+03, 3.6956948959831007e+03, 3.7500358189009935e+03,
+      3.8050710069802121e+03, 3.8608078832049341e+03, 3.9172539326943065e+03,
+      3.9744167030516705e+03, 4.0323038047147184e+03, 4.0909229113064862e+03,
+      4.1502817599867067e+03, 4.2103881518038124e+03, 4.2712499520475121e+03,
+      4.3328750906022306e+03, 4.3952715623007280e+03, 4.4584474272785155e+03,
+      4.5224108113291259e+03, 4.5871699062592697e+03, 4.6527329702451707e+03,
+      4.7191083281891952e+03, 4.7863043720771211e+03, 4.8543295613355949e+03,
+      4.9231924231910352e+03, 4.9929015530276629e+03, 5.0634656147475307e+03,
+      5.1348933411299640e+03, 5.2071935341920444e+03, 5.2803750655492668e+03,
+      5.3544468767774006e+03, 5.4294179797738225e+03, 5.5052974571195982e+03,
+      5.5820944624431613e+03, 5.6598182207826330e+03, 5.7384780289498240e+03,
+      5.8180832558947877e+03, 5.8986433430695952e+03, 5.9801678047938867e+03,
+      6.0626662286204391e+03, 6.1461482757004042e+03, 6.2306236811499575e+03,
+      6.3161022544172056e+03, 6.4025938796488035e+03, 6.4901085160576777e+03,
+      6.5786561982906524e+03, 6.6682470367970218e+03, 6.7588912181966498e+03,
+      6.8505990056495948e+03, 6.9433807392245762e+03, 7.0372468362693389e+03,
+      7.1322077917802399e+03, 7.2282741787729310e+03, 7.3254566486525582e+03,
+      7.4237659315848623e+03, 7.5232128368678304e+03, 7.6238082533028637e+03,
+      7.7255631495670332e+03, 7.8284885745846486e+03, 7.9325956579003241e+03,
+      8.0378956100516534e+03, 8.1443997229415390e+03, 8.2521193702125838e+03,
+      8.3610660076196800e+03, 8.4712511734041309e+03, 8.5826864886674612e+03,
+      8.6953836577462607e+03, 8.8093544685857942e+03, 8.9246107931153292e+03,
+      9.0411645876228449e+03, 9.1590278931298926e+03, 9.2782128357674264e+03,
+      9.3987316271509171e+03, 9.5205965647559769e+03, 9.6438200322944122e+03,
+      9.7684145000903791e+03, 9.8943925254561382e+03, 1.0021766753069034e+04,
+      1.0150549915347186e+04, 1.0280754832826929e+04, 1.0412394414539112e+04,
+      1.0545481658386181e+04, 1.0680029651518942e+04, 1.0816051570714626e+04,
+      1.0953560682752419e+04, 1.1092570344792537e+04, 1.1233094004753078e+04,
+      1.1375145201687257e+04, 1.1518737566160920e+04, 1.1663884820631210e+04,
+      1.1810600779823386e+04, 1.1958899351108856e+04, 1.2108794534883466e+04,
+      1.2260300424944880e+04, 1.2413431208870961e+04, 1.2568201168397407e+04,
+      1.2724624679796585e+04, 1.2882716214253978e+04, 1.3042490338248295e+04,
+      1.3203961713928024e+04, 1.3367145099490319e+04, 1.3532055349558608e+04,
+      1.3698707415560943e+04, 1.3867116346108014e+04, 1.4037297287371142e+04,
+      1.4209265483459756e+04, 1.4383036276801036e+04, 1.4558625108515520e+04,
+      1.4736047518797099e+04, 1.4915319147288925e+04, 1.5096455733462784e+04,
+      1.5279473116996229e+04, 1.5464387238149511e+04, 1.5651214138144313e+04,
+      1.5839969959540374e+04, 1.6030670946612554e+04, 1.6223333445729941e+04,
+      1.6417973905730229e+04, 1.6614608878299034e+04, 1.6813255018346208e+04,
+      1.7013929084382205e+04, 1.7216647938894541e+04, 1.7421428548725675e+04,
+      1.7628287985448307e+04, 1.7837243425741908e+04, 1.8048312151768951e+04,
+      1.8261511551550640e+04, 1.8476859119343084e+04, 1.8694372456012519e+04,
+      1.8914069269411244e+04, 1.9135967374752203e+04, 1.9360084694985166e+04,
+      1.9586439261170108e+04, 1.9815049212853519e+04, 2.0045932798441787e+04,
+      2.0279108375576416e+04, 2.0514594411506569e+04, 2.0752409483464715e+04,
+      2.0992572279039814e+04, 2.1235101596549830e+04, 2.1480016345415755e+04,
+      2.1727335546534181e+04, 2.1977078332650501e+04, 2.2229263948730561e+04,
+      2.2483911752334261e+04, 2.2741041213985212e+04, 2.3000671917544907e+04,
+      2.3262823560582532e+04, 2.3527515954746745e+04, 2.3794769026136164e+04,
+      2.4064602815670161e+04, 2.4337037479458988e+04, 2.4612093289174234e+04,
+      2.4889790632417989e+04, 2.5170150013092632e+04, 2.5453192051769463e+04,
+      2.5738937486057548e+04, 2.6027407170972783e+04, 2.6318622079304641e+04,
+      2.6612603301985910e+04, 2.6909372048458987e+04, 2.7208949647042547e+04,
+      2.7511357545299834e+04, 2.7816617310403239e+04, 2.8124750629502021e+04,
+      2.8435779310087124e+04, 2.8749725280357441e+04, 2.9066610589583550e+04,
+      2.9386457408473492e+04, 2.9709288029536539e+04, 3.0035124867447226e+04,
+      3.0363990459408669e+04, 3.0695907465516659e+04, 3.1030898669120739e+04,
+      3.1368986977188921e+04, 3.1710195420666332e+04, 3.2054547154840559e+04,
+      3.2402065459701123e+04, 3.2752773740297878e+04, 3.3106695527106749e+04,
+      3.3463854476385102e+04, 3.3824274370532039e+04, 3.4187979118450232e+04,
+      3.4554992755901316e+04, 3.4925339445865546e+04, 3.5299043478900436e+04,
+      3.5676129273497019e+04, 3.6056621376436029e+04, 3.6440544463147373e+04,
+      3.6827923338063600e+04, 3.7218782934975286e+04, 3.7613148317389474e+04,
+      3.8011044678879174e+04, 3.8412497343442978e+04, 3.8817531765856016e+04,
+      3.9226173532022935e+04, 3.9638448359332564e+04, 4.0054382097008289e+04,
+      4.0474000726462094e+04, 4.0897330361644810e+04, 4.1324397249396447e+04,
+      4.1755227769799181e+04, 4.2189848436522858e+04, 4.2628285897180183e+04
+    };
+    return ice ? ice_svp : liq_svp;
+  }
+};
+
+} // namespace physics
+} // namespace scream
+
+#endif // PHYSICS_SATURATION_TABLE_HPP
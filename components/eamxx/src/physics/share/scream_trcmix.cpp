@@ -54,7 +54,7 @@ void trcmix(
 
   if (name == "o2" || name == "co2") {
     const auto val = name == "o2" ? C::o2mmr : rmwco2 * co2vmr;
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    Kokkos::parallel_for("physics::trcmix::o2_co2", policy, KOKKOS_LAMBDA(const MemberType& team) {
       const Int i = team.league_rank();
       Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlevs), [&] (const Int& k) {
         q(i, k) = val;
@@ -71,7 +71,7 @@ void trcmix(
     const auto scale2_base = it->second[3];
     const auto scale2_fact = it->second[4];
 
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    Kokkos::parallel_for("physics::trcmix::scaled_profile", policy, KOKKOS_LAMBDA(const MemberType& team) {
       const Int i = team.league_rank();
       Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlevs), [&] (const Int& k) {
         // set stratospheric scale height factor for gases. Need to convert
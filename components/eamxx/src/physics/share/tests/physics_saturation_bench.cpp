@@ -0,0 +1,141 @@
+#include <catch2/catch.hpp>
+
+#include "physics/share/physics_functions.hpp"
+#include "physics/share/physics_saturation_impl.hpp"
+
+#include "share/scream_types.hpp"
+
+#include <ekat/ekat_pack.hpp>
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+#include <ekat/util/ekat_test_utils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace scream {
+namespace physics {
+
+namespace {
+
+using PF      = Functions<Real,DefaultDevice>;
+using KT      = ekat::KokkosTypes<DefaultDevice>;
+using Spack   = PF::Spack;
+using view_2d = KT::view_2d<Spack>;
+
+void compute_qv_sat (const PF::SaturationFcn func_idx, const view_2d& T, const view_2d& p,
+                     const int nlev, const view_2d& qsat_l, const view_2d& qsat_i)
+{
+  const int ncols = T.extent(0);
+  const int npack = T.extent(1);
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncols,npack);
+  Kokkos::parallel_for("physics_saturation_bench",policy,
+                       KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int i = team.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,npack),[&](const int k) {
+      const auto range_mask = ekat::range<PF::IntSmallPack>(k*Spack::n) < nlev;
+      qsat_l(i,k) = PF::qv_sat_dry(T(i,k),p(i,k),false,range_mask,func_idx);
+      qsat_i(i,k) = PF::qv_sat_dry(T(i,k),p(i,k),true, range_mask,func_idx);
+    });
+  });
+}
+
+} // anonymous namespace
+
+// Microbenchmark for the saturation vapor pressure functions. For a set of
+// columns with realistic temperature/pressure profiles, we time qv_sat_dry
+// (w.r.t. both liquid and ice, as done in p3_main_part1) with each of the
+// available SaturationFcn's, and report the max relative difference of
+// the Polysvp1 and MurphyKoopTable results from the MurphyKoop ones.
+// The problem size can be set via
+//   --ekat-test-params ncols=<N>,nrepeat=<N>
+
+TEST_CASE ("physics_saturation_bench")
+{
+  auto& session = ekat::TestSession::get();
+  session.params.emplace("ncols","4096");
+  session.params.emplace("nrepeat","10");
+  const int ncols   = std::stoi(session.params["ncols"]);
+  const int nrepeat = std::stoi(session.params["nrepeat"]);
+  const int nlev    = 128;
+  const int npack   = ekat::npack<Spack>(nlev);
+
+  // Temperature decreases from ~300K at the surface to ~190K at the top, with
+  // some column-to-column variability; pressure decreases exponentially.
+  view_2d T("T",ncols,npack), p("p",ncols,npack);
+  {
+    auto T_h = Kokkos::create_mirror_view(T);
+    auto p_h = Kokkos::create_mirror_view(p);
+    auto T_s = ekat::scalarize(T_h);
+    auto p_s = ekat::scalarize(p_h);
+    std::mt19937_64 engine(1234);
+    std::uniform_real_distribution<Real> pdf(-10,10);
+    for (int i=0; i<ncols; ++i) {
+      const Real dT = pdf(engine);
+      for (int k=0; k<nlev; ++k) {
+        const Real z = Real(nlev-1-k)/(nlev-1);
+        T_s(i,k) = 300 + dT - 110*z;
+        p_s(i,k) = 1e5*std::exp(-3*z);
+      }
+    }
+    Kokkos::deep_copy(T,T_h);
+    Kokkos::deep_copy(p,p_h);
+  }
+
+  auto time = [&](const PF::SaturationFcn func_idx, const view_2d& qsat_l, const view_2d& qsat_i) {
+    compute_qv_sat(func_idx,T,p,nlev,qsat_l,qsat_i); // warm up
+    double elapsed = 0;
+    for (int n=0; n<nrepeat; ++n) {
+      Kokkos::fence();
+      auto start = std::chrono::steady_clock::now();
+      compute_qv_sat(func_idx,T,p,nlev,qsat_l,qsat_i);
+      Kokkos::fence();
+      auto finish = std::chrono::steady_clock::now();
+      elapsed += std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
+    }
+    return elapsed / (1e3*nrepeat);
+  };
+
+  auto max_rel_diff = [&](const view_2d& a, const view_2d& b) {
+    auto a_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),a);
+    auto b_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),b);
+    auto a_s = ekat::scalarize(a_h);
+    auto b_s = ekat::scalarize(b_h);
+    Real diff = 0;
+    for (int i=0; i<ncols; ++i) {
+      for (int k=0; k<nlev; ++k) {
+        diff = std::max(diff,std::abs(a_s(i,k)/b_s(i,k)-1));
+      }
+    }
+    return diff;
+  };
+
+  view_2d ref_l("ref_l",ncols,npack), ref_i("ref_i",ncols,npack);
+  view_2d qsat_l("qsat_l",ncols,npack), qsat_i("qsat_i",ncols,npack);
+
+  printf(" -> qv_sat_dry (liquid and ice), %d cols x %d levs\n",ncols,nlev);
+
+  const double ms_mk = time(PF::MurphyKoop,ref_l,ref_i);
+  printf("    - MurphyKoop     : %.4f ms/call\n",ms_mk);
+
+  const std::pair<PF::SaturationFcn,std::string> fcns[] = {
+    {PF::MurphyKoopTable, "MurphyKoopTable"},
+    {PF::Polysvp1,        "Polysvp1       "}
+  };
+  for (const auto& it : fcns) {
+    const double ms = time(it.first,qsat_l,qsat_i);
+    const Real diff = std::max(max_rel_diff(qsat_l,ref_l),max_rel_diff(qsat_i,ref_i));
+    printf("    - %s: %.4f ms/call (speedup %.2fx), max rel diff from MurphyKoop %.2e\n",
+           it.second.c_str(),ms,ms_mk/ms,diff);
+    if (it.first==PF::MurphyKoopTable) {
+      REQUIRE (diff < (std::is_same<Real,double>::value ? 4e-7 : 1e-4));
+    }
+  }
+}
+
+} // namespace physics
+} // namespace scream
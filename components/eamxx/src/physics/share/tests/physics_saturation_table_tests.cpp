@@ -0,0 +1,104 @@
+#include "catch2/catch.hpp"
+
+#include "physics/share/physics_functions.hpp"
+#include "physics/share/physics_saturation_impl.hpp"
+#include "physics_unit_tests_common.hpp"
+
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <type_traits>
+
+namespace scream {
+namespace physics {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestSaturationTable
+{
+  using Table = MurphyKoopSvpTable;
+
+  // Max relative difference between MurphyKoop_svp_table and MurphyKoop_svp,
+  // sampling n equispaced temperatures in [t_lo,t_hi]. If qv_sat=true,
+  // compare the qv_sat_dry values obtained with the two functions instead.
+  static Scalar max_rel_diff (const bool ice, const Scalar t_lo, const Scalar t_hi, const int n,
+                              const bool qv_sat = false)
+  {
+    using physics = scream::physics::Functions<Scalar, Device>;
+
+    const int npacks = ekat::npack<Spack>(n);
+    const Scalar dt = (t_hi - t_lo) / (n - 1);
+    Scalar max_diff;
+    Kokkos::parallel_reduce("TestSaturationTable::max_rel_diff", RangePolicy(0, npacks),
+      KOKKOS_LAMBDA(const int p, Scalar& diff) {
+      const auto range_pack = ekat::range<IntSmallPack>(p*Spack::n);
+      const auto range_mask = range_pack < n;
+
+      Spack t_atm(t_lo);
+      for (int s = 0; s < Spack::n; ++s) {
+        if (range_mask[s]) {
+          t_atm[s] = t_lo + range_pack[s]*dt;
+        }
+      }
+
+      Spack exact, table;
+      if (qv_sat) {
+        const Spack pres(1e5);
+        exact = physics::qv_sat_dry(t_atm, pres, ice, range_mask, physics::MurphyKoop);
+        table = physics::qv_sat_dry(t_atm, pres, ice, range_mask, physics::MurphyKoopTable);
+      } else {
+        exact = physics::MurphyKoop_svp(t_atm, ice, range_mask);
+        table = physics::MurphyKoop_svp_table(t_atm, ice, range_mask);
+      }
+
+      for (int s = 0; s < Spack::n; ++s) {
+        if (range_mask[s]) {
+          const Scalar d = Kokkos::abs(table[s]/exact[s] - 1);
+          diff = d > diff ? d : diff;
+        }
+      }
+    }, Kokkos::Max<Scalar>(max_diff));
+
+    return max_diff;
+  }
+
+  static void run()
+  {
+    static constexpr auto tmelt = C::Tmelt;
+
+    // The documented max relative error of the interpolant is 3.6e-7. In single
+    // precision, the analytic formulas themselves are much less accurate than that.
+    const Scalar tol = std::is_same<Scalar, double>::value ? 4e-7 : 1e-4;
+
+    // Sample the table range with a spacing much finer than the table's
+    const int n = 400001;
+
+    // Accuracy over the whole table range
+    REQUIRE(max_rel_diff(true,  Table::t_min, tmelt,        n) < tol);
+    REQUIRE(max_rel_diff(false, Table::t_min, Table::t_max, n) < tol);
+    REQUIRE(max_rel_diff(true,  Table::t_min, tmelt,        n, true) < tol);
+    REQUIRE(max_rel_diff(false, Table::t_min, Table::t_max, n, true) < tol);
+
+    // Above freezing, ice=true must give saturation w.r.t. liquid, as in MurphyKoop_svp
+    REQUIRE(max_rel_diff(true, tmelt, Table::t_max, 1001) < tol);
+
+    // Outside of the table range, MurphyKoop_svp_table falls back to the analytic formula
+    REQUIRE(max_rel_diff(true,  100, Table::t_min - 1, 1001) == 0);
+    REQUIRE(max_rel_diff(false, Table::t_max + 1, 400, 1001) == 0);
+  }
+};
+
+} // namespace unit_test
+} // namespace physics
+} // namespace scream
+
+namespace {
+
+TEST_CASE("saturation_table", "[physics_saturation]")
+{
+  scream::physics::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestSaturationTable::run();
+}
+
+} // namespace
@@ -415,7 +415,7 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   const auto hybm = m_grid->get_geometry_data("hybm").get_view<const Real*>();
   const auto ps0 = C::P0;
   const auto psref = ps0;
-  Kokkos::parallel_for(Kokkos::RangePolicy<>(0, m_num_levs), KOKKOS_LAMBDA (const int lev) {
+  Kokkos::parallel_for("SHOCMacrophysics::initialize_impl::pref_mid", Kokkos::RangePolicy<>(0, m_num_levs), KOKKOS_LAMBDA (const int lev) {
     s_pref_mid(lev) = ps0*hyam(lev) + psref*hybm(lev);
   });
   Kokkos::fence();
@@ -434,7 +434,7 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   } else {
     const auto area = m_grid->get_geometry_data("area").get_view<const Real*>();
     const auto lat  = m_grid->get_geometry_data("lat").get_view<const Real*>();
-    Kokkos::parallel_for(ncols, KOKKOS_LAMBDA (const int icol) {
+    Kokkos::parallel_for("SHOCMacrophysics::initialize_impl::cell_length", ncols, KOKKOS_LAMBDA (const int icol) {
       // For now, we are considering dy=dx. Here, we
       // will need to compute dx/dy instead of cell_length
       // if we have dy!=dx.
@@ -91,6 +91,11 @@ void SPA::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   SPAData_end   = SPAFunc::SPAInput(m_num_cols, m_num_src_levs+2, m_nswbands, m_nlwbands);
   SPAData_out.init(m_num_cols,m_num_levs,m_nswbands,m_nlwbands,false);
 
+  // Vertical interpolation weights are recomputed only for columns where some source
+  // or target pressure changed by more than this relative tolerance (0 means "always").
+  const auto vert_weights_tol = m_params.get<double>("vert_interp_weights_tol",0);
+  SPAVertWeights.init(m_num_cols,m_num_src_levs+2,m_num_levs,vert_weights_tol);
+
   // 3 Read in hyam/hybm in start/end data, and pad them
   Field hyam(FieldIdentifier("hyam",io_grid->get_vertical_layout(true),nondim,io_grid->name()));
   Field hybm(FieldIdentifier("hybm",io_grid->get_vertical_layout(true),nondim,io_grid->name()));
@@ -140,19 +145,16 @@ size_t SPA::requested_buffer_size_in_bytes() const
 {
   using PackInfo = ekat::PackInfo<Spack::n>;
 
-  // Recall: the quantities in spa_temp defined over vlevs have 1 Real of
-  //         padding in each column (at beginning and end).
-  //         That's why we have m_num_levs+2
+  // Recall: the source pressure has 1 Real of padding in each column
+  //         (at beginning and end). That's why we have m_num_src_levs+2
   const int nlevs = m_num_src_levs+2;
   const int num_mid_packs = PackInfo::num_packs(nlevs);
   const int nlevs_alloc = num_mid_packs*Spack::n;
 
   // We have
-  //  - one (ncols) view (spa_temp's ps)
-  //  - two (ncols,nlevs) mid view (p_mid_src, spa_temp's ccn)
-  //  - three (ncols,nswbands,nlevs) views (spa_temp's aer_g_sw, aer_ssa_sw, aer_tau_sw)
-  //  - one (ncols,nlwbands,nlevs) view (aer_tau_lw)
-  const int num_reals = m_num_cols*(1+nlevs_alloc*(2 + 3*m_nswbands + m_nlwbands));
+  //  - one (ncols,nlevs) mid view (p_mid_src)
+  //  - one (ncols) view (ps_src)
+  const int num_reals = m_num_cols*(nlevs_alloc + 1);
 
   return num_reals*sizeof(Real);
 }
@@ -166,15 +168,11 @@ void SPA::init_buffers(const ATMBufferManager &buffer_manager)
 
   using PackInfo = ekat::PackInfo<Spack::n>;
 
-  // Short names make following rows fit on text editor screen
-  // Recall: the quantities in spa_temp defined over vlevs have 1 Real of
-  //         padding in each column (at beginning and end).
-  //         That's why we have m_num_levs+2
+  // Recall: the source pressure has 1 Real of padding in each column
+  //         (at beginning and end). That's why we have m_num_src_levs+2
   const int nlevs  = m_num_src_levs+2;
   const int npacks = PackInfo::num_packs(nlevs);
   const int ncols  = m_num_cols;
-  const int nswb   = m_nswbands;
-  const int nlwb   = m_nlwbands;
 
   Spack* mem = reinterpret_cast<Spack*>(buffer_manager.get_memory());
 
@@ -182,26 +180,10 @@ void SPA::init_buffers(const ATMBufferManager &buffer_manager)
   m_buffer.p_mid_src = decltype(m_buffer.p_mid_src)(mem, ncols, npacks);
   mem += m_buffer.p_mid_src.size();
 
-  // SPA temporaries
-  auto& spa_data = m_buffer.spa_temp.data;
-  spa_data.init(ncols,nlevs,nswb,nlwb,false);
-
-  spa_data.CCN3 = decltype(spa_data.CCN3)(mem, ncols, npacks);
-  mem += spa_data.CCN3.size();
-
-  spa_data.AER_G_SW = decltype(spa_data.AER_G_SW)(mem, ncols, nswb, npacks);
-  mem += spa_data.AER_G_SW.size();
-  spa_data.AER_SSA_SW = decltype(spa_data.AER_SSA_SW)(mem, ncols, nswb, npacks);
-  mem += spa_data.AER_SSA_SW.size();
-  spa_data.AER_TAU_SW = decltype(spa_data.AER_TAU_SW)(mem, ncols, nswb, npacks);
-  mem += spa_data.AER_TAU_SW.size();
-
-  spa_data.AER_TAU_LW = decltype(spa_data.AER_TAU_LW)(mem, ncols, nlwb, npacks);
-  mem += spa_data.AER_TAU_LW.size();
-
+  // Source surface pressure
   Real* r_mem = reinterpret_cast<Real*>(mem);
-  m_buffer.spa_temp.PS = decltype(m_buffer.spa_temp.PS)(r_mem,ncols);
-  r_mem += m_buffer.spa_temp.PS.size();
+  m_buffer.ps_src = decltype(m_buffer.ps_src)(r_mem,ncols);
+  r_mem += m_buffer.ps_src.size();
 
   size_t used_mem = (r_mem - buffer_manager.get_memory())*sizeof(Real);
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(),
@@ -250,8 +232,8 @@ void SPA::run_impl (const double dt)
 
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Spack**>();
-  SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
-                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
+  SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src, m_buffer.ps_src,
+                    SPAData_start,SPAData_end,SPAVertWeights,SPAData_out);
 }
 
 // =========================================================================================
@@ -29,6 +29,8 @@ public:
   using view_1d = typename SPAFunc::view_1d<Spack>;
   using view_2d = typename SPAFunc::view_2d<Spack>;
 
+  template<typename ScalarT>
+  using uview_1d = Unmanaged<typename KT::template view_1d<ScalarT>>;
   template<typename ScalarT>
   using uview_2d = Unmanaged<typename KT::template view_2d<ScalarT>>;
 
@@ -46,11 +48,9 @@ public:
 
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
-    // Used to store temporary data during spa_main
-    SPAFunc::SPAInput spa_temp;
-
-    // Temporary to use
+    // Source pressure (and surface pressure), interpolated at the current time
     uview_2d<Spack> p_mid_src;
+    uview_1d<Real>  ps_src;
   };
 protected:
 
@@ -89,6 +89,7 @@ protected:
   SPAFunc::SPAInput         SPAData_start;
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
+  SPAFunc::SPAVertWeights   SPAVertWeights;
 
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SPA
@@ -127,6 +127,47 @@ struct SPAFunctions
     SPAData         data;         // All spa fields
   }; // SPAInput
 
+  // Vertical interpolation weights, cached across time steps. For each column and
+  // target level k, p_tgt(k) lies between the source levels idx(k) and idx(k)+1,
+  // and the interpolated value is y(idx) + w(k)*(y(idx+1)-y(idx)).
+  // Weights of a column are updated only if some src/tgt pressure changed by a
+  // relative amount larger than rel_tol since the weights were last computed.
+  // With rel_tol=0, the weights are always exact.
+  struct SPAVertWeights {
+    SPAVertWeights() = default;
+    SPAVertWeights(const int ncols_, const int nlevs_src_, const int nlevs_tgt_, const Real rel_tol_ = 0)
+    {
+      init(ncols_,nlevs_src_,nlevs_tgt_,rel_tol_);
+    }
+
+    void init(const int ncols_, const int nlevs_src_, const int nlevs_tgt_, const Real rel_tol_ = 0)
+    {
+      ncols = ncols_;
+      nlevs_src = nlevs_src_;
+      nlevs_tgt = nlevs_tgt_;
+      rel_tol = rel_tol_;
+
+      idx   = view_2d<int> ("spa_vert_idx",ncols,nlevs_tgt);
+      w     = view_2d<Real>("spa_vert_w",ncols,nlevs_tgt);
+      p_src = view_2d<Real>("spa_vert_p_src",ncols,nlevs_src);
+      p_tgt = view_2d<Real>("spa_vert_p_tgt",ncols,nlevs_tgt);
+
+      // Negative pressures ensure that the first update computes all weights
+      Kokkos::deep_copy(p_src,-1);
+      Kokkos::deep_copy(p_tgt,-1);
+    }
+
+    int  ncols;
+    int  nlevs_src;
+    int  nlevs_tgt;
+    Real rel_tol;
+
+    view_2d<int>  idx;    // Index of the source level above each target level
+    view_2d<Real> w;      // Interpolation weight of the source level below
+    view_2d<Real> p_src;  // Source pressure used to compute current weights
+    view_2d<Real> p_tgt;  // Target pressure used to compute current weights
+  }; // SPAVertWeights
+
   struct IOPReader {
     IOPReader (iop_ptr_type& iop_,
                const std::string file_name_,
@@ -183,9 +224,10 @@ struct SPAFunctions
     const SPATimeState& time_state,
     const view_2d<const Spack>& p_tgt,
     const view_2d<      Spack>& p_src,  // Temporary
+    const view_1d<      Real>&  ps_src, // Temporary
     const SPAInput&   data_beg,
     const SPAInput&   data_end,
-    const SPAInput&   data_tmp,         // Temporary
+    SPAVertWeights&   vert_weights,
     const SPAOutput&  data_out);
 
   static void update_spa_data_from_file(
@@ -205,7 +247,33 @@ struct SPAFunctions
     SPAInput&                         spa_beg,
     SPAInput&                         spa_end);
 
-  // The following three are called during spa_main
+  // Fraction of the month elapsed at time_state.t_now, checked to be in [0,1]
+  static Real get_time_fraction (const SPATimeState& time_state);
+
+  // The following are called during spa_main
+  static void perform_ps_time_interpolation (
+      const Real          t,
+      const SPAInput&     data_beg,
+      const SPAInput&     data_end,
+      const view_1d<Real>& ps_out);
+
+  static void update_vertical_weights (
+      const view_2d<const Spack>& p_src,
+      const view_2d<const Spack>& p_tgt,
+      SPAVertWeights& vert_weights);
+
+  // Fused time and vertical interpolation of all vars and bands:
+  // data_out = V(linear_interp(data_beg,data_end,t)), with V the vertical
+  // interpolation defined by vert_weights. Since both are linear, the two
+  // interpolations can be done at once, without storing the intermediate state.
+  static void perform_time_and_vertical_interpolation (
+      const Real            t,
+      const SPAData&        data_beg,
+      const SPAData&        data_end,
+      const SPAVertWeights& vert_weights,
+      const SPAData&        data_out);
+
+  // Standalone versions of the time/vertical interpolation steps
   static void perform_time_interpolation (
       const SPATimeState& time_state,
       const SPAInput&  data_beg,
@@ -11,7 +11,6 @@
 
 #include <ekat/kokkos/ekat_subview_utils.hpp>
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
-#include <ekat/util/ekat_lin_interp.hpp>
 #include <ekat/ekat_pack_utils.hpp>
 #include <ekat/ekat_pack_kokkos.hpp>
 
@@ -56,12 +55,14 @@
  * the vertical pressure profiles of the data won't match the simulation pressure
  * profiles.  The vertical SPA data structure must be remapped onto the simulation
  * pressure profile.
- * This is done using the EKAT linear interpolation code, see /externals/ekat/util/ekat_lin_interp.hpp
  * The SPA pressure profiles are calculated using the surface pressure which was
  * temporally interpolated in the last step and the set of hybrid coordinates (hyam and hybm)
  * that are used in EAM to construct the physics pressure profiles.
  * The SPA data is then projected onto the simulation pressure profile (pmid)
- * using EKAT linear interpolation.
+ * using linear interpolation in pressure. The interpolation weights are cached
+ * across time steps (see SPAVertWeights), and, since both interpolations are linear,
+ * the time and vertical interpolation of all SPA vars is done in a single kernel,
+ * without storing the time-interpolated data on the source levels.
 -----------------------------------------------------------------*/
 
 namespace scream {
@@ -199,23 +200,20 @@ void SPAFunctions<S,D>
   const SPATimeState& time_state,
   const view_2d<const Spack>& p_tgt,
   const view_2d<      Spack>& p_src,
+  const view_1d<      Real>&  ps_src,
   const SPAInput&   data_beg,
   const SPAInput&   data_end,
-  const SPAInput&   data_tmp,
+  SPAVertWeights&   vert_weights,
   const SPAOutput&  data_out)
 {
-  // Beg/End/Tmp month must have all sizes matching
+  // Beg/End month must have all sizes matching
   EKAT_REQUIRE_MSG (
       data_end.data.nswbands==data_beg.data.nswbands &&
-      data_end.data.nswbands==data_tmp.data.nswbands &&
-      data_end.data.nlwbands==data_beg.data.nlwbands &&
-      data_end.data.nlwbands==data_tmp.data.nlwbands,
+      data_end.data.nlwbands==data_beg.data.nlwbands,
       "Error! SPAInput data structs must have the same number of SW/LW bands.\n");
   EKAT_REQUIRE_MSG (
       data_end.data.ncols==data_beg.data.ncols &&
-      data_end.data.ncols==data_tmp.data.ncols &&
-      data_end.data.nlevs==data_beg.data.nlevs &&
-      data_end.data.nlevs==data_tmp.data.nlevs,
+      data_end.data.nlevs==data_beg.data.nlevs,
       "Error! SPAInput data structs must have the same number of columns/levels.\n");
 
   // Output must have same number of bands
@@ -232,14 +230,55 @@ void SPAFunctions<S,D>
       "Error! Horizontal interpolation is performed *before* calling spa_main,\n"
       "       SPAInput and SPAOutput data structs must have the same number columns.\n");
 
-  // Step 1. Perform time interpolation
-  perform_time_interpolation(time_state,data_beg,data_end,data_tmp);
+  const auto t = get_time_fraction(time_state);
 
-  // Step 2. Compute source pressure levels
-  compute_source_pressure_levels(data_tmp.PS, p_src, data_beg.hyam, data_beg.hybm);
+  // Step 1. Compute source pressure levels, using the time-interpolated surface pressure
+  perform_ps_time_interpolation(t,data_beg,data_end,ps_src);
+  compute_source_pressure_levels(ps_src, p_src, data_beg.hyam, data_beg.hybm);
 
-  // Step 3. Perform vertical interpolation
-  perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out);
+  // Step 2. Update the vertical interpolation weights (where needed)
+  update_vertical_weights(p_src, p_tgt, vert_weights);
+
+  // Step 3. Perform time and vertical interpolation of all vars at once
+  perform_time_and_vertical_interpolation(t, data_beg.data, data_end.data, vert_weights, data_out);
+}
+
+/*-----------------------------------------------------------------*/
+template <typename S, typename D>
+Real SPAFunctions<S,D>
+::get_time_fraction(const SPATimeState& time_state)
+{
+  // Gather time stamp info
+  auto& t_now = time_state.t_now;
+  auto& t_beg = time_state.t_beg_month;
+  auto& delta_t = time_state.days_this_month;
+
+  auto delta_t_fraction = (t_now-t_beg) / delta_t;
+
+  EKAT_REQUIRE_MSG (delta_t_fraction>=0 && delta_t_fraction<=1,
+      "Error! Convex interpolation with coefficient out of [0,1].\n"
+      "  t_now  : " + std::to_string(t_now) + "\n"
+      "  t_beg  : " + std::to_string(t_beg) + "\n"
+      "  delta_t: " + std::to_string(delta_t) + "\n");
+
+  return delta_t_fraction;
+}
+
+/*-----------------------------------------------------------------*/
+template <typename S, typename D>
+void SPAFunctions<S,D>
+::perform_ps_time_interpolation(
+  const Real           t,
+  const SPAInput&      data_beg,
+  const SPAInput&      data_end,
+  const view_1d<Real>& ps_out)
+{
+  const auto ps_beg = data_beg.PS;
+  const auto ps_end = data_end.PS;
+  Kokkos::parallel_for("spa_ps_time_interp_loop", ps_out.extent(0),
+    KOKKOS_LAMBDA(const int icol) {
+    ps_out(icol) = linear_interp(ps_beg(icol),ps_end(icol),t);
+  });
 }
 
 /*-----------------------------------------------------------------*/
@@ -257,11 +296,6 @@ void SPAFunctions<S,D>
   using ExeSpace = typename KT::ExeSpace;
   using ESU = ekat::ExeSpaceUtils<ExeSpace>;
 
-  // Gather time stamp info
-  auto& t_now = time_state.t_now;
-  auto& t_beg = time_state.t_beg_month;
-  auto& delta_t = time_state.days_this_month;
-
   // Makes no sense to have different number of bands
   EKAT_REQUIRE(data_end.data.nswbands==data_beg.data.nswbands);
   EKAT_REQUIRE(data_end.data.nlwbands==data_beg.data.nlwbands);
@@ -276,13 +310,7 @@ void SPAFunctions<S,D>
   const int num_vert_packs = ekat::PackInfo<Spack::n>::num_packs(data_beg.data.nlevs);
   const auto policy = ESU::get_default_team_policy(outer_iters, num_vert_packs);
 
-  auto delta_t_fraction = (t_now-t_beg) / delta_t;
-
-  EKAT_REQUIRE_MSG (delta_t_fraction>=0 && delta_t_fraction<=1,
-      "Error! Convex interpolation with coefficient out of [0,1].\n"
-      "  t_now  : " + std::to_string(t_now) + "\n"
-      "  t_beg  : " + std::to_string(t_beg) + "\n"
-      "  delta_t: " + std::to_string(delta_t) + "\n");
+  const auto delta_t_fraction = get_time_fraction(time_state);
 
   Kokkos::parallel_for("spa_time_interp_loop", policy,
     KOKKOS_LAMBDA(const MemberType& team) {
@@ -348,58 +376,145 @@ perform_vertical_interpolation(
   const SPAData& input,
   const SPAData& output)
 {
-  using ExeSpace = typename KT::ExeSpace;
-  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
-  using LIV = ekat::LinInterp<Real,Spack::n>;
-
-  // Makes no sense to have different number of bands
-  EKAT_REQUIRE(input.nswbands==output.nswbands);
-  EKAT_REQUIRE(input.nlwbands==output.nlwbands);
-
   // At this stage, begin/end must have the same horiz dimensions
   EKAT_REQUIRE(input.ncols==output.ncols);
 
-  const int ncols     = input.ncols;
-  const int nlevs_src = input.nlevs;
-  const int nlevs_tgt = output.nlevs;
-
-  LIV vert_interp(ncols,nlevs_src,nlevs_tgt);
-
-  // We can ||ize over columns as well as over variables and bands
-  const int num_vars = 1+input.nswbands*3+input.nlwbands;
-  const int num_vert_packs = ekat::PackInfo<Spack::n>::num_packs(nlevs_tgt);
-  const auto policy_setup = ESU::get_default_team_policy(ncols, num_vert_packs);
+  // One-off interpolation: build the weights from scratch, and interpolate input
+  // "in time" with itself, which leaves it unchanged.
+  SPAVertWeights vert_weights(input.ncols,input.nlevs,output.nlevs);
+  update_vertical_weights(p_src,p_tgt,vert_weights);
+  perform_time_and_vertical_interpolation(0,input,input,vert_weights,output);
+}
 
-  // Setup the linear interpolation object
-  Kokkos::parallel_for("spa_vert_interp_setup_loop", policy_setup,
-    KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+template<typename S, typename D>
+void SPAFunctions<S,D>::
+update_vertical_weights(
+  const view_2d<const Spack>& p_src,
+  const view_2d<const Spack>& p_tgt,
+  SPAVertWeights& vert_weights)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
 
+  const int ncols     = vert_weights.ncols;
+  const int nlevs_src = vert_weights.nlevs_src;
+  const int nlevs_tgt = vert_weights.nlevs_tgt;
+  const Real rel_tol  = vert_weights.rel_tol;
+
+  EKAT_REQUIRE_MSG (p_src.extent_int(0)==ncols and p_tgt.extent_int(0)==ncols,
+      "Error! SPA vertical weights and pressure views have different number of columns.\n");
+  EKAT_REQUIRE_MSG (p_src.extent_int(1)*Spack::n>=nlevs_src and p_tgt.extent_int(1)*Spack::n>=nlevs_tgt,
+      "Error! SPA vertical weights and pressure views have incompatible number of levels.\n");
+
+  const auto ps  = ekat::scalarize(p_src);
+  const auto pt  = ekat::scalarize(p_tgt);
+  const auto idx = vert_weights.idx;
+  const auto w   = vert_weights.w;
+  const auto ps_cached = vert_weights.p_src;
+  const auto pt_cached = vert_weights.p_tgt;
+
+  const auto policy = ESU::get_default_team_policy(ncols, nlevs_tgt);
+  Kokkos::parallel_for("spa_vert_weights_loop", policy,
+    KOKKOS_LAMBDA(const MemberType& team) {
     const int icol = team.league_rank();
 
-    // Setup
-    vert_interp.setup(team, ekat::subview(p_src,icol),
-                            ekat::subview(p_tgt,icol));
+    // Count the levels whose pressure changed too much since the weights were computed
+    int num_changed = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team,nlevs_src+nlevs_tgt),
+                            [&](const int k, int& n) {
+      const Real p  = k<nlevs_src ? ps(icol,k) : pt(icol,k-nlevs_src);
+      const Real pc = k<nlevs_src ? ps_cached(icol,k) : pt_cached(icol,k-nlevs_src);
+      if (Kokkos::abs(p-pc) > rel_tol*Kokkos::abs(pc)) {
+        ++n;
+      }
+    },num_changed);
+    if (num_changed==0) {
+      return;
+    }
+    team.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt),[&](const int k) {
+      const Real x = pt(icol,k);
+      // Start from the previous bracketing interval, which usually is still
+      // valid, or just one level off. Clip to [0,nlevs_src-2], which means we
+      // extrapolate linearly outside the source range.
+      int i = idx(icol,k);
+      while (i>0 and ps(icol,i)>x) {
+        --i;
+      }
+      while (i<nlevs_src-2 and ps(icol,i+1)<=x) {
+        ++i;
+      }
+      idx(icol,k) = i;
+      w(icol,k) = (x-ps(icol,i)) / (ps(icol,i+1)-ps(icol,i));
+      pt_cached(icol,k) = x;
+    });
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_src),[&](const int k) {
+      ps_cached(icol,k) = ps(icol,k);
+    });
   });
-  Kokkos::fence();
+}
+
+template<typename S, typename D>
+void SPAFunctions<S,D>::
+perform_time_and_vertical_interpolation(
+  const Real            t,
+  const SPAData&        data_beg,
+  const SPAData&        data_end,
+  const SPAVertWeights& vert_weights,
+  const SPAData&        data_out)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+
+  // Makes no sense to have different number of bands
+  EKAT_REQUIRE(data_end.nswbands==data_beg.nswbands && data_out.nswbands==data_beg.nswbands);
+  EKAT_REQUIRE(data_end.nlwbands==data_beg.nlwbands && data_out.nlwbands==data_beg.nlwbands);
+
+  // At this stage, begin/end/out must have the same horiz dimensions,
+  // and the weights must be compatible with the src/tgt levels
+  EKAT_REQUIRE(data_end.ncols==data_beg.ncols && data_out.ncols==data_beg.ncols);
+  EKAT_REQUIRE(data_end.nlevs==data_beg.nlevs);
+  EKAT_REQUIRE(vert_weights.ncols==data_beg.ncols);
+  EKAT_REQUIRE(vert_weights.nlevs_src==data_beg.nlevs);
+  EKAT_REQUIRE(vert_weights.nlevs_tgt==data_out.nlevs);
 
-  // Now use the interpolation object in || over all variables.
+  // We can ||ize over columns as well as over variables and bands
+  const int ncols = data_beg.ncols;
+  const int nlevs_tgt = data_out.nlevs;
+  const int num_vars = 1+data_beg.nswbands*3+data_beg.nlwbands;
   const int outer_iters = ncols*num_vars;
-  const auto policy_interp = ESU::get_default_team_policy(outer_iters, num_vert_packs);
-  Kokkos::parallel_for("spa_vert_interp_loop", policy_interp,
-    KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+  const auto policy = ESU::get_default_team_policy(outer_iters, nlevs_tgt);
+
+  const auto idx = vert_weights.idx;
+  const auto w   = vert_weights.w;
 
+  Kokkos::parallel_for("spa_time_vert_interp_loop", policy,
+    KOKKOS_LAMBDA(const MemberType& team) {
+
+    // The policy is over ncols*num_vars, so retrieve icol/ivar
     const int icol = team.league_rank() / num_vars;
     const int ivar = team.league_rank() % num_vars;
 
-    const auto x1 = ekat::subview(p_src,icol);
-    const auto x2 = ekat::subview(p_tgt,icol);
-
-    const auto y1 = get_var_column(input, icol,ivar);
-    const auto y2 = get_var_column(output,icol,ivar);
+    // Get column of beg/end/out variable
+    const auto var_beg = get_var_column (data_beg,icol,ivar);
+    const auto var_end = get_var_column (data_end,icol,ivar);
+    const auto var_out = get_var_column (data_out,icol,ivar);
+
+    auto time_interp = [&](const int k) {
+      const int ipack = k / Spack::n;
+      const int ivec  = k % Spack::n;
+      return linear_interp(var_beg(ipack)[ivec],var_end(ipack)[ivec],t);
+    };
 
-    vert_interp.lin_interp(team, x1, x2, y1, y2, icol);
+    Kokkos::parallel_for (Kokkos::TeamVectorRange(team,nlevs_tgt),
+                          [&] (const int k) {
+      const int i = idx(icol,k);
+      const Real y0 = time_interp(i);
+      const Real y1 = time_interp(i+1);
+      var_out(k / Spack::n)[k % Spack::n] = y0 + w(icol,k)*(y1-y0);
+    });
   });
-  Kokkos::fence();
 }
 
 /*-----------------------------------------------------------------*/
@@ -346,7 +346,92 @@ TEST_CASE("spa_main")
       check_bounds (sv(data_beg_h.aer_tau_lw,i,n),sv(data_out_h.aer_tau_lw,i,n));
     }
   }
-  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n\n";
+  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n";
+
+  // 3. The fused time+vert interpolation must match a host-side reference, which
+  //    interpolates in time, then linearly in pressure (extrapolating linearly
+  //    outside the source range). Cached weights must be updated only when
+  //    pressure changes enough.
+  std::cout << "  -> fused time+vert interp, cached weights\n";
+
+  spa_time_state.t_now = spa_time_state.t_beg_month + 0.3*spa_time_state.days_this_month;
+  const Real t = SPAFunc::get_time_fraction(spa_time_state);
+
+  const Real rel_tol = 1e-3;
+  SPAFunc::SPAOutput      spa_fused(ncols, nlevs, nswbands, nlwbands);
+  SPADataHost             data_fused_h(spa_fused);
+  SPAFunc::SPAVertWeights weights(ncols, nlevs+2, nlevs, rel_tol);
+  SPAFunc::update_vertical_weights(p_src,p_tgt,weights);
+  SPAFunc::perform_time_and_vertical_interpolation(t,spa_beg.data,spa_end.data,weights,spa_fused);
+  data_fused_h.copy_from_dev(spa_fused);
+
+  auto ref_interp = [&](const int i, const int k, const col_type& beg, const col_type& end) -> Real {
+    const Real x = p_tgt_h(i,k);
+    int j = 0;
+    while (j<nlevs && p_src_h(i,j+1)<=x) {
+      ++j;
+    }
+    const Real y0 = (1-t)*beg(j)   + t*end(j);
+    const Real y1 = (1-t)*beg(j+1) + t*end(j+1);
+    return y0 + (y1-y0)*(x-p_src_h(i,j))/(p_src_h(i,j+1)-p_src_h(i,j));
+  };
+
+  for (int i=0; i<ncols; ++i) {
+    const col_type ccn3_beg = ekat::subview(data_beg_h.ccn3,i);
+    const col_type ccn3_end = ekat::subview(data_end_h.ccn3,i);
+    for (int k=0; k<nlevs; ++k) {
+      REQUIRE (data_fused_h.ccn3(i,k) == Approx(ref_interp(i,k,ccn3_beg,ccn3_end)));
+      for (int n=0; n<nswbands; ++n) {
+        REQUIRE (data_fused_h.aer_g_sw(i,n,k) ==
+                 Approx(ref_interp(i,k,sv(data_beg_h.aer_g_sw,i,n),sv(data_end_h.aer_g_sw,i,n))));
+        REQUIRE (data_fused_h.aer_ssa_sw(i,n,k) ==
+                 Approx(ref_interp(i,k,sv(data_beg_h.aer_ssa_sw,i,n),sv(data_end_h.aer_ssa_sw,i,n))));
+        REQUIRE (data_fused_h.aer_tau_sw(i,n,k) ==
+                 Approx(ref_interp(i,k,sv(data_beg_h.aer_tau_sw,i,n),sv(data_end_h.aer_tau_sw,i,n))));
+      }
+      for (int n=0; n<nlwbands; ++n) {
+        REQUIRE (data_fused_h.aer_tau_lw(i,n,k) ==
+                 Approx(ref_interp(i,k,sv(data_beg_h.aer_tau_lw,i,n),sv(data_end_h.aer_tau_lw,i,n))));
+      }
+    }
+  }
+
+  auto w_h = Kokkos::create_mirror_view(weights.w);
+  auto w_old_h = Kokkos::create_mirror(weights.w);
+  Kokkos::deep_copy(w_old_h,weights.w);
+  auto scale_p_tgt = [&](const Real factor) {
+    for (int i=0; i<ncols; ++i) {
+      for (int k=0; k<nlevs; ++k) {
+        p_tgt_h(i,k) *= factor;
+      }
+    }
+    Kokkos::deep_copy(ekat::scalarize(p_tgt),p_tgt_h);
+  };
+
+  // A change below the tolerance leaves the weights untouched
+  scale_p_tgt(1+rel_tol/10);
+  SPAFunc::update_vertical_weights(p_src,p_tgt,weights);
+  Kokkos::deep_copy(w_h,weights.w);
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      REQUIRE (w_h(i,k)==w_old_h(i,k));
+    }
+  }
+
+  // A change above the tolerance gives the same weights as a fresh computation
+  scale_p_tgt(1+rel_tol*10);
+  SPAFunc::update_vertical_weights(p_src,p_tgt,weights);
+  SPAFunc::SPAVertWeights fresh(ncols, nlevs+2, nlevs);
+  SPAFunc::update_vertical_weights(p_src,p_tgt,fresh);
+  auto fresh_w_h = Kokkos::create_mirror_view(fresh.w);
+  Kokkos::deep_copy(w_h,weights.w);
+  Kokkos::deep_copy(fresh_w_h,fresh.w);
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      REQUIRE (w_h(i,k)==fresh_w_h(i,k));
+    }
+  }
+  std::cout << "  -> fused time+vert interp, cached weights ............... OK!\n\n";
 }
 
 // Compute min/max of input over [start,end) indices
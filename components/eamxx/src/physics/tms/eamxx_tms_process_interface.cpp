@@ -92,7 +92,7 @@ void TurbulentMountainStress::run_impl (const double /* dt */)
   const int nlev_packs = ekat::npack<Spack>(nlevs);
   // calculate_z_int contains a team-level parallel_scan, which requires a special policy
   const auto scan_policy = ekat::ExeSpaceUtils<TMSFunctions::KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncols, nlev_packs);
-  Kokkos::parallel_for(scan_policy, KOKKOS_LAMBDA (const TMSFunctions::KT::MemberType& team) {
+  Kokkos::parallel_for("TurbulentMountainStress::run_impl", scan_policy, KOKKOS_LAMBDA (const TMSFunctions::KT::MemberType& team) {
     const int i = team.league_rank();
 
     const auto p_mid_i = ekat::subview(p_mid, i);
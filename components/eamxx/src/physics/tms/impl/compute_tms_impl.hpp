@@ -34,7 +34,7 @@ void Functions<S,D>::compute_tms(
 
   // Loop over columns
   const typename KT::RangePolicy policy (0,ncols);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& i) {
+  Kokkos::parallel_for("tms::compute_tms", policy, KOKKOS_LAMBDA(const int& i) {
     // Subview on column, scalarize since we only care about last 2 levels (never loop over levels)
     const auto u_wind_i = ekat::subview(horiz_wind, i, 0);
     const auto v_wind_i = ekat::subview(horiz_wind, i, 1);
@@ -148,11 +148,19 @@ struct PyAtmProc {
     output_mgr->set_logger(ap->get_logger());
   }
 
-  void run (double dt) {
-    ap->run(dt);
-    time += dt;
-    if (output_mgr) {
-      output_mgr->run(time);
+  // Run nsteps steps of size dt, without returning to python in between.
+  // NOTE: the GIL is NOT released while running, since some processes (e.g.,
+  //       MLCorrection) call back into python from their run method.
+  void run (double dt, int nsteps) {
+    EKAT_REQUIRE_MSG (nsteps>=1,
+        "Error! Number of steps must be positive.\n"
+        "  - nsteps: " + std::to_string(nsteps) + "\n");
+    for (int n=0; n<nsteps; ++n) {
+      ap->run(dt);
+      time += dt;
+      if (output_mgr) {
+        output_mgr->run(time);
+      }
     }
   }
 };
@@ -165,7 +173,8 @@ inline void pybind_pyatmproc(pybind11::module& m)
     .def("get_field",&PyAtmProc::get_field)
     .def("initialize",&PyAtmProc::initialize)
     .def("setup_output",&PyAtmProc::setup_output)
-    .def("run",&PyAtmProc::run)
+    .def("run",&PyAtmProc::run,
+         pybind11::arg("dt"),pybind11::arg("nsteps")=1)
     .def("read_ic",&PyAtmProc::read_ic);
 }
 } // namespace scream
@@ -0,0 +1,86 @@
+#ifndef PYDLPACK_HPP
+#define PYDLPACK_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+
+// Minimal subset of the DLPack ABI (https://github.com/dmlc/dlpack), which
+// is all we need to export Field device views to python array libraries
+// (CuPy, PyTorch, JAX,...) without copies. The layout of these structs is
+// fixed by the DLPack standard, so we can define them here, rather than
+// adding a dependency on dlpack.h.
+
+namespace scream {
+namespace dlpack {
+
+enum DLDeviceType : int32_t {
+  kDLCPU    = 1,
+  kDLCUDA   = 2,
+  kDLROCM   = 10,
+  kDLOneAPI = 14
+};
+
+enum DLDataTypeCode : uint8_t {
+  kDLInt   = 0,
+  kDLFloat = 2
+};
+
+struct DLDevice {
+  DLDeviceType device_type;
+  int32_t device_id;
+};
+
+struct DLDataType {
+  uint8_t code;
+  uint8_t bits;
+  uint16_t lanes;
+};
+
+struct DLTensor {
+  void* data;
+  DLDevice device;
+  int32_t ndim;
+  DLDataType dtype;
+  int64_t* shape;
+  int64_t* strides;
+  uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+  DLTensor dl_tensor;
+  void* manager_ctx;
+  void (*deleter)(DLManagedTensor* self);
+};
+
+inline DLDataType make_dtype (const DLDataTypeCode code, const int nbytes) {
+  DLDataType dt;
+  dt.code  = code;
+  dt.bits  = 8*nbytes;
+  dt.lanes = 1;
+  return dt;
+}
+
+// The device where the default Kokkos memory space lives
+inline DLDevice get_default_device () {
+  DLDevice dev;
+#if defined(KOKKOS_ENABLE_CUDA)
+  dev.device_type = kDLCUDA;
+  dev.device_id = Kokkos::device_id();
+#elif defined(KOKKOS_ENABLE_HIP)
+  dev.device_type = kDLROCM;
+  dev.device_id = Kokkos::device_id();
+#elif defined(KOKKOS_ENABLE_SYCL)
+  dev.device_type = kDLOneAPI;
+  dev.device_id = Kokkos::device_id();
+#else
+  dev.device_type = kDLCPU;
+  dev.device_id = 0;
+#endif
+  return dev;
+}
+
+} // namespace dlpack
+} // namespace scream
+
+#endif // PYDLPACK_HPP
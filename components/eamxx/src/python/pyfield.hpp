@@ -4,6 +4,8 @@
 #include "share/field/field.hpp"
 #include "share/field/field_utils.hpp"
 
+#include "pydlpack.hpp"
+
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 #include <pybind11/stl.h>
@@ -45,17 +47,24 @@ struct PyField {
     pybind11::dtype dt;
     switch (fid.data_type()) {
       case DataType::IntType:
-        dt = get_dt_and_set_strides<int>(strides);
+        dt = pybind11::dtype::of<int>();
+        strides = get_strides<int,Host>();
         break;
       case DataType::FloatType:
-        dt = get_dt_and_set_strides<float>(strides);
+        dt = pybind11::dtype::of<float>();
+        strides = get_strides<float,Host>();
         break;
       case DataType::DoubleType:
-        dt = get_dt_and_set_strides<double>(strides);
+        dt = pybind11::dtype::of<double>();
+        strides = get_strides<double,Host>();
         break;
       default:
         EKAT_ERROR_MSG ("Unrecognized/unsupported data type.\n");
     }
+    // Numpy wants strides in bytes
+    for (auto& s : strides) {
+      s *= dt.itemsize();
+    }
 
     // NOTE: you MUST set the parent handle, or else you won't have view semantic
     auto data = f.get_internal_view_data_unsafe<void,Host>();
@@ -63,6 +72,83 @@ struct PyField {
     return pybind11::array(dt,shape,strides,data,pybind11::handle(this_obj));
   }
 
+  // Export the device view of the field via the DLPack protocol, so that
+  // python array libraries (CuPy, PyTorch,...) can use it without copies.
+  // NOTE: unlike get(), this is the *device* data: do not mix the two without
+  //       calling sync_to_host/sync_to_dev as needed. On host-only builds,
+  //       host and device views share the same memory.
+  pybind11::capsule dlpack (pybind11::object /* stream */) const {
+    const auto& fh  = f.get_header();
+    const auto& fid = fh.get_identifier();
+    EKAT_REQUIRE_MSG (fh.get_parent().lock()==nullptr,
+        "Error! Cannot export a field that is a subfield of another. Please, export the parent field.\n"
+        "  - field name : " + fid.name() + "\n"
+        "  - parent name: " + fh.get_parent().lock()->get_identifier().name() + "\n");
+
+    // The context keeps the field (hence its memory) alive until the consumer is done
+    struct Context {
+      Field f;
+      std::vector<int64_t> shape;
+      std::vector<int64_t> strides;
+      dlpack::DLManagedTensor tensor;
+    };
+    auto ctx = new Context;
+    ctx->f = f;
+    for (auto d : fid.get_layout().dims()) {
+      ctx->shape.push_back(d);
+    }
+
+    auto& t = ctx->tensor.dl_tensor;
+    std::vector<ssize_t> strides;
+    switch (fid.data_type()) {
+      case DataType::IntType:
+        t.dtype = dlpack::make_dtype(dlpack::kDLInt,sizeof(int));
+        strides = get_strides<int,Device>();
+        break;
+      case DataType::FloatType:
+        t.dtype = dlpack::make_dtype(dlpack::kDLFloat,sizeof(float));
+        strides = get_strides<float,Device>();
+        break;
+      case DataType::DoubleType:
+        t.dtype = dlpack::make_dtype(dlpack::kDLFloat,sizeof(double));
+        strides = get_strides<double,Device>();
+        break;
+      default:
+        delete ctx;
+        EKAT_ERROR_MSG ("Unrecognized/unsupported data type.\n");
+    }
+    ctx->strides.assign(strides.begin(),strides.end());
+
+    t.data = f.get_internal_view_data_unsafe<void,Device>();
+    t.device = dlpack::get_default_device();
+    t.ndim = ctx->shape.size();
+    t.shape = ctx->shape.data();
+    t.strides = ctx->strides.data();
+    t.byte_offset = 0;
+    ctx->tensor.manager_ctx = ctx;
+    ctx->tensor.deleter = [](dlpack::DLManagedTensor* self) {
+      delete static_cast<Context*>(self->manager_ctx);
+    };
+
+    // We don't know which stream the consumer will use, so make sure
+    // any pending kernel that may be writing the field is done.
+    Kokkos::fence();
+
+    // Per the DLPack protocol, the consumer renames the capsule to "used_dltensor"
+    // once it takes ownership, in which case it is responsible for calling the deleter.
+    return pybind11::capsule(&ctx->tensor,"dltensor",[](PyObject* cap) {
+      if (PyCapsule_IsValid(cap,"dltensor")) {
+        auto mt = static_cast<dlpack::DLManagedTensor*>(PyCapsule_GetPointer(cap,"dltensor"));
+        mt->deleter(mt);
+      }
+    });
+  }
+
+  pybind11::tuple dlpack_device () const {
+    const auto dev = dlpack::get_default_device();
+    return pybind11::make_tuple(static_cast<int>(dev.device_type),dev.device_id);
+  }
+
   void sync_to_host () {
     f.sync_to_host();
   }
@@ -74,59 +160,29 @@ struct PyField {
   }
 private:
 
-  template<typename T>
-  pybind11::dtype get_dt_and_set_strides (std::vector<ssize_t>& strides) const
+  // Get the strides (in number of elements) of the host/device view
+  template<typename T, HostOrDevice HD>
+  std::vector<ssize_t> get_strides () const
   {
-    strides.resize(f.rank());
-    switch (f.rank()) {
-      case 1:
-      {
-        auto v = f.get_view<const T*,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        break;
-      }
-      case 2:
-      {
-        auto v = f.get_view<const T**,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        strides[1] = v.stride(1)*sizeof(T);
-        break;
-      }
-      case 3:
-      {
-        auto v = f.get_view<const T***,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        strides[1] = v.stride(1)*sizeof(T);
-        strides[2] = v.stride(2)*sizeof(T);
-        break;
-      }
-      case 4:
-      {
-        auto v = f.get_view<const T****,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        strides[1] = v.stride(1)*sizeof(T);
-        strides[2] = v.stride(2)*sizeof(T);
-        strides[3] = v.stride(3)*sizeof(T);
-        break;
-      }
-      case 5:
-      {
-        auto v = f.get_view<const T*****,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        strides[1] = v.stride(1)*sizeof(T);
-        strides[2] = v.stride(2)*sizeof(T);
-        strides[3] = v.stride(3)*sizeof(T);
-        strides[4] = v.stride(4)*sizeof(T);
-        break;
+    std::vector<ssize_t> strides(f.rank());
+    auto set = [&](const auto& v) {
+      for (int i=0; i<f.rank(); ++i) {
+        strides[i] = v.stride(i);
       }
+    };
+    switch (f.rank()) {
+      case 1: set(f.get_view<const T*,HD>());     break;
+      case 2: set(f.get_view<const T**,HD>());    break;
+      case 3: set(f.get_view<const T***,HD>());   break;
+      case 4: set(f.get_view<const T****,HD>());  break;
+      case 5: set(f.get_view<const T*****,HD>()); break;
       default:
         EKAT_ERROR_MSG (
             "Unsupported field rank in PyField.\n"
             " - field name: " + f.name() + "\n"
             " - field rnak: " + std::to_string(f.rank()) + "\n");
     }
-
-    return pybind11::dtype::of<T>();
+    return strides;
   }
 };
 
@@ -135,6 +191,8 @@ inline void pybind_pyfield (pybind11::module& m) {
   pybind11::class_<PyField>(m,"Field")
     .def(pybind11::init<>())
     .def("get",&PyField::get)
+    .def("__dlpack__",&PyField::dlpack,pybind11::arg("stream")=pybind11::none())
+    .def("__dlpack_device__",&PyField::dlpack_device)
     .def("sync_to_host",&PyField::sync_to_host)
     .def("sync_to_dev",&PyField::sync_to_dev)
     .def("print",&PyField::print);
@@ -0,0 +1,36 @@
+# Check that fields can be exported via the DLPack protocol, without copies
+from pyeamxx import pyscream as ps
+import numpy as np
+
+def main ():
+    ncols = 4
+    nlevs = 8
+    grid = ps.Grid("Physics",ncols,nlevs)
+    params = ps.ParameterList({"Type" : "CldFraction"},"cld_fraction")
+    ap = ps.AtmProc(params,grid)
+
+    f = ap.get_field("qi")
+    dev_type, dev_id = f.__dlpack_device__()
+    assert dev_id==0
+
+    # On device builds, numpy can't import the tensor, so there's nothing else to check
+    if dev_type!=1:   # kDLCPU
+        print ("Device build: skipping host checks")
+        return
+
+    # The DLPack export aliases the field data (on host-only builds, same as get())
+    v = np.from_dlpack(f)
+    assert v.shape==(ncols,nlevs)
+    assert v.dtype==np.float64 or v.dtype==np.float32
+    v[:] = 0.5
+    assert np.all(f.get()==0.5)
+
+    # Each export is a new capsule, and the field outlives all of them
+    for _ in range(3):
+        w = np.from_dlpack(f)
+        assert np.all(w==0.5)
+
+if __name__ == "__main__":
+    ps.init()
+    main()
+    ps.finalize()
@@ -0,0 +1,48 @@
+# Check that running N steps in one call matches N calls with one step each
+from pyeamxx import pyscream as ps
+import numpy as np
+
+def create (grid):
+    params = ps.ParameterList({"Type" : "CldFraction"},"cld_fraction")
+    ap = ps.AtmProc(params,grid)
+    rng = np.random.default_rng(42)
+    for name in ["qi","cldfrac_liq"]:
+        f = ap.get_field(name)
+        f.get()[:] = rng.uniform(0,1e-4 if name=="qi" else 1,size=f.get().shape)
+        f.sync_to_dev()
+    ap.initialize("2021-10-12-45000")
+    return ap
+
+def main ():
+    ncols = 4
+    nlevs = 8
+    nsteps = 3
+    dt = 300.0
+    grid = ps.Grid("Physics",ncols,nlevs)
+
+    ap1 = create(grid)
+    ap2 = create(grid)
+    ap1.run(dt,nsteps=nsteps)
+    for _ in range(nsteps):
+        ap2.run(dt)
+
+    for name in ["cldfrac_tot","cldfrac_ice"]:
+        f1 = ap1.get_field(name)
+        f2 = ap2.get_field(name)
+        f1.sync_to_host()
+        f2.sync_to_host()
+        assert np.array_equal(f1.get(),f2.get())
+
+    # The number of steps must be positive
+    try:
+        ap1.run(dt,nsteps=0)
+        raise AssertionError("run with nsteps=0 should have failed")
+    except AssertionError:
+        raise
+    except Exception:
+        pass
+
+if __name__ == "__main__":
+    ps.init()
+    main()
+    ps.finalize()
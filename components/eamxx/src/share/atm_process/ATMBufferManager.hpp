@@ -2,6 +2,7 @@
 #define SCREAM_ATM_BUFFERS_MANAGER_HPP
 
 #include "share/scream_types.hpp"
+#include "share/util/eamxx_metrics.hpp"
 #include "ekat/ekat_assert.hpp"
 
 namespace scream {
@@ -42,6 +43,7 @@ struct ATMBufferManager {
 
     m_buffer = view_1d<Real>("",m_size);
     m_allocated = true;
+    Metrics::instance().add_device_bytes(allocated_bytes());
   }
 
   bool allocated () const { return m_allocated; }
@@ -1,5 +1,7 @@
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/util/scream_timing.hpp"
+#include "share/util/eamxx_metrics.hpp"
+#include "share/util/eamxx_precision_cast.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 #include "share/field/field_utils.hpp"
 
@@ -12,6 +14,95 @@
 namespace scream
 {
 
+namespace {
+
+// Describe the entries of a Real field as num_rows rows of row_len contiguous
+// entries, equally spaced (by stride entries) in the field's internal view,
+// with the first row starting at entry offset. This is possible for standard
+// fields (possibly padded), and for static single-slice subfields, provided that
+// the slicing does not break the uniform spacing of the rows (which is the case
+// for, e.g., tracers in the tracers group). Returns false otherwise.
+bool get_field_rows (const Field& f, int& offset, int& num_rows, int& row_len, int& stride)
+{
+  const auto& fh = f.get_header();
+  if (fh.get_identifier().data_type()!=get_data_type<Real>()) {
+    return false;
+  }
+
+  const auto& ap = fh.get_alloc_properties();
+  std::vector<int> dims = fh.get_identifier().get_layout().dims();
+  int last_extent = ap.get_last_extent();
+  offset = 0;
+  if (ap.is_subfield()) {
+    const auto& info = ap.get_subview_info();
+    const auto parent = fh.get_parent().lock();
+    if (info.dynamic or info.slice_idx_end>=0 or not parent or
+        parent->get_alloc_properties().is_subfield()) {
+      return false;
+    }
+    dims = parent->get_identifier().get_layout().dims();
+    last_extent = parent->get_alloc_properties().get_last_extent();
+    const int prank = dims.size();
+    const int d = info.dim_idx;
+    const int k = info.slice_idx;
+    if (d==prank-1) {
+      // Slicing the last dim: each row is a single entry
+      offset = k;
+      stride = last_extent;
+      row_len = 1;
+      num_rows = 1;
+      for (int i=0; i<prank-1; ++i) {
+        num_rows *= dims[i];
+      }
+      return true;
+    } else if (d==0) {
+      // Slicing the first dim: the subfield is a contiguous chunk of the parent
+      int chunk = last_extent;
+      for (int i=1; i<prank-1; ++i) {
+        chunk *= dims[i];
+      }
+      offset = k*chunk;
+      dims.erase(dims.begin());
+    } else if (d==prank-2) {
+      // Slicing the dim right before the last one: rows are spaced by dims[d]*last_extent
+      offset = k*last_extent;
+      stride = dims[d]*last_extent;
+      row_len = dims.back();
+      num_rows = 1;
+      for (int i=0; i<d; ++i) {
+        num_rows *= dims[i];
+      }
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  const int rank = dims.size();
+  row_len = rank>0 ? dims.back() : 1;
+  stride  = rank>0 ? last_extent : 1;
+  num_rows = 1;
+  for (int i=0; i<rank-1; ++i) {
+    num_rows *= dims[i];
+  }
+  return true;
+}
+
+// Describe a field and its tendency with the same rows (see get_field_rows),
+// so that the start-of-step snapshot can be stored and used for both.
+// Returns false if either cannot be described by rows, or if the rows differ.
+bool get_tendency_rows (const Field& f, const Field& tend,
+                        int& f_offset, int& t_offset, int& num_rows, int& row_len,
+                        int& f_stride, int& t_stride)
+{
+  int t_rows, t_len;
+  return get_field_rows(f,f_offset,num_rows,row_len,f_stride) and
+         get_field_rows(tend,t_offset,t_rows,t_len,t_stride) and
+         t_rows==num_rows and t_len==row_len;
+}
+
+} // anonymous namespace
+
 ekat::logger::LogLevel str2LogLevel (const std::string& s) {
   using namespace ekat::logger;
 
@@ -64,23 +155,44 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
       m_params.get<bool>("enable_column_conservation_checks", false);
 
   m_internal_diagnostics_level = m_params.get<int>("internal_diagnostics_level", 0);
+
+  const auto precision = m_params.get<std::string>("compute_precision","double");
+  EKAT_REQUIRE_MSG (precision=="double" || precision=="single",
+      "Error! Invalid value for compute_precision in param list " + m_params.name() + ".\n"
+      "  - compute_precision: " + precision + "\n"
+      "  - valid values: double, single\n");
+  m_single_precision = precision=="single" && sizeof(Real)>sizeof(SingleReal);
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
+  EKAT_REQUIRE_MSG (not m_single_precision || supports_single_precision(),
+      "Error! Atm process '" + this->name() + "' does not support compute_precision=single.\n");
   if (this->type()!=AtmosphereProcessType::Group) {
     start_timer (m_timer_prefix + this->name() + "::init");
   }
+  Metrics::instance().start_region(this->name());
+  Kokkos::Profiling::pushRegion(this->name() + "::init");
   set_fields_and_groups_pointers();
   m_time_stamp = t0;
   initialize_impl(run_type);
 
-  // Create all start-of-step fields needed for tendencies calculation
-  for (const auto& it : m_proc_tendencies) {
-    const auto& tname = it.first;
-    const auto& fname = m_tend_to_field.at(tname);
-    m_start_of_step_fields[fname] = get_field_out(fname).clone();
+  // The number of columns processed at each run is the (local) number of
+  // columns of our fields, if any is defined on a physics-like grid
+  using namespace ShortFieldTagsNames;
+  for (const auto fields : {&m_fields_in, &m_fields_out}) {
+    for (const auto& f : *fields) {
+      const auto& fl = f.get_header().get_identifier().get_layout();
+      if (m_num_metrics_cols==0 && fl.rank()>0 && fl.tag(0)==COL) {
+        m_num_metrics_cols = fl.dim(0);
+      }
+    }
   }
 
+  // Create all start-of-step storage needed for tendencies calculation
+  setup_tendencies_snapshots();
+
+  Kokkos::Profiling::popRegion();
+  Metrics::instance().stop_region(this->name());
   if (this->type()!=AtmosphereProcessType::Group) {
     stop_timer (m_timer_prefix + this->name() + "::init");
   }
@@ -89,6 +201,10 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 void AtmosphereProcess::run (const double dt) {
   m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
   start_timer (m_timer_prefix + this->name() + "::run");
+  auto& metrics = Metrics::instance();
+  metrics.start_region(this->name());
+  metrics.add_columns(m_num_metrics_cols);
+  Kokkos::Profiling::pushRegion(this->name() + "::run");
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
@@ -139,6 +255,53 @@ void AtmosphereProcess::run (const double dt) {
     // Update all output fields time stamps
     update_time_stamps ();
   }
+  Kokkos::Profiling::popRegion();
+  metrics.stop_region(this->name());
+  stop_timer (m_timer_prefix + this->name() + "::run");
+}
+
+bool AtmosphereProcess::can_run_column_blocked () const {
+  return supports_column_blocking() &&
+         m_num_subcycles==1 &&
+         not m_compute_proc_tendencies &&
+         not m_column_conservation_check_data.has_check &&
+         m_internal_diagnostics_level==0;
+}
+
+// NOTE: the processes of a column-blocked chain interleave, so the "::run" timer
+//       is started/stopped around each of the calls below, rather than held from
+//       begin to end. This way, it accumulates the time spent in this process only.
+void AtmosphereProcess::begin_column_blocked_run (const bool precondition_checks) {
+  m_atm_logger->debug("[EAMxx::" + this->name() + "] run (column-blocked)...");
+  start_timer (m_timer_prefix + this->name() + "::run");
+  if (precondition_checks && m_params.get("enable_precondition_checks", true)) {
+    run_precondition_checks();
+  }
+  stop_timer (m_timer_prefix + this->name() + "::run");
+}
+
+void AtmosphereProcess::run_columns (const double dt, const int icol_beg, const int icol_end) {
+  start_timer (m_timer_prefix + this->name() + "::run");
+  auto& metrics = Metrics::instance();
+  metrics.start_region(this->name());
+  metrics.add_columns(icol_end-icol_beg);
+  Kokkos::Profiling::pushRegion(this->name() + "::run");
+  run_columns_impl(dt,icol_beg,icol_end);
+  Kokkos::Profiling::popRegion();
+  metrics.stop_region(this->name());
+  stop_timer (m_timer_prefix + this->name() + "::run");
+}
+
+void AtmosphereProcess::end_column_blocked_run (const double dt) {
+  start_timer (m_timer_prefix + this->name() + "::run");
+  if (m_params.get("enable_postcondition_checks", true)) {
+    run_postcondition_checks();
+  }
+
+  m_time_stamp += dt;
+  if (m_update_time_stamps) {
+    update_time_stamps ();
+  }
   stop_timer (m_timer_prefix + this->name() + "::run");
 }
 
@@ -492,11 +655,94 @@ void AtmosphereProcess::run_column_conservation_check () const {
   m_atm_logger->debug("[" + this->name() + "] run_column-conservation_checks...done!");
 }
 
+size_t AtmosphereProcess::requested_tendencies_buffer_size_in_bytes () const {
+  size_t num_reals = 0;
+  for (const auto& it : m_proc_tendencies) {
+    const auto& tend = it.second;
+    const auto& f    = get_field_out(m_tend_to_field.at(it.first));
+    int f_offset, t_offset, num_rows, row_len, f_stride, t_stride;
+    if (get_tendency_rows(f,tend,f_offset,t_offset,num_rows,row_len,f_stride,t_stride)) {
+      num_reals += num_rows*row_len;
+    }
+  }
+  return num_reals*sizeof(Real);
+}
+
+void AtmosphereProcess::init_tendencies_buffer (const ATMBufferManager& buffer_manager) {
+  const size_t offset = requested_buffer_size_in_bytes();
+  const size_t nbytes = requested_tendencies_buffer_size_in_bytes();
+  if (nbytes==0) {
+    return;
+  }
+  EKAT_REQUIRE_MSG (buffer_manager.allocated_bytes()>=offset+nbytes,
+      "Error! Buffers size not sufficient to store tendencies snapshots.\n"
+      "   - Atm proc name: " + this->name() + "\n"
+      "   - Requested bytes: " + std::to_string(offset+nbytes) + "\n"
+      "   - Allocated bytes: " + std::to_string(buffer_manager.allocated_bytes()) + "\n");
+  m_tend_snapshots_mem = buffer_manager.get_memory() + offset/sizeof(Real);
+}
+
+void AtmosphereProcess::setup_tendencies_snapshots () {
+  std::vector<TendencyRows> rows;
+  int num_reals = 0;
+  for (const auto& it : m_proc_tendencies) {
+    const auto& fname = m_tend_to_field.at(it.first);
+    const auto& tend  = it.second;
+    const auto& f     = get_field_out(fname);
+    int f_offset, t_offset;
+    TendencyRows r;
+    if (get_tendency_rows(f,tend,f_offset,t_offset,r.num_rows,r.row_len,
+                          r.field_stride,r.tend_stride)) {
+      r.field  = f.get_internal_view_data<Real>() + f_offset;
+      r.tend   = tend.get_internal_view_data<Real>() + t_offset;
+      r.offset = num_reals;
+      num_reals += r.num_rows*r.row_len;
+      rows.push_back(r);
+    } else {
+      m_start_of_step_fields[it.first] = f.clone();
+    }
+  }
+
+  if (num_reals==0) {
+    return;
+  }
+
+  m_tend_rows = decltype(m_tend_rows)("tend_rows",rows.size());
+  auto rows_h = Kokkos::create_mirror_view(m_tend_rows);
+  std::copy(rows.begin(),rows.end(),rows_h.data());
+  Kokkos::deep_copy(m_tend_rows,rows_h);
+
+  if (m_tend_snapshots_mem==nullptr) {
+    m_tend_snapshots_storage = decltype(m_tend_snapshots_storage)("tend_snapshots",num_reals);
+    m_tend_snapshots_mem = m_tend_snapshots_storage.data();
+  }
+  m_tend_snapshots = decltype(m_tend_snapshots)(m_tend_snapshots_mem,num_reals);
+}
+
 void AtmosphereProcess::init_step_tendencies () {
   if (m_compute_proc_tendencies) {
     start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+
+    // Store start-of-step values of all fields at once
+    const auto rows = m_tend_rows;
+    const auto snap = m_tend_snapshots;
+    const int nfields = rows.size();
+    Kokkos::parallel_for("init_step_tendencies",
+                         KokkosTypes<DefaultDevice>::RangePolicy(0,snap.size()),
+                         KOKKOS_LAMBDA (const int idx) {
+      int i = 0;
+      while (i<nfields-1 and idx>=rows(i+1).offset) {
+        ++i;
+      }
+      const auto& r = rows(i);
+      const int n   = idx - r.offset;
+      const int row = n / r.row_len;
+      const int j   = n % r.row_len;
+      snap(idx) = r.field[row*r.field_stride + j];
+    });
+
     for (auto& it : m_start_of_step_fields) {
-      const auto& fname = it.first;
+      const auto& fname = m_tend_to_field.at(it.first);
       const auto& f     = get_field_out(fname);
             auto& f_beg = it.second;
       f_beg.deep_copy(f);
@@ -510,13 +756,33 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
   if (m_compute_proc_tendencies) {
     m_atm_logger->debug("[" + this->name() + "] computing tendencies...");
     start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
-    for (auto it : m_proc_tendencies) {
+
+    // Compute tend from this atm proc step for all fields at once,
+    // then sum into overall atm timestep tendency
+    const auto rows = m_tend_rows;
+    const auto snap = m_tend_snapshots;
+    const int nfields = rows.size();
+    Kokkos::parallel_for("compute_step_tendencies",
+                         KokkosTypes<DefaultDevice>::RangePolicy(0,snap.size()),
+                         KOKKOS_LAMBDA (const int idx) {
+      int i = 0;
+      while (i<nfields-1 and idx>=rows(i+1).offset) {
+        ++i;
+      }
+      const auto& r = rows(i);
+      const int n   = idx - r.offset;
+      const int row = n / r.row_len;
+      const int j   = n % r.row_len;
+      r.tend[row*r.tend_stride + j] += r.field[row*r.field_stride + j] - snap(idx);
+    });
+
+    for (auto& it : m_start_of_step_fields) {
       // Note: f_beg is nonconst, so we can store step tendency in it
       const auto& tname = it.first;
       const auto& fname = m_tend_to_field.at(tname);
       const auto& f     = get_field_out(fname);
-            auto& f_beg = m_start_of_step_fields.at(fname);
-            auto& tend  = it.second;
+            auto& f_beg = it.second;
+            auto& tend  = m_proc_tendencies.at(tname);
 
       // Compute tend from this atm proc step, then sum into overall atm timestep tendency
       f_beg.update(f,1,-1);
@@ -113,6 +113,19 @@ public:
   void run (const double dt);
   void finalize   (/* what inputs? */);
 
+  // Column-blocked execution. A group of column-local processes can advance its whole
+  // chain on one block of columns at a time (see AtmosphereProcessGroup), rather than
+  // streaming all columns through each process in turn. For each step, the group calls
+  // begin_column_blocked_run on each process, then run_columns for each block of
+  // columns and each process, and finally end_column_blocked_run on each process.
+  // A process can run this way only if the derived class supports it (see
+  // supports_column_blocking), and if it does not need any of the whole-step
+  // machinery of 'run' (subcycling, tendencies, conservation checks, state hashing).
+  bool can_run_column_blocked () const;
+  void begin_column_blocked_run (const bool precondition_checks);
+  void run_columns (const double dt, const int icol_beg, const int icol_end);
+  void end_column_blocked_run (const double dt);
+
   // Return the MPI communicator
   const ekat::Comm& get_comm () const { return m_comm; }
 
@@ -213,6 +226,21 @@ public:
         "   - Atm proc name: " + this->name() + "\n");
   }
 
+  // Number of bytes needed to store the start-of-step values of the updated fields
+  // whose tendency was requested. This memory is carved from the ATMBufferManager,
+  // right after the requested_buffer_size_in_bytes() bytes used by the process itself,
+  // since it must persist across the run_impl call.
+  size_t requested_tendencies_buffer_size_in_bytes () const;
+
+  // The total number of bytes this process needs from the ATMBufferManager
+  size_t total_buffer_size_in_bytes () const {
+    return requested_buffer_size_in_bytes() + requested_tendencies_buffer_size_in_bytes();
+  }
+
+  // Set the start-of-step tendencies storage using memory provided by the
+  // ATMBufferManager. If this is not called, the atm proc allocates its own storage.
+  void init_tendencies_buffer (const ATMBufferManager& buffer_manager);
+
   // Convenience function to retrieve input/output fields from the field/group (and grid) name.
   // Note: the version without grid name only works if there is only one copy of the field/group.
   //       In that case, the single copy is returned, regardless of the associated grid name.
@@ -298,6 +326,10 @@ protected:
 
   int get_internal_diagnostics_level () const { return m_internal_diagnostics_level; }
 
+  // Whether this process runs its computations in single precision (see compute_precision
+  // param). Always false if Real is already single precision.
+  bool use_single_precision () const { return m_single_precision; }
+
   // Derived classes can used these method, so that if we change how fields/groups
   // requirement are stored (e.g., change the std container), they don't need to change
   // their implementation.
@@ -413,6 +445,20 @@ protected:
   // (of size dt). This method is called before the timestamp is updated.
   virtual void run_impl(const double dt) = 0;
 
+  // Override these methods if the process only performs column-local computations,
+  // and can advance columns [icol_beg,icol_end) by one step of size dt independently
+  // of all other columns. This enables column-blocked execution in a group.
+  virtual bool supports_column_blocking () const { return false; }
+  virtual void run_columns_impl (const double /* dt */, const int /* icol_beg */, const int /* icol_end */) {
+    EKAT_ERROR_MSG ("Error! Atm process '" + name() + "' does not support column-blocked execution.\n");
+  }
+
+  // Override this method if the process can run its computations in single precision
+  // when Real is double. The fields in the field manager are always stored as Real, so
+  // such a process must cast its inputs to SingleReal (see eamxx_precision_cast.hpp)
+  // at the beginning of the run, and its outputs back to Real at the end.
+  virtual bool supports_single_precision () const { return false; }
+
   // Override this method to finalize the derived class
   virtual void finalize_impl(/* what inputs? */) = 0;
 
@@ -532,6 +578,29 @@ private:
   strmap_t<Field>          m_proc_tendencies;
   strmap_t<Field>          m_start_of_step_fields;
 
+  // Most updated fields (including tracers, which are subfields of the tracers group)
+  // can be seen as a set of equally spaced rows of contiguous entries. For those,
+  // the start-of-step values are stored back to back in a single array, so that
+  // all snapshots (and all tendencies) are computed with a single kernel, rather
+  // than with one deep copy (and one update) per field. Fields that do not fit
+  // this description are stored in m_start_of_step_fields instead.
+  struct TendencyRows {
+    Real* field;
+    Real* tend;
+    int   field_stride;
+    int   tend_stride;
+    int   num_rows;
+    int   row_len;
+    // Offset of this field's start-of-step values in m_tend_snapshots
+    int   offset;
+  };
+  void setup_tendencies_snapshots ();
+
+  KokkosTypes<DefaultDevice>::view_1d<TendencyRows>            m_tend_rows;
+  Unmanaged<KokkosTypes<DefaultDevice>::view_1d<Real>>         m_tend_snapshots;
+  KokkosTypes<DefaultDevice>::view_1d<Real>                    m_tend_snapshots_storage;
+  Real*                                                        m_tend_snapshots_mem = nullptr;
+
   // These maps help to retrieve a field/group stored in the lists above. E.g.,
   //   auto ptr = m_field_in_pointers[field_name][grid_name];
   // then *ptr is a field in m_fields_in, with name $field_name, on grid $grid_name.
@@ -587,6 +656,12 @@ private:
   // Controls global hashing output for debugging non-BFBness.
   int m_internal_diagnostics_level;
 
+  // Number of local columns of this process' fields, recorded in the metrics at every run
+  int m_num_metrics_cols = 0;
+
+  // Whether the user requested compute_precision=single (and Real is double)
+  bool m_single_precision = false;
+
 protected:
 
   // IOP object
@@ -6,6 +6,7 @@
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <algorithm>
 #include <memory>
 
 namespace scream {
@@ -33,6 +34,11 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
     m_group_schedule_type = ScheduleType::Sequential;
   }
 
+  m_column_block_size = m_params.get<int>("column_block_size",0);
+  EKAT_REQUIRE_MSG (m_column_block_size>=0,
+      "Error! Invalid column_block_size (" + std::to_string(m_column_block_size) + ").\n"
+      "   atm process group: " + params.name() + "\n");
+
   // Create the individual atmosphere processes
   m_group_name = params.name();
 
@@ -385,6 +391,11 @@ void AtmosphereProcessGroup::run_impl (const double dt) {
 }
 
 void AtmosphereProcessGroup::run_sequential (const double dt) {
+  if (m_column_block_size>0) {
+    run_column_blocked(dt);
+    return;
+  }
+
   // Get the timestamp at the beginning of the step and advance it.
   auto ts = timestamp();
   ts += dt;
@@ -407,6 +418,85 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
   }
 }
 
+void AtmosphereProcessGroup::setup_column_blocking () {
+  // NOTE: we cannot do this during initialization, since conservation checks
+  //       are added to the processes only after they are initialized.
+  for (const auto& atm_proc : m_atm_processes) {
+    EKAT_REQUIRE_MSG (atm_proc->type()==AtmosphereProcessType::Physics &&
+                      atm_proc->can_run_column_blocked(),
+        "Error! Column-blocked execution requested, but not supported by one of the processes.\n"
+        "   atm process group: " + name() + "\n"
+        "   atm process: " + atm_proc->name() + "\n"
+        "Column-blocked execution requires column-local physics processes, with no subcycling,\n"
+        "no tendencies output, no conservation checks, and internal_diagnostics_level=0.\n");
+  }
+
+  // All fields with columns must have the same number of columns
+  using namespace ShortFieldTagsNames;
+  auto check_ncols = [&](const Field& f) {
+    const auto& fid = f.get_header().get_identifier();
+    const auto& layout = fid.get_layout();
+    if (layout.rank()==0 || layout.tag(0)!=COL) {
+      return;
+    }
+    if (m_num_blocked_cols<0) {
+      m_num_blocked_cols = layout.dim(0);
+    }
+    EKAT_REQUIRE_MSG (layout.dim(0)==m_num_blocked_cols,
+        "Error! Column-blocked execution requires all fields to have the same number of columns.\n"
+        "   atm process group: " + name() + "\n"
+        "   field: " + fid.get_id_string() + "\n"
+        "   expected number of columns: " + std::to_string(m_num_blocked_cols) + "\n");
+  };
+  for (const auto& atm_proc : m_atm_processes) {
+    for (const auto& f : atm_proc->get_fields_in())  { check_ncols(f); }
+    for (const auto& f : atm_proc->get_fields_out()) { check_ncols(f); }
+    for (const auto& g : atm_proc->get_groups_in()) {
+      for (const auto& it : g.m_fields) { check_ncols(*it.second); }
+    }
+    for (const auto& g : atm_proc->get_groups_out()) {
+      for (const auto& it : g.m_fields) { check_ncols(*it.second); }
+    }
+  }
+  EKAT_REQUIRE_MSG (m_num_blocked_cols>=0,
+      "Error! Column-blocked execution requested, but no process field has columns.\n"
+      "   atm process group: " + name() + "\n");
+}
+
+void AtmosphereProcessGroup::run_column_blocked (const double dt) {
+  if (m_num_blocked_cols<0) {
+    setup_column_blocking();
+  }
+
+  const bool do_update = do_update_time_stamp() &&
+                      (get_subcycle_iter()==get_num_subcycles()-1);
+
+  // The intermediate states of the chain never exist for all columns at once, so the
+  // only meaningful pre-condition checks are the ones of the first process. Post-condition
+  // checks are run for all processes at the end, on the state at the end of the chain.
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    m_atm_processes[iproc]->set_update_time_stamps(do_update);
+    m_atm_processes[iproc]->begin_column_blocked_run(iproc==0);
+  }
+
+  for (int icol_beg=0; icol_beg<m_num_blocked_cols; icol_beg+=m_column_block_size) {
+    const int icol_end = std::min(icol_beg+m_column_block_size,m_num_blocked_cols);
+    for (auto atm_proc : m_atm_processes) {
+      atm_proc->run_columns(dt,icol_beg,icol_end);
+    }
+  }
+
+  for (auto atm_proc : m_atm_processes) {
+    atm_proc->end_column_blocked_run(dt);
+#ifdef SCREAM_HAS_MEMORY_USAGE
+    long long my_mem_usage = get_mem_usage(MB);
+    long long max_mem_usage;
+    m_comm.all_reduce(&my_mem_usage,&max_mem_usage,1,MPI_MAX);
+    m_atm_logger->debug("[EAMxx::run_column_blocked::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
+#endif
+  }
+}
+
 void AtmosphereProcessGroup::run_parallel (const double /* dt */) {
   EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
 }
@@ -668,7 +758,8 @@ size_t AtmosphereProcessGroup::requested_buffer_size_in_bytes () const
 {
   size_t buf_size = 0;
   for (const auto& proc : m_atm_processes) {
-    buf_size = std::max(buf_size,proc->requested_buffer_size_in_bytes());
+    // Each process may also store tendencies snapshots after its own buffer
+    buf_size = std::max(buf_size,proc->total_buffer_size_in_bytes());
   }
 
   return buf_size;
@@ -678,6 +769,7 @@ void AtmosphereProcessGroup::
 init_buffers(const ATMBufferManager& buffer_manager) {
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->init_buffers(buffer_manager);
+    atm_proc->init_tendencies_buffer(buffer_manager);
   }
 }
 
@@ -127,6 +127,10 @@ protected:
   void run_sequential (const double dt);
   void run_parallel   (const double dt);
 
+  // Column-blocked version of run_sequential (see column_block_size below)
+  void setup_column_blocking ();
+  void run_column_blocked (const double dt);
+
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field& f);
   void set_computed_field_impl (const Field& f);
@@ -143,6 +147,13 @@ protected:
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
 
+  // If positive, and all procs in the group are column-local physics processes that
+  // support it, the sequential schedule runs the whole chain of processes on blocks
+  // of (at most) this many columns at a time. This keeps the state of the block
+  // in cache across processes, which helps memory-bandwidth bound runs on CPU.
+  int            m_column_block_size = 0;
+  int            m_num_blocked_cols  = -1;
+
   // This is only needed to be able to access grids objects later on
   std::shared_ptr<const GridsManager>   m_grids_mgr;
 };
@@ -1,5 +1,6 @@
 #include "share/field/field.hpp"
 #include "share/util/scream_utils.hpp"
+#include "share/util/eamxx_metrics.hpp"
 
 namespace scream
 {
@@ -66,6 +67,9 @@ sync_to_host () const {
       "Error! Input field must be allocated in order to sync host and device views.\n");
 
   Kokkos::deep_copy(m_data.h_view,m_data.d_view);
+  if (m_data.h_view.data()!=m_data.d_view.data()) {
+    Metrics::instance().add_d2h_bytes(m_data.d_view.size());
+  }
 }
 
 void Field::
@@ -76,6 +80,9 @@ sync_to_dev () const {
 
   // Ensure host view was created (lazy construction)
   Kokkos::deep_copy(m_data.d_view,m_data.h_view);
+  if (m_data.h_view.data()!=m_data.d_view.data()) {
+    Metrics::instance().add_h2d_bytes(m_data.d_view.size());
+  }
 }
 
 Field Field::
@@ -224,6 +231,7 @@ void Field::allocate_view ()
 
   m_data.d_view = decltype(m_data.d_view)(id.name(),view_dim);
   m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
+  Metrics::instance().add_device_bytes(view_dim);
 }
 
 } // namespace scream
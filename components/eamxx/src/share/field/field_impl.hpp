@@ -323,13 +323,13 @@ deep_copy_impl (const Field& src) {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST*,HD>();
           auto v_src = src.get_view<const ST*,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank1", policy,KOKKOS_LAMBDA(const int idx) {
               v(idx) = v_src(idx);
             });
         } else {
           auto v     =     get_strided_view<      ST*,HD>();
           auto v_src = src.get_strided_view<const ST*,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank1_strided", policy,KOKKOS_LAMBDA(const int idx) {
               v(idx) = v_src(idx);
             });
         }
@@ -340,7 +340,7 @@ deep_copy_impl (const Field& src) {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST**,HD>();
           auto v_src = src.get_view<const ST**,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank2", policy,KOKKOS_LAMBDA(const int idx) {
             int i,j;
             unflatten_idx(idx,ext,i,j);
             v(i,j) = v_src(i,j);
@@ -349,7 +349,7 @@ deep_copy_impl (const Field& src) {
         else {
           auto v     =     get_strided_view<      ST**,HD>();
           auto v_src = src.get_strided_view<const ST**,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank2_strided", policy,KOKKOS_LAMBDA(const int idx) {
             int i,j;
             unflatten_idx(idx,ext,i,j);
             v(i,j) = v_src(i,j);
@@ -362,7 +362,7 @@ deep_copy_impl (const Field& src) {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST***,HD>();
           auto v_src = src.get_view<const ST***,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank3", policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k;
             unflatten_idx(idx,ext,i,j,k);
             v(i,j,k) = v_src(i,j,k);
@@ -370,7 +370,7 @@ deep_copy_impl (const Field& src) {
         } else {
           auto v     =     get_strided_view<      ST***,HD>();
           auto v_src = src.get_strided_view<const ST***,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank3_strided", policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k;
             unflatten_idx(idx,ext,i,j,k);
             v(i,j,k) = v_src(i,j,k);
@@ -383,7 +383,7 @@ deep_copy_impl (const Field& src) {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST****,HD>();
           auto v_src = src.get_view<const ST****,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank4", policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k,l;
             unflatten_idx(idx,ext,i,j,k,l);
             v(i,j,k,l) = v_src(i,j,k,l);
@@ -391,7 +391,7 @@ deep_copy_impl (const Field& src) {
         } else {
           auto v     =     get_strided_view<      ST****,HD>();
           auto v_src = src.get_strided_view<const ST****,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank4_strided", policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k,l;
             unflatten_idx(idx,ext,i,j,k,l);
             v(i,j,k,l) = v_src(i,j,k,l);
@@ -404,7 +404,7 @@ deep_copy_impl (const Field& src) {
         if (src_alloc_props.contiguous() and tgt_alloc_props.contiguous()) {
           auto v     =     get_view<      ST*****,HD>();
           auto v_src = src.get_view<const ST*****,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank5", policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k,l,m;
             unflatten_idx(idx,ext,i,j,k,l,m);
             v(i,j,k,l,m) = v_src(i,j,k,l,m);
@@ -412,7 +412,7 @@ deep_copy_impl (const Field& src) {
         } else {
           auto v     =     get_view<      ST*****,HD>();
           auto v_src = src.get_view<const ST*****,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::deep_copy_impl::rank5_strided", policy,KOKKOS_LAMBDA(const int idx) {
             int i,j,k,l,m;
             unflatten_idx(idx,ext,i,j,k,l,m);
             v(i,j,k,l,m) = v_src(i,j,k,l,m);
@@ -674,7 +674,7 @@ update_impl (const Field& x, const ST alpha, const ST beta, const ST fill_val)
       {
         auto xv = x.get_view<const ST,HD>();
         auto yv =   get_view<      ST,HD>();
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int /*idx*/) {
+        Kokkos::parallel_for("Field::update_impl::rank0", policy, KOKKOS_LAMBDA(const int /*idx*/) {
           combine_and_fill<CM>(xv(),yv(),fill_val,alpha,beta);
         });
       }
@@ -686,13 +686,13 @@ update_impl (const Field& x, const ST alpha, const ST beta, const ST fill_val)
               get_header().get_alloc_properties().contiguous()) {
           auto xv = x.get_view<const ST*,HD>();
           auto yv =   get_view<      ST*,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::update_impl::rank1", policy,KOKKOS_LAMBDA(const int idx) {
             combine_and_fill<CM>(xv(idx),yv(idx),fill_val,alpha,beta);
           });
         } else {
           auto xv = x.get_strided_view<const ST*,HD>();
           auto yv =   get_strided_view<      ST*,HD>();
-          Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+          Kokkos::parallel_for("Field::update_impl::rank1_strided", policy,KOKKOS_LAMBDA(const int idx) {
             combine_and_fill<CM>(xv(idx),yv(idx),fill_val,alpha,beta);
           });
         }
@@ -702,7 +702,7 @@ update_impl (const Field& x, const ST alpha, const ST beta, const ST fill_val)
       {
         auto xv = x.get_view<const ST**,HD>();
         auto yv =   get_view<      ST**,HD>();
-        Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+        Kokkos::parallel_for("Field::update_impl::rank2", policy,KOKKOS_LAMBDA(const int idx) {
           int i,j;
           unflatten_idx(idx,ext,i,j);
           combine_and_fill<CM>(xv(i,j),yv(i,j),fill_val,alpha,beta);
@@ -713,7 +713,7 @@ update_impl (const Field& x, const ST alpha, const ST beta, const ST fill_val)
       {
         auto xv = x.get_view<const ST***,HD>();
         auto yv =   get_view<      ST***,HD>();
-        Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+        Kokkos::parallel_for("Field::update_impl::rank3", policy,KOKKOS_LAMBDA(const int idx) {
           int i,j,k;
           unflatten_idx(idx,ext,i,j,k);
           combine_and_fill<CM>(xv(i,j,k),yv(i,j,k),fill_val,alpha,beta);
@@ -724,7 +724,7 @@ update_impl (const Field& x, const ST alpha, const ST beta, const ST fill_val)
       {
         auto xv = x.get_view<const ST****,HD>();
         auto yv =   get_view<      ST****,HD>();
-        Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+        Kokkos::parallel_for("Field::update_impl::rank4", policy,KOKKOS_LAMBDA(const int idx) {
           int i,j,k,l;
           unflatten_idx(idx,ext,i,j,k,l);
           combine_and_fill<CM>(xv(i,j,k,l),yv(i,j,k,l),fill_val,alpha,beta);
@@ -735,7 +735,7 @@ update_impl (const Field& x, const ST alpha, const ST beta, const ST fill_val)
       {
         auto xv = x.get_view<const ST*****,HD>();
         auto yv =   get_view<      ST*****,HD>();
-        Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+        Kokkos::parallel_for("Field::update_impl::rank5", policy,KOKKOS_LAMBDA(const int idx) {
           int i,j,k,l,m;
           unflatten_idx(idx,ext,i,j,k,l,m);
           combine_and_fill<CM>(xv(i,j,k,l,m),yv(i,j,k,l,m),fill_val,alpha,beta);
@@ -746,7 +746,7 @@ update_impl (const Field& x, const ST alpha, const ST beta, const ST fill_val)
       {
         auto xv = x.get_view<const ST******,HD>();
         auto yv =   get_view<      ST******,HD>();
-        Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+        Kokkos::parallel_for("Field::update_impl::rank6", policy,KOKKOS_LAMBDA(const int idx) {
           int i,j,k,l,m,n;
           unflatten_idx(idx,ext,i,j,k,l,m,n);
           combine_and_fill<CM>(xv(i,j,k,l,m,n),yv(i,j,k,l,m,n),fill_val,alpha,beta);
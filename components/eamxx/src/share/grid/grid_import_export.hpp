@@ -4,6 +4,7 @@
 #include "share/grid/abstract_grid.hpp"
 #include "share/scream_types.hpp"       // For KokkosTypes
 #include "share/util/scream_utils.hpp"  // For check_mpi_call
+#include "scream_config.h"              // For SCREAM_MPI_ON_DEVICE
 
 #include <ekat/mpi/ekat_comm.hpp>
 #include <mpi.h> // We do some direct MPI calls
@@ -38,6 +39,8 @@ namespace scream
  * for ease of use in non-performance critical code.
  * On the other hand, the import/export data (pids/lids) can
  * be used both on host and device, for more efficient pack/unpack methods.
+ * For repeated transfers of a fixed amount of data per dof, use the
+ * ImportExportPlan class below.
  */
 
 class GridImportExport {
@@ -76,6 +79,11 @@ public:
   view_1d<int>::HostMirror export_pids_h () const { return m_export_pids_h; }
   view_1d<int>::HostMirror export_lids_h () const { return m_export_lids_h; }
 
+  const std::shared_ptr<const AbstractGrid>& get_unique_grid () const { return m_unique; }
+  const std::shared_ptr<const AbstractGrid>& get_overlapped_grid () const { return m_overlapped; }
+
+  const ekat::Comm& get_comm () const { return m_comm; }
+
 protected:
 
   std::shared_ptr<const AbstractGrid>   m_unique;
@@ -102,6 +110,106 @@ protected:
   ekat::Comm    m_comm;
 };
 
+/*
+ * A persistent plan for scatter/gather operations, where each dof carries
+ * the same number of entries (col_size). Data lives on device, in 2d views
+ * with layout (ncols,col_size), where ncols is the number of local dofs
+ * on the unique or overlapped grid of the GridImportExport object.
+ *
+ * Counts, offsets, buffers and (persistent) MPI requests are all set up
+ * at construction, so that each scatter/gather call consists only of
+ * a device pack, one round of messages, and a device unpack, with no
+ * host allocations. If SCREAM_MPI_ON_DEVICE is on, MPI is given device
+ * pointers; otherwise, buffers are mirrored on host.
+ *
+ * The semantic of scatter/gather is the same as in GridImportExport, except
+ * that gather *accumulates* contributions from all overlapped dofs
+ * that map to the same unique dof, rather than concatenating them.
+ */
+
+template<typename T>
+class ImportExportPlan {
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename S>
+  using view_1d = typename KT::template view_1d<S>;
+  template<typename S>
+  using view_2d = typename KT::template view_2d<S>;
+
+  ImportExportPlan (const std::shared_ptr<const GridImportExport>& imp_exp,
+                    const int col_size);
+  ~ImportExportPlan ();
+
+  // The plan owns persistent MPI requests, which are freed in the destructor,
+  // so it can be neither copied nor moved.
+  ImportExportPlan (const ImportExportPlan&) = delete;
+  ImportExportPlan (ImportExportPlan&&) = delete;
+  ImportExportPlan& operator= (const ImportExportPlan&) = delete;
+  ImportExportPlan& operator= (ImportExportPlan&&) = delete;
+
+  // src: (num unique dofs, col_size), dst: (num overlapped dofs, col_size)
+  void scatter (const view_2d<const T>& src, const view_2d<T>& dst);
+
+  // src: (num overlapped dofs, col_size), dst: (num unique dofs, col_size)
+  void gather (const view_2d<const T>& src, const view_2d<T>& dst);
+
+  // The phases of scatter, for customers that pack/unpack directly into/from
+  // the plan buffers (e.g., to exchange several fields at once, without
+  // copying them in a 2d view first). The calls must be in this order:
+  //   scatter_start_recv, <pack export buffer>, scatter_start_send,
+  //   scatter_wait_recv, <unpack import buffer>, scatter_wait_send
+  void scatter_start_recv ();
+  void scatter_start_send ();
+  void scatter_wait_recv ();
+  void scatter_wait_send ();
+
+  // Entries of the i-th export (import) are at [i*col_size,(i+1)*col_size)
+  const view_1d<T>& get_export_buffer () const { return m_export_buf; }
+  const view_1d<T>& get_import_buffer () const { return m_import_buf; }
+
+  int get_col_size () const { return m_col_size; }
+
+#ifndef KOKKOS_ENABLE_CUDA
+protected:
+#endif
+
+  void pack (const view_2d<const T>& src, const view_1d<const int>& lids,
+             const view_1d<T>& buf) const;
+
+protected:
+
+  // If MpiOnDev=true, we pass device pointers to MPI. Otherwise, we use host mirrors.
+  static constexpr bool MpiOnDev = SCREAM_MPI_ON_DEVICE;
+  template<typename S>
+  using mpi_view_1d = typename std::conditional<
+                        MpiOnDev,
+                        view_1d<S>,
+                        typename view_1d<S>::HostMirror
+                      >::type;
+
+  void check_views (const std::string& method,
+                    const view_2d<const T>& src, const int src_ncols,
+                    const view_2d<T>& dst, const int dst_ncols) const;
+
+  std::shared_ptr<const GridImportExport> m_imp_exp;
+
+  int m_col_size;
+
+  // Buffers for exported/imported dofs. Entries for each dof are contiguous,
+  // and dofs are sorted by pid (same as in GridImportExport).
+  view_1d<T>      m_export_buf;
+  view_1d<T>      m_import_buf;
+  mpi_view_1d<T>  m_mpi_export_buf;
+  mpi_view_1d<T>  m_mpi_import_buf;
+
+  // Persistent requests. For scatter, we send exports and recv imports,
+  // while for gather we do the opposite.
+  std::vector<MPI_Request>  m_scatter_send_req;
+  std::vector<MPI_Request>  m_scatter_recv_req;
+  std::vector<MPI_Request>  m_gather_send_req;
+  std::vector<MPI_Request>  m_gather_recv_req;
+};
+
 // --------------------- IMPLEMENTATION ------------------------ //
 
 template<typename T>
@@ -263,6 +371,242 @@ gather (const MPI_Datatype mpi_data_t,
   }
 }
 
+template<typename T>
+ImportExportPlan<T>::
+ImportExportPlan (const std::shared_ptr<const GridImportExport>& imp_exp,
+                  const int col_size)
+ : m_imp_exp (imp_exp)
+ , m_col_size (col_size)
+{
+  EKAT_REQUIRE_MSG (imp_exp!=nullptr,
+      "Error! Input GridImportExport pointer is null.\n");
+  EKAT_REQUIRE_MSG (col_size>0,
+      "Error! Invalid column size for ImportExportPlan.\n"
+      "  - col size: " + std::to_string(col_size) + "\n");
+
+  const int nexp = imp_exp->export_lids().size();
+  const int nimp = imp_exp->import_lids().size();
+  m_export_buf = view_1d<T>("ImportExportPlan::export_buf",nexp*col_size);
+  m_import_buf = view_1d<T>("ImportExportPlan::import_buf",nimp*col_size);
+  m_mpi_export_buf = Kokkos::create_mirror_view(typename mpi_view_1d<T>::execution_space(),m_export_buf);
+  m_mpi_import_buf = Kokkos::create_mirror_view(typename mpi_view_1d<T>::execution_space(),m_import_buf);
+
+  const auto& comm = imp_exp->get_comm();
+  const auto mpi_comm = comm.mpi_comm();
+  const auto mpi_data_t = ekat::get_mpi_type<T>();
+  const auto nexp_per_pid = imp_exp->num_exports_per_pid_h();
+  const auto nimp_per_pid = imp_exp->num_imports_per_pid_h();
+
+  // Different tags for scatter/gather, so messages cannot be mixed up
+  constexpr int scatter_tag = 0;
+  constexpr int gather_tag  = 1;
+  for (int pid=0, exp_offset=0, imp_offset=0; pid<comm.size(); ++pid) {
+    const int exp_count = nexp_per_pid(pid)*col_size;
+    const int imp_count = nimp_per_pid(pid)*col_size;
+    if (exp_count>0) {
+      auto ptr = m_mpi_export_buf.data() + exp_offset;
+      check_mpi_call(MPI_Send_init(ptr,exp_count,mpi_data_t,pid,scatter_tag,mpi_comm,
+                                   &m_scatter_send_req.emplace_back()),
+                     "ImportExportPlan, creating scatter send request");
+      check_mpi_call(MPI_Recv_init(ptr,exp_count,mpi_data_t,pid,gather_tag,mpi_comm,
+                                   &m_gather_recv_req.emplace_back()),
+                     "ImportExportPlan, creating gather recv request");
+    }
+    if (imp_count>0) {
+      auto ptr = m_mpi_import_buf.data() + imp_offset;
+      check_mpi_call(MPI_Recv_init(ptr,imp_count,mpi_data_t,pid,scatter_tag,mpi_comm,
+                                   &m_scatter_recv_req.emplace_back()),
+                     "ImportExportPlan, creating scatter recv request");
+      check_mpi_call(MPI_Send_init(ptr,imp_count,mpi_data_t,pid,gather_tag,mpi_comm,
+                                   &m_gather_send_req.emplace_back()),
+                     "ImportExportPlan, creating gather send request");
+    }
+    exp_offset += exp_count;
+    imp_offset += imp_count;
+  }
+}
+
+template<typename T>
+ImportExportPlan<T>::
+~ImportExportPlan ()
+{
+  // Requests cannot be freed after MPI_Finalize
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (finalized) {
+    return;
+  }
+  for (auto reqs : {&m_scatter_send_req, &m_scatter_recv_req,
+                    &m_gather_send_req,  &m_gather_recv_req}) {
+    for (auto& req : *reqs) {
+      MPI_Request_free(&req);
+    }
+  }
+}
+
+template<typename T>
+void ImportExportPlan<T>::
+scatter (const view_2d<const T>& src, const view_2d<T>& dst)
+{
+  check_views("scatter",
+              src,m_imp_exp->get_unique_grid()->get_num_local_dofs(),
+              dst,m_imp_exp->get_overlapped_grid()->get_num_local_dofs());
+
+  scatter_start_recv();
+  pack(src,m_imp_exp->export_lids(),m_export_buf);
+  scatter_start_send();
+  scatter_wait_recv();
+
+  // Each overlapped dof is imported exactly once, so we can simply copy
+  const auto lids = m_imp_exp->import_lids();
+  const auto buf  = m_import_buf;
+  const int  col_size = m_col_size;
+  Kokkos::parallel_for("ImportExportPlan::scatter_unpack",
+                       typename KT::RangePolicy(0,buf.size()),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int i = idx / col_size;
+    const int k = idx % col_size;
+    dst(lids(i),k) = buf(idx);
+  });
+
+  scatter_wait_send();
+  Kokkos::fence();
+}
+
+template<typename T>
+void ImportExportPlan<T>::
+scatter_start_recv ()
+{
+  if (not m_scatter_recv_req.empty()) {
+    check_mpi_call(MPI_Startall(m_scatter_recv_req.size(),m_scatter_recv_req.data()),
+                   "ImportExportPlan::scatter, starting recv requests");
+  }
+}
+
+template<typename T>
+void ImportExportPlan<T>::
+scatter_start_send ()
+{
+  // Make sure the export buffer is done being packed
+  Kokkos::fence();
+  if (not MpiOnDev) {
+    Kokkos::deep_copy(m_mpi_export_buf,m_export_buf);
+  }
+
+  if (not m_scatter_send_req.empty()) {
+    check_mpi_call(MPI_Startall(m_scatter_send_req.size(),m_scatter_send_req.data()),
+                   "ImportExportPlan::scatter, starting send requests");
+  }
+}
+
+template<typename T>
+void ImportExportPlan<T>::
+scatter_wait_recv ()
+{
+  if (not m_scatter_recv_req.empty()) {
+    check_mpi_call(MPI_Waitall(m_scatter_recv_req.size(),m_scatter_recv_req.data(),MPI_STATUSES_IGNORE),
+                   "ImportExportPlan::scatter, waiting on recv requests");
+  }
+  if (not MpiOnDev) {
+    Kokkos::deep_copy(m_import_buf,m_mpi_import_buf);
+  }
+}
+
+template<typename T>
+void ImportExportPlan<T>::
+scatter_wait_send ()
+{
+  if (not m_scatter_send_req.empty()) {
+    check_mpi_call(MPI_Waitall(m_scatter_send_req.size(),m_scatter_send_req.data(),MPI_STATUSES_IGNORE),
+                   "ImportExportPlan::scatter, waiting on send requests");
+  }
+}
+
+template<typename T>
+void ImportExportPlan<T>::
+gather (const view_2d<const T>& src, const view_2d<T>& dst)
+{
+  check_views("gather",
+              src,m_imp_exp->get_overlapped_grid()->get_num_local_dofs(),
+              dst,m_imp_exp->get_unique_grid()->get_num_local_dofs());
+
+  if (not m_gather_recv_req.empty()) {
+    check_mpi_call(MPI_Startall(m_gather_recv_req.size(),m_gather_recv_req.data()),
+                   "ImportExportPlan::gather, starting recv requests");
+  }
+
+  pack(src,m_imp_exp->import_lids(),m_import_buf);
+  if (not MpiOnDev) {
+    Kokkos::deep_copy(m_mpi_import_buf,m_import_buf);
+  }
+
+  if (not m_gather_send_req.empty()) {
+    check_mpi_call(MPI_Startall(m_gather_send_req.size(),m_gather_send_req.data()),
+                   "ImportExportPlan::gather, starting send requests");
+  }
+
+  // While messages are in flight, zero out the output
+  Kokkos::deep_copy(dst,T(0));
+
+  if (not m_gather_recv_req.empty()) {
+    check_mpi_call(MPI_Waitall(m_gather_recv_req.size(),m_gather_recv_req.data(),MPI_STATUSES_IGNORE),
+                   "ImportExportPlan::gather, waiting on recv requests");
+  }
+  if (not MpiOnDev) {
+    Kokkos::deep_copy(m_export_buf,m_mpi_export_buf);
+  }
+
+  // A unique dof may be exported to several pids, so we must accumulate atomically
+  const auto lids = m_imp_exp->export_lids();
+  const auto buf  = m_export_buf;
+  const int  col_size = m_col_size;
+  Kokkos::parallel_for("ImportExportPlan::gather_unpack",
+                       typename KT::RangePolicy(0,buf.size()),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int i = idx / col_size;
+    const int k = idx % col_size;
+    Kokkos::atomic_add(&dst(lids(i),k),buf(idx));
+  });
+
+  if (not m_gather_send_req.empty()) {
+    check_mpi_call(MPI_Waitall(m_gather_send_req.size(),m_gather_send_req.data(),MPI_STATUSES_IGNORE),
+                   "ImportExportPlan::gather, waiting on send requests");
+  }
+  Kokkos::fence();
+}
+
+template<typename T>
+void ImportExportPlan<T>::
+pack (const view_2d<const T>& src, const view_1d<const int>& lids,
+      const view_1d<T>& buf) const
+{
+  const int col_size = m_col_size;
+  Kokkos::parallel_for("ImportExportPlan::pack",
+                       typename KT::RangePolicy(0,buf.size()),
+                       KOKKOS_LAMBDA(const int idx) {
+    const int i = idx / col_size;
+    const int k = idx % col_size;
+    buf(idx) = src(lids(i),k);
+  });
+  Kokkos::fence();
+}
+
+template<typename T>
+void ImportExportPlan<T>::
+check_views (const std::string& method,
+             const view_2d<const T>& src, const int src_ncols,
+             const view_2d<T>& dst, const int dst_ncols) const
+{
+  EKAT_REQUIRE_MSG (src.extent_int(0)==src_ncols and src.extent_int(1)==m_col_size,
+      "Error! Invalid src view extents in ImportExportPlan::" + method + ".\n"
+      "  - expected: (" + std::to_string(src_ncols) + "," + std::to_string(m_col_size) + ")\n"
+      "  - actual  : (" + std::to_string(src.extent(0)) + "," + std::to_string(src.extent(1)) + ")\n");
+  EKAT_REQUIRE_MSG (dst.extent_int(0)==dst_ncols and dst.extent_int(1)==m_col_size,
+      "Error! Invalid dst view extents in ImportExportPlan::" + method + ".\n"
+      "  - expected: (" + std::to_string(dst_ncols) + "," + std::to_string(m_col_size) + ")\n"
+      "  - actual  : (" + std::to_string(dst.extent(0)) + "," + std::to_string(dst.extent(1)) + ")\n");
+}
+
 } // namespace scream
 
 #endif // EAMXX_GRID_IMPORT_EXPORT_DATA_HPP
@@ -253,7 +253,7 @@ rescale_masked_fields (const Field& x, const Field& mask) const
       // along the 2nd dimension.
       auto x_view =    x.get_strided_view<      Real*>();
       auto m_view = mask.get_strided_view<const Real*>();
-      Kokkos::parallel_for(RangePolicy(0,ncols),
+      Kokkos::parallel_for("CoarseningRemapper::rescale_masked_fields::rank1", RangePolicy(0,ncols),
                            KOKKOS_LAMBDA(const int& icol) {
         if (m_view(icol)>mask_threshold) {
           x_view(icol) /= m_view(icol);
@@ -278,7 +278,7 @@ rescale_masked_fields (const Field& x, const Field& mask) const
       }
       const int dim1 = PackInfo::num_packs(layout.dim(1));
       auto policy = ESU::get_default_team_policy(ncols,dim1);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("CoarseningRemapper::rescale_masked_fields::rank2", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto icol = team.league_rank();
         auto x_sub = ekat::subview(x_view,icol);
@@ -320,7 +320,7 @@ rescale_masked_fields (const Field& x, const Field& mask) const
       const int dim1 = layout.dim(1);
       const int dim2 = PackInfo::num_packs(layout.dim(2));
       auto policy = ESU::get_default_team_policy(ncols,dim1*dim2);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("CoarseningRemapper::rescale_masked_fields::rank3", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto icol = team.league_rank();
         if (mask1d) {
@@ -369,7 +369,7 @@ rescale_masked_fields (const Field& x, const Field& mask) const
       const int dim2 = layout.dim(2);
       const int dim3 = PackInfo::num_packs(layout.dim(3));
       auto policy = ESU::get_default_team_policy(ncols,dim1*dim2*dim3);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("CoarseningRemapper::rescale_masked_fields::rank4", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto icol = team.league_rank();
         if (mask1d) {
@@ -434,7 +434,7 @@ local_mat_vec (const Field& x, const Field& y, const Field& mask) const
       auto x_view = x.get_strided_view<const Real*>();
       auto y_view = y.get_strided_view<      Real*>();
       auto mask_view = mask.get_strided_view<Real*>();
-      Kokkos::parallel_for(RangePolicy(0,nrows),
+      Kokkos::parallel_for("CoarseningRemapper::local_mat_vec::rank1", RangePolicy(0,nrows),
                            KOKKOS_LAMBDA(const int& row) {
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -461,7 +461,7 @@ local_mat_vec (const Field& x, const Field& y, const Field& mask) const
       }
       const int dim1 = PackInfo::num_packs(src_layout.dim(1));
       auto policy = ESU::get_default_team_policy(nrows,dim1);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("CoarseningRemapper::local_mat_vec::rank2", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto row = team.league_rank();
 
@@ -497,7 +497,7 @@ local_mat_vec (const Field& x, const Field& y, const Field& mask) const
       const int dim1 = src_layout.dim(1);
       const int dim2 = PackInfo::num_packs(src_layout.dim(2));
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("CoarseningRemapper::local_mat_vec::rank3", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto row = team.league_rank();
 
@@ -536,7 +536,7 @@ local_mat_vec (const Field& x, const Field& y, const Field& mask) const
       const int dim2 = src_layout.dim(2);
       const int dim3 = PackInfo::num_packs(src_layout.dim(3));
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2*dim3);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("CoarseningRemapper::local_mat_vec::rank4", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto row = team.league_rank();
 
@@ -587,7 +587,7 @@ void CoarseningRemapper::pack_and_send ()
         // therefore allowing the 1d field to be a subfield of a 2d field
         // along the 2nd dimension.
         auto v = f.get_strided_view<const Real*>();
-        Kokkos::parallel_for(RangePolicy(0,num_send_gids),
+        Kokkos::parallel_for("CoarseningRemapper::pack_and_send::rank1", RangePolicy(0,num_send_gids),
                              KOKKOS_LAMBDA(const int& i){
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
@@ -602,7 +602,7 @@ void CoarseningRemapper::pack_and_send ()
         auto v = f.get_view<const Real**>();
         const int dim1 = fl.dim(1);
         auto policy = ESU::get_default_team_policy(num_send_gids,dim1);
-        Kokkos::parallel_for(policy,
+        Kokkos::parallel_for("CoarseningRemapper::pack_and_send::rank2", policy,
                              KOKKOS_LAMBDA(const MemberType& team){
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
@@ -622,7 +622,7 @@ void CoarseningRemapper::pack_and_send ()
         const int dim1 = fl.dim(1);
         const int dim2 = fl.dim(2);
         auto policy = ESU::get_default_team_policy(num_send_gids,dim1*dim2);
-        Kokkos::parallel_for(policy,
+        Kokkos::parallel_for("CoarseningRemapper::pack_and_send::rank3", policy,
                              KOKKOS_LAMBDA(const MemberType& team){
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
@@ -645,7 +645,7 @@ void CoarseningRemapper::pack_and_send ()
         const int dim2 = fl.dim(2);
         const int dim3 = fl.dim(3);
         auto policy = ESU::get_default_team_policy(num_send_gids,dim1*dim2*dim3);
-        Kokkos::parallel_for(policy,
+        Kokkos::parallel_for("CoarseningRemapper::pack_and_send::rank4", policy,
                              KOKKOS_LAMBDA(const MemberType& team){
           const int i = team.league_rank();
           const int lid = lids_pids(i,0);
@@ -723,7 +723,7 @@ void CoarseningRemapper::recv_and_unpack ()
         // therefore allowing the 1d field to be a subfield of a 2d field
         // along the 2nd dimension.
         auto v = f.get_strided_view<Real*>();
-        Kokkos::parallel_for(RangePolicy(0,num_tgt_dofs),
+        Kokkos::parallel_for("CoarseningRemapper::recv_and_unpack::rank1", RangePolicy(0,num_tgt_dofs),
                              KOKKOS_LAMBDA(const int& lid){
           const int recv_beg = recv_lids_beg(lid);
           const int recv_end = recv_lids_end(lid);
@@ -740,7 +740,7 @@ void CoarseningRemapper::recv_and_unpack ()
         auto v = f.get_view<Real**>();
         const int dim1 = fl.dim(1);
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,dim1);
-        Kokkos::parallel_for(policy,
+        Kokkos::parallel_for("CoarseningRemapper::recv_and_unpack::rank2", policy,
                              KOKKOS_LAMBDA(const MemberType& team){
           const int lid = team.league_rank();
           const int recv_beg = recv_lids_beg(lid);
@@ -762,7 +762,7 @@ void CoarseningRemapper::recv_and_unpack ()
         const int dim1 = fl.dim(1);
         const int dim2 = fl.dims().back();
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,dim2*dim1);
-        Kokkos::parallel_for(policy,
+        Kokkos::parallel_for("CoarseningRemapper::recv_and_unpack::rank3", policy,
                              KOKKOS_LAMBDA(const MemberType& team){
           const int lid = team.league_rank();
           const int recv_beg = recv_lids_beg(lid);
@@ -789,7 +789,7 @@ void CoarseningRemapper::recv_and_unpack ()
         const int dim2 = fl.dim(2);
         const int dim3 = fl.dim(3);
         auto policy = ESU::get_default_team_policy(num_tgt_dofs,dim1*dim2*dim3);
-        Kokkos::parallel_for(policy,
+        Kokkos::parallel_for("CoarseningRemapper::recv_and_unpack::rank4", policy,
                              KOKKOS_LAMBDA(const MemberType& team){
           const int lid = team.league_rank();
           const int recv_beg = recv_lids_beg(lid);
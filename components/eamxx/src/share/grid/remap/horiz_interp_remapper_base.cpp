@@ -265,7 +265,7 @@ local_mat_vec (const Field& x, const Field& y) const
       // along the 2nd dimension.
       auto x_view = x.get_strided_view<const Real*>();
       auto y_view = y.get_strided_view<      Real*>();
-      Kokkos::parallel_for(RangePolicy(0,nrows),
+      Kokkos::parallel_for("HorizInterpRemapperBase::local_mat_vec::rank1", RangePolicy(0,nrows),
                            KOKKOS_LAMBDA(const int& row) {
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -282,7 +282,7 @@ local_mat_vec (const Field& x, const Field& y) const
       auto y_view = y.get_view<      Pack**>();
       const int dim1 = PackInfo::num_packs(src_layout.dim(1));
       auto policy = ESU::get_default_team_policy(nrows,dim1);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("HorizInterpRemapperBase::local_mat_vec::rank2", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto row = team.league_rank();
 
@@ -305,7 +305,7 @@ local_mat_vec (const Field& x, const Field& y) const
       const int dim1 = src_layout.dim(1);
       const int dim2 = PackInfo::num_packs(src_layout.dim(2));
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("HorizInterpRemapperBase::local_mat_vec::rank3", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto row = team.league_rank();
 
@@ -331,7 +331,7 @@ local_mat_vec (const Field& x, const Field& y) const
       const int dim2 = src_layout.dim(2);
       const int dim3 = PackInfo::num_packs(src_layout.dim(3));
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2*dim3);
-      Kokkos::parallel_for(policy,
+      Kokkos::parallel_for("HorizInterpRemapperBase::local_mat_vec::rank4", policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
         const auto row = team.league_rank();
 
@@ -29,12 +29,14 @@ RefiningRemapperP2P::
 
 void RefiningRemapperP2P::do_remap_fwd ()
 {
+  // If no field was registered, there is nothing to do
+  if (m_plan==nullptr) {
+    return;
+  }
+
   // Fire the recv requests right away, so that if some other ranks
   // is done packing before us, we can start receiving their data
-  if (not m_recv_req.empty()) {
-    check_mpi_call(MPI_Startall(m_recv_req.size(),m_recv_req.data()),
-                   "[RefiningRemapperP2P] starting persistent recv requests.\n");
-  }
+  m_plan->scatter_start_recv();
 
   // Do P2P communications
   pack_and_send ();
@@ -72,18 +74,13 @@ void RefiningRemapperP2P::do_remap_fwd ()
   }
 
   // Wait for all sends to be completed
-  if (not m_send_req.empty()) {
-    check_mpi_call(MPI_Waitall(m_send_req.size(),m_send_req.data(), MPI_STATUSES_IGNORE),
-                   "[RefiningRemapperP2P] waiting on persistent send requests.\n");
-  }
+  m_plan->scatter_wait_send();
 }
 
 void RefiningRemapperP2P::setup_mpi_data_structures ()
 {
   using namespace ShortFieldTagsNames;
 
-  const int nranks = m_comm.size();
-
   // Get cumulative col size of each field (to be used to compute offsets)
   m_fields_col_sizes_scan_sum.resize(m_num_fields+1,0);
   for (int i=0; i<m_num_fields; ++i) {
@@ -94,67 +91,13 @@ void RefiningRemapperP2P::setup_mpi_data_structures ()
   }
   auto total_col_size = m_fields_col_sizes_scan_sum.back();
 
-  // ----------- Compute RECV metadata -------------- //
-
-  // Figure out where ov_src cols are received from
-  const int ncols_recv = m_ov_coarse_grid->get_num_local_dofs();
-
+  // The plan handles buffers and (persistent) requests. We exchange all fields
+  // at once, packing them directly in the plan buffers, with the entries of
+  // all fields for a col stored contiguously. If no field was registered,
+  // there is nothing to exchange.
   m_imp_exp = std::make_shared<GridImportExport>(m_src_grid,m_ov_coarse_grid);
-
-  // We can now compute the offset of each pid in the recv buffer
-  m_pids_recv_offsets = view_1d<int>("",nranks+1);
-  auto ncols_recv_h = m_imp_exp->num_imports_per_pid_h();
-  auto pids_recv_offsets_h = Kokkos::create_mirror_view(m_pids_recv_offsets);
-  pids_recv_offsets_h[0] = 0;
-  for (int pid=0; pid<nranks; ++pid) {
-    pids_recv_offsets_h(pid+1) = pids_recv_offsets_h(pid)
-                               + ncols_recv_h(pid);
-  }
-  Kokkos::deep_copy(m_pids_recv_offsets,pids_recv_offsets_h);
-
-  // Create the recv buffer(s)
-  auto recv_buf_size = ncols_recv*total_col_size;
-  m_recv_buffer = decltype(m_recv_buffer)("RefiningRemapperP2P::recv_buf",recv_buf_size);
-  m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
-
-  // ----------- Compute SEND metadata -------------- //
-
-  m_pids_send_offsets = view_1d<int>("",nranks+1);
-  auto pids_send_offsets_h = Kokkos::create_mirror_view(m_pids_send_offsets);
-  auto ncols_send_h = m_imp_exp->num_exports_per_pid_h();
-  pids_send_offsets_h[0] = 0;
-  for (int pid=0; pid<nranks; ++pid) {
-    pids_send_offsets_h(pid+1) = pids_send_offsets_h(pid)
-                               + ncols_send_h(pid);
-  }
-  Kokkos::deep_copy(m_pids_send_offsets,pids_send_offsets_h);
-
-  // Create the send buffer(s)
-  auto send_buf_size = pids_send_offsets_h(nranks)*total_col_size;
-  m_send_buffer = decltype(m_send_buffer)("RefiningRemapperP2P::send_buf",send_buf_size);
-  m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
-
-  // ----------- Create Requests ------------ //
-
-  const auto mpi_comm = m_comm.mpi_comm();
-  const auto mpi_real = ekat::get_mpi_type<Real>();
-  for (int pid=0; pid<nranks; ++pid) {
-    // Send request
-    if (ncols_send_h(pid)>0) {
-      auto send_ptr = m_mpi_send_buffer.data() + pids_send_offsets_h(pid)*total_col_size;
-      auto send_count = ncols_send_h(pid)*total_col_size;
-      auto& req = m_send_req.emplace_back();
-      MPI_Send_init (send_ptr, send_count, mpi_real, pid,
-                     0, mpi_comm, &req);
-    }
-    // Recv request
-    if (ncols_recv_h(pid)>0) {
-      auto recv_ptr = m_mpi_recv_buffer.data() + pids_recv_offsets_h(pid)*total_col_size;
-      auto recv_count = ncols_recv_h(pid)*total_col_size;
-      auto& req = m_recv_req.emplace_back();
-      MPI_Recv_init (recv_ptr, recv_count, mpi_real, pid,
-                     0, mpi_comm, &req);
-    }
+  if (total_col_size>0) {
+    m_plan = std::make_unique<ImportExportPlan<Real>>(m_imp_exp,total_col_size);
   }
 }
 
@@ -164,12 +107,9 @@ void RefiningRemapperP2P::pack_and_send ()
   using TeamMember  = typename KT::MemberType;
   using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
 
-  auto export_pids = m_imp_exp->export_pids();
   auto export_lids = m_imp_exp->export_lids();
-  auto ncols_send  = m_imp_exp->num_exports_per_pid();
-  auto pids_send_offsets = m_pids_send_offsets;
-  auto send_buf = m_send_buffer;
-  const int num_exports = export_pids.size();
+  auto send_buf = m_plan->get_export_buffer();
+  const int num_exports = export_lids.size();
   const int total_col_size = m_fields_col_sizes_scan_sum.back();
   for (int ifield=0; ifield<m_num_fields; ++ifield) {
     const auto& f = m_src_fields[ifield];
@@ -180,16 +120,11 @@ void RefiningRemapperP2P::pack_and_send ()
       {
         const auto v = f.get_strided_view<const Real*>();
         auto pack = KOKKOS_LAMBDA(const int iexp) {
-          auto pid = export_pids(iexp);
           auto icol = export_lids(iexp);
-          auto pid_offset = pids_send_offsets(pid);
-          auto pos_within_pid = iexp - pid_offset;
-          auto offset = pid_offset*total_col_size
-                      + ncols_send(pid)*f_col_sizes_scan_sum
-                      + pos_within_pid;
+          auto offset = iexp*total_col_size + f_col_sizes_scan_sum;
           send_buf(offset) = v(icol);
         };
-        Kokkos::parallel_for(RangePolicy(0,num_exports),pack);
+        Kokkos::parallel_for("RefiningRemapperP2P::pack_and_send::rank1", RangePolicy(0,num_exports),pack);
         break;
       }
       case 2:
@@ -200,19 +135,14 @@ void RefiningRemapperP2P::pack_and_send ()
         auto pack = KOKKOS_LAMBDA(const TeamMember& team) {
           const int iexp = team.league_rank();
           const int icol = export_lids(iexp);
-          const int pid  = export_pids(iexp);
-          auto pid_offset = pids_send_offsets(pid);
-          auto pos_within_pid = iexp - pid_offset;
-          auto offset = pid_offset*total_col_size
-                      + ncols_send(pid)*f_col_sizes_scan_sum
-                      + pos_within_pid*dim1;
+          auto offset = iexp*total_col_size + f_col_sizes_scan_sum;
           auto col_pack = [&](const int& k) {
             send_buf(offset+k) = v(icol,k);
           };
           auto tvr = Kokkos::TeamVectorRange(team,dim1);
           Kokkos::parallel_for(tvr,col_pack);
         };
-        Kokkos::parallel_for(policy,pack);
+        Kokkos::parallel_for("RefiningRemapperP2P::pack_and_send::rank2", policy,pack);
         break;
       }
       case 3:
@@ -225,12 +155,7 @@ void RefiningRemapperP2P::pack_and_send ()
         auto pack = KOKKOS_LAMBDA(const TeamMember& team) {
           const int iexp = team.league_rank();
           const int icol = export_lids(iexp);
-          const int pid  = export_pids(iexp);
-          auto pid_offset = pids_send_offsets(pid);
-          auto pos_within_pid = iexp - pid_offset;
-          auto offset = pid_offset*total_col_size
-                      + ncols_send(pid)*f_col_sizes_scan_sum
-                      + pos_within_pid*f_col_size;
+          auto offset = iexp*total_col_size + f_col_sizes_scan_sum;
           auto col_pack = [&](const int& idx) {
             const int j = idx / dim2;
             const int k = idx % dim2;
@@ -239,7 +164,7 @@ void RefiningRemapperP2P::pack_and_send ()
           auto tvr = Kokkos::TeamVectorRange(team,f_col_size);
           Kokkos::parallel_for(tvr,col_pack);
         };
-        Kokkos::parallel_for(policy,pack);
+        Kokkos::parallel_for("RefiningRemapperP2P::pack_and_send::rank3", policy,pack);
         break;
       }
       case 4:
@@ -253,12 +178,7 @@ void RefiningRemapperP2P::pack_and_send ()
         auto pack = KOKKOS_LAMBDA(const TeamMember& team) {
           const int iexp = team.league_rank();
           const int icol = export_lids(iexp);
-          const int pid  = export_pids(iexp);
-          auto pid_offset = pids_send_offsets(pid);
-          auto pos_within_pid = iexp - pid_offset;
-          auto offset = pid_offset*total_col_size
-                      + ncols_send(pid)*f_col_sizes_scan_sum
-                      + pos_within_pid*f_col_size;
+          auto offset = iexp*total_col_size + f_col_sizes_scan_sum;
           auto col_pack = [&](const int& idx) {
             const int j = (idx / dim3) / dim2;
             const int k = (idx / dim3) % dim2;
@@ -268,7 +188,7 @@ void RefiningRemapperP2P::pack_and_send ()
           auto tvr = Kokkos::TeamVectorRange(team,f_col_size);
           Kokkos::parallel_for(tvr,col_pack);
         };
-        Kokkos::parallel_for(policy,pack);
+        Kokkos::parallel_for("RefiningRemapperP2P::pack_and_send::rank4", policy,pack);
         break;
       }
       default:
@@ -279,41 +199,22 @@ void RefiningRemapperP2P::pack_and_send ()
     }
   }
 
-  // Wait for all threads to be done packing
-  Kokkos::fence();
-
-  // If MPI does not use dev pointers, we need to deep copy from dev to host
-  if (not MpiOnDev) {
-    Kokkos::deep_copy (m_mpi_send_buffer,m_send_buffer);
-  }
-
-  if (not m_send_req.empty()) {
-    check_mpi_call(MPI_Startall(m_send_req.size(),m_send_req.data()),
-                   "[RefiningRemapperP2P] start persistent send requests.\n");
-  }
+  // Waits for packing to be done, and starts the persistent send requests
+  m_plan->scatter_start_send();
 }
 
 void RefiningRemapperP2P::recv_and_unpack ()
 {
-  if (not m_recv_req.empty()) {
-    check_mpi_call(MPI_Waitall(m_recv_req.size(),m_recv_req.data(), MPI_STATUSES_IGNORE),
-                   "[RefiningRemapperP2P] waiting on persistent recv requests.\n");
-  }
-  // If MPI does not use dev pointers, we need to deep copy from host to dev
-  if (not MpiOnDev) {
-    Kokkos::deep_copy (m_recv_buffer,m_mpi_recv_buffer);
-  }
+  // Waits for the persistent recv requests, and copies data to device (if needed)
+  m_plan->scatter_wait_recv();
 
   using RangePolicy = typename KT::RangePolicy;
   using TeamMember  = typename KT::MemberType;
   using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
 
-  auto import_pids = m_imp_exp->import_pids();
   auto import_lids = m_imp_exp->import_lids();
-  auto ncols_recv  = m_imp_exp->num_imports_per_pid();
-  auto pids_recv_offsets = m_pids_recv_offsets;
-  auto recv_buf = m_recv_buffer;
-  const int num_imports = import_pids.size();
+  auto recv_buf = m_plan->get_import_buffer();
+  const int num_imports = import_lids.size();
   const int total_col_size = m_fields_col_sizes_scan_sum.back();
   for (int ifield=0; ifield<m_num_fields; ++ifield) {
           auto& f  = m_ov_fields[ifield];
@@ -324,16 +225,11 @@ void RefiningRemapperP2P::recv_and_unpack ()
       {
         auto v = f.get_view<Real*>();
         auto unpack = KOKKOS_LAMBDA (const int idx) {
-          const int pid  = import_pids(idx);
           const int icol = import_lids(idx);
-          const auto pid_offset = pids_recv_offsets(pid);
-          const auto pos_within_pid = idx - pid_offset;
-          auto offset = pid_offset*total_col_size
-                      + ncols_recv(pid)*f_col_sizes_scan_sum
-                      + pos_within_pid;
+          auto offset = idx*total_col_size + f_col_sizes_scan_sum;
           v(icol) = recv_buf(offset);
         };
-        Kokkos::parallel_for(RangePolicy(0,num_imports),unpack);
+        Kokkos::parallel_for("RefiningRemapperP2P::recv_and_unpack::rank1", RangePolicy(0,num_imports),unpack);
         break;
       }
       case 2:
@@ -343,20 +239,15 @@ void RefiningRemapperP2P::recv_and_unpack ()
         auto policy = ESU::get_default_team_policy(num_imports,dim1);
         auto unpack = KOKKOS_LAMBDA (const TeamMember& team) {
           const int idx  = team.league_rank();
-          const int pid  = import_pids(idx);
           const int icol = import_lids(idx);
-          const auto pid_offset = pids_recv_offsets(pid);
-          const auto pos_within_pid = idx - pid_offset;
-          auto offset = pid_offset*total_col_size
-                      + ncols_recv(pid)*f_col_sizes_scan_sum
-                      + pos_within_pid*dim1;
+          auto offset = idx*total_col_size + f_col_sizes_scan_sum;
           auto col_unpack = [&](const int& k) {
             v(icol,k) = recv_buf(offset+k);
           };
           auto tvr = Kokkos::TeamVectorRange(team,dim1);
           Kokkos::parallel_for(tvr,col_unpack);
         };
-        Kokkos::parallel_for(policy,unpack);
+        Kokkos::parallel_for("RefiningRemapperP2P::recv_and_unpack::rank2", policy,unpack);
         break;
       }
       case 3:
@@ -368,13 +259,8 @@ void RefiningRemapperP2P::recv_and_unpack ()
         auto policy = ESU::get_default_team_policy(num_imports,dim1*dim2);
         auto unpack = KOKKOS_LAMBDA (const TeamMember& team) {
           const int idx  = team.league_rank();
-          const int pid  = import_pids(idx);
           const int icol = import_lids(idx);
-          const auto pid_offset = pids_recv_offsets(pid);
-          const auto pos_within_pid = idx - pid_offset;
-          auto offset = pid_offset*total_col_size
-                      + ncols_recv(pid)*f_col_sizes_scan_sum
-                      + pos_within_pid*f_col_size;
+          auto offset = idx*total_col_size + f_col_sizes_scan_sum;
           auto col_unpack = [&](const int& idx) {
             const int j = idx / dim2;
             const int k = idx % dim2;
@@ -383,7 +269,7 @@ void RefiningRemapperP2P::recv_and_unpack ()
           auto tvr = Kokkos::TeamVectorRange(team,f_col_size);
           Kokkos::parallel_for(tvr,col_unpack);
         };
-        Kokkos::parallel_for(policy,unpack);
+        Kokkos::parallel_for("RefiningRemapperP2P::recv_and_unpack::rank3", policy,unpack);
         break;
       }
       case 4:
@@ -396,13 +282,8 @@ void RefiningRemapperP2P::recv_and_unpack ()
         auto policy = ESU::get_default_team_policy(num_imports,dim1*dim2*dim3);
         auto unpack = KOKKOS_LAMBDA (const TeamMember& team) {
           const int idx  = team.league_rank();
-          const int pid  = import_pids(idx);
           const int icol = import_lids(idx);
-          const auto pid_offset = pids_recv_offsets(pid);
-          const auto pos_within_pid = idx - pid_offset;
-          auto offset = pid_offset*total_col_size
-                      + ncols_recv(pid)*f_col_sizes_scan_sum
-                      + pos_within_pid*f_col_size;
+          auto offset = idx*total_col_size + f_col_sizes_scan_sum;
           auto col_unpack = [&](const int& idx) {
             const int j = (idx / dim3) / dim2;
             const int k = (idx / dim3) % dim2;
@@ -412,7 +293,7 @@ void RefiningRemapperP2P::recv_and_unpack ()
           auto tvr = Kokkos::TeamVectorRange(team,f_col_size);
           Kokkos::parallel_for(tvr,col_unpack);
         };
-        Kokkos::parallel_for(policy,unpack);
+        Kokkos::parallel_for("RefiningRemapperP2P::recv_and_unpack::rank4", policy,unpack);
         break;
       }
       default:
@@ -426,13 +307,8 @@ void RefiningRemapperP2P::recv_and_unpack ()
 
 void RefiningRemapperP2P::clean_up ()
 {
-  // Clear all MPI related structures
-  m_send_buffer         = view_1d<Real>();
-  m_recv_buffer         = view_1d<Real>();
-  m_mpi_send_buffer     = mpi_view_1d<Real>();
-  m_mpi_recv_buffer     = mpi_view_1d<Real>();
-  m_send_req.clear();
-  m_recv_req.clear();
+  // Clear all MPI related structures (the plan frees its requests)
+  m_plan    = nullptr;
   m_imp_exp = nullptr;
 
   HorizInterpRemapperBase::clean_up();
@@ -7,12 +7,14 @@
 
 #include "ekat/ekat_pack.hpp"
 
-#include <mpi.h>
+#include <memory>
 
 namespace scream
 {
 
 class GridImportExport;
+template<typename T>
+class ImportExportPlan;
 
 /*
  * A remapper to interpolate fields on a coarser grid
@@ -76,15 +78,6 @@ public:
 
 protected:
 
-  // If MpiOnDev=true, we pass device pointers to MPI. Otherwise, we use host mirrors.
-  static constexpr bool MpiOnDev = SCREAM_MPI_ON_DEVICE;
-  template<typename T>
-  using mpi_view_1d = typename std::conditional<
-                        MpiOnDev,
-                        view_1d<T>,
-                        typename view_1d<T>::HostMirror
-                      >::type;
-
   // ----- Data structures for pack/unpack and MPI ----- //
 
   // Exclusive scan sum of the col size of each field
@@ -93,27 +86,8 @@ protected:
   // ImportData/export info
   std::shared_ptr<GridImportExport>  m_imp_exp;
 
-  // The send/recv buffers for pack/unpack operations
-  view_1d<Real> m_send_buffer;
-  view_1d<Real> m_recv_buffer;
-
-  // The send/recv buf to feed to MPI.
-  // If MpiOnDev=true, they simply alias the ones above
-  mpi_view_1d<Real>     m_mpi_send_buffer;
-  mpi_view_1d<Real>     m_mpi_recv_buffer;
-
-  // Offset of each pid in send/recv buffers
-  view_1d<int>  m_pids_send_offsets;
-  view_1d<int>  m_pids_recv_offsets;
-
-  // For each col, its position within the set of cols
-  // sent/recv to/from the corresponding remote
-  view_1d<int>  m_send_col_pos;
-  view_1d<int>  m_recv_col_pos;
-
-  // Send/recv persistent requests
-  std::vector<MPI_Request>  m_send_req;
-  std::vector<MPI_Request>  m_recv_req;
+  // Buffers and persistent requests for the src->ov_src scatter
+  std::unique_ptr<ImportExportPlan<Real>>  m_plan;
 };
 
 } // namespace scream
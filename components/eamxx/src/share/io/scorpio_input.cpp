@@ -181,16 +181,25 @@ set_grid (const std::shared_ptr<const AbstractGrid>& grid)
   // Sanity checks
   EKAT_REQUIRE_MSG (grid, "Error! Input grid pointer is invalid.\n");
   const bool skip_grid_chk = m_params.get<bool>("Skip_Grid_Checks",false);
+  const bool col_subset = m_params.get<bool>("Read_Column_Subset",false);
   if (!skip_grid_chk) {
     EKAT_REQUIRE_MSG (grid->is_unique(),
         "Error! I/O only supports grids which are 'unique', meaning that the\n"
         "       map dof_gid->proc_id is well defined.\n");
-    EKAT_REQUIRE_MSG (
-        (grid->get_global_max_dof_gid()-grid->get_global_min_dof_gid()+1)==grid->get_num_global_dofs(),
-        "Error! IO requires DOF gids to (globally)  be in interval [gid_0,gid_0+num_global_dofs).\n"
-        "   - global min GID : " + std::to_string(grid->get_global_min_dof_gid()) + "\n"
-        "   - global max GID : " + std::to_string(grid->get_global_max_dof_gid()) + "\n"
-        "   - num global dofs: " + std::to_string(grid->get_num_global_dofs()) + "\n");
+    if (col_subset) {
+      // Gids are offsets along the file dimension. Upper bounds are checked
+      // once the file is open, when setting the decomposition.
+      EKAT_REQUIRE_MSG (grid->get_global_min_partitioned_dim_gid()>=0,
+          "Error! When reading a column subset, partitioned dim gids must be non-negative.\n"
+          "   - global min GID : " + std::to_string(grid->get_global_min_partitioned_dim_gid()) + "\n");
+    } else {
+      EKAT_REQUIRE_MSG (
+          (grid->get_global_max_dof_gid()-grid->get_global_min_dof_gid()+1)==grid->get_num_global_dofs(),
+          "Error! IO requires DOF gids to (globally)  be in interval [gid_0,gid_0+num_global_dofs).\n"
+          "   - global min GID : " + std::to_string(grid->get_global_min_dof_gid()) + "\n"
+          "   - global max GID : " + std::to_string(grid->get_global_max_dof_gid()) + "\n"
+          "   - num global dofs: " + std::to_string(grid->get_num_global_dofs()) + "\n");
+    }
   }
 
   // The grid is good. Store it.
@@ -389,6 +398,18 @@ void AtmosphereInput::init_scorpio_structures()
       const bool partitioned = m_io_grid->get_partitioned_dim_tag()==layout.tag(i);
       const int eamxx_len = partitioned ? m_io_grid->get_partitioned_dim_global_size()
                                         : layout.dim(i);
+      if (partitioned and m_params.get<bool>("Read_Column_Subset",false)) {
+        // Only a subset of the file entries is read. Out-of-bounds gids are caught
+        // when setting the decomposition.
+        EKAT_REQUIRE_MSG (eamxx_len<=file_len,
+            "Error! Column subset is larger than the file dimension.\n"
+          " - filename : " + m_filename + "\n"
+          " - varname  : " + name + "\n"
+          " - dim name : " + vec_of_dims[i] + "\n"
+          " - subset size     : " + std::to_string(eamxx_len) + "\n"
+          " - extent from file: " + std::to_string(file_len) + "\n");
+        continue;
+      }
       EKAT_REQUIRE_MSG (eamxx_len==file_len,
           "Error! Dimension mismatch for input file variable.\n"
         " - filename : " + m_filename + "\n"
@@ -461,7 +482,9 @@ void AtmosphereInput::set_decompositions()
 
   auto gids_f = m_io_grid->get_partitioned_dim_gids();
   auto gids_h = gids_f.get_view<const AbstractGrid::gid_type*,Host>();
-  auto min_gid = m_io_grid->get_global_min_partitioned_dim_gid();
+  // When reading a column subset, gids are already offsets along the file dimension
+  auto min_gid = m_params.get<bool>("Read_Column_Subset",false)
+               ? 0 : m_io_grid->get_global_min_partitioned_dim_gid();
   std::vector<scorpio::offset_t> offsets(local_dim);
   for (int idof=0; idof<local_dim; ++idof) {
     offsets[idof] = gids_h[idof] - min_gid;
@@ -24,10 +24,15 @@
  *  Input Parameters
  *    Filename: STRING
  *    Fields:   ARRAY OF STRINGS
+ *    Read_Column_Subset: BOOL (optional, default false)
  *  -----
  *  The meaning of these parameters is the following:
  *   - Filename: the name of the input file to be read.
  *   - Fields: list of names of fields to load from file. Should match the name in the file and the name in the field manager.
+ *   - Read_Column_Subset: if true, the IO grid only needs to contain a subset of the columns
+ *     in the file. The partitioned dim gids of the grid are interpreted as (zero-based)
+ *     indices along the file partitioned dimension, and only those entries are read.
+ *     This allows to read, e.g., a single column out of a global file, possibly on one rank only.
  *  Note: you can specify lists (such as the 'Fields' list above) with either of the two syntaxes
  *    Fields: [field_name1, field_name2, ... , field_name_N]
  *    Fields:
@@ -10,6 +10,7 @@
 #include "ekat/util/ekat_string_utils.hpp"
 #include "ekat/std_meta/ekat_std_utils.hpp"
 
+#include <cmath>
 #include <numeric>
 #include <fstream>
 
@@ -211,6 +212,37 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
     m_avg_coeff_threshold = params.get<Real>("fill_threshold");
   }
 
+  // Compression settings: stream-wide defaults, optionally overridden per field
+  if (params.isSublist("compression")) {
+    const auto& c_pl = params.sublist("compression");
+    auto parse_specs = [](ekat::ParameterList pl, CompressionSpecs cs) {
+      cs.deflate_level = pl.get<int>("deflate_level",cs.deflate_level);
+      cs.shuffle       = pl.get<bool>("shuffle",cs.shuffle);
+      cs.quantize_nsb  = pl.get<int>("quantize_nsb",cs.quantize_nsb);
+      return cs;
+    };
+    const auto defaults = parse_specs(c_pl,CompressionSpecs());
+    for (const auto& name : m_fields_names) {
+      m_compression[name] = defaults;
+    }
+    if (c_pl.isSublist("fields")) {
+      const auto& f_pl = c_pl.sublist("fields");
+      for (auto it=f_pl.sublists_names_cbegin(); it!=f_pl.sublists_names_cend(); ++it) {
+        EKAT_REQUIRE_MSG (ekat::contains(m_fields_names,*it),
+            "Error! Compression settings requested for a field not in the output stream.\n"
+            "  - field name: " + *it + "\n");
+        m_compression[*it] = parse_specs(f_pl.sublist(*it),defaults);
+      }
+    }
+    for (const auto& [name,cs] : m_compression) {
+      EKAT_REQUIRE_MSG (cs.quantize_nsb>=0 and cs.quantize_nsb<=52,
+          "Error! Invalid value for quantize_nsb.\n"
+          "  - field name  : " + name + "\n"
+          "  - quantize_nsb: " + std::to_string(cs.quantize_nsb) + "\n"
+          "  - valid range : [0,52] (0 means no quantization)\n");
+    }
+  }
+
   // Helper lambda, to copy io string attributes. This will be used if any
   // remapper is created, to ensure atts set by atm_procs are not lost
   auto transfer_io_str_atts = [&] (const Field& src, Field& tgt) {
@@ -359,6 +391,9 @@ void AtmosphereOutput::init()
 
   // Now that the fields have been gathered register the local views which will be used to determine output data to be written.
   register_views();
+
+  // Gather all the views that need to be updated at every step in one table
+  setup_accumulation_table();
 }
 
 void AtmosphereOutput::
@@ -427,208 +462,127 @@ run (const std::string& filename,
     stop_timer("EAMxx::IO::horiz_remap");
   }
 
-  // Update all of the averaging count views (if needed)
-  // The strategy is as follows:
-  // For the update to the averaged value for this timestep we need to track if
-  // a point in a specific layout is "filled" or not.  So we create a set of local
-  // temporary views for each layout that are either 0 or 1 depending on if the
-  // value is filled or unfilled.
-  // We then use these values to update the overall average count views for that layout.
-  if (m_track_avg_cnt) {
-    // Note, we assume that all fields that share a layout are also masked/filled in the same
-    // way. If we need to handle a case where only a subset of output variables are expected to
-    // be masked/filled then the recommendation is to request those variables in a separate output
-    // stream.
-    // We cycle through all fields and we
-    //  1. Find the avg_cnt view for this field.
-    //  2. If we already processed the avg_cnt view, go to next field, and start from 1 again.
-    //  3. Add 1 to all entries of avg_cnt where field!=fill_value
-    std::set<std::string> avg_updated;
-    for (const auto& name : m_fields_names) {
-      auto avg_cnt_name = m_field_to_avg_cnt_map.at(name);
-      if (avg_updated.count(avg_cnt_name)==1) {
-        // We updated this avg_cnt by checking another field
-        continue;
+  // Safety check on fields that have not been computed yet
+  for (auto const& name : m_fields_names) {
+    auto field = get_field(name,"io");
+    if (not field.get_header().get_tracking().get_time_stamp().is_valid()) {
+      // Safety check: make sure that the user is ok with this
+      if (allow_invalid_fields) {
+        field.deep_copy(m_fill_value);
+      } else {
+        EKAT_REQUIRE_MSG (!m_add_time_dim,
+            "Error! Time-dependent output field '" + name + "' has not been initialized yet\n.");
       }
-      auto field = get_field(name,"io");
-      update_avg_cnt_view(field,m_dev_views_1d.at(avg_cnt_name));
-
-      // Make sure we don't double update this avg cnt
-      avg_updated.insert(avg_cnt_name);
     }
   }
 
-  // Take care of updating and possibly writing fields.
+  // Update the 'running-tally' views with data from the fields, by combining new
+  // data with current avg values, as well as the averaging count views (if needed).
+  // All views are updated in a single kernel, using the table built at init.
+  // NOTE: fields whose IO view is aliasing the Field view (Instant output only)
+  //       are not in the table, since there's nothing to do for them.
+  // NOTE: we assume that all fields that share a layout are also masked/filled in the same
+  //       way, so the avg count of a layout is updated by checking only one of its fields.
+  //       If we need to handle a case where only a subset of output variables are expected to
+  //       be masked/filled then the recommendation is to request those variables in a separate
+  //       output stream.
+  update_accumulation_sources();
+
   // These are needed inside kernels, so crate local copies
   auto do_avg_cnt = m_track_avg_cnt;
   auto avg_type = m_avg_type;
   auto fill_value = m_fill_value;
   auto avg_coeff_threshold = m_avg_coeff_threshold;
-  for (auto const& name : m_fields_names) {
-    // Get all the info for this field.
-          auto  field = get_field(name,"io");
-    const auto& layout = m_layouts.at(field.name());
-    const auto& dims = layout.dims();
-    const auto  rank = layout.rank();
-
-    if (not field.get_header().get_tracking().get_time_stamp().is_valid()) {
-      // Safety check: make sure that the user is ok with this
-      if (allow_invalid_fields) {
-        field.deep_copy(m_fill_value);
+  const auto table   = m_accum_table;
+  const auto offsets = m_accum_offsets;
+  const int nentries = table.extent(0);
+
+  // Find the table entry containing the given (flattened) index,
+  // and the position of the index within that entry
+  auto find_entry = [=] KOKKOS_FUNCTION (const int idx, int& loc) -> int {
+    int lo = 0, hi = nentries;
+    while (hi-lo>1) {
+      const int mid = (lo+hi)/2;
+      if (offsets(mid)<=idx) {
+        lo = mid;
       } else {
-        EKAT_REQUIRE_MSG (!m_add_time_dim,
-            "Error! Time-dependent output field '" + name + "' has not been initialized yet\n.");
+        hi = mid;
       }
     }
+    loc = idx - offsets(lo);
+    return lo;
+  };
 
-    const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
-    const bool is_aliasing_field_view =
-        m_avg_type==OutputAvgType::Instant &&
-        field.get_header().get_alloc_properties().get_padding()==0 &&
-        field.get_header().get_parent().expired() &&
-        not is_diagnostic;
-
-    // Manually update the 'running-tally' views with data from the field,
-    // by combining new data with current avg values.
-    // NOTE: this is skipped for instant output, if IO view is aliasing Field view.
-    auto view_dev = m_dev_views_1d.at(name);
-    auto data = view_dev.data();
-    KT::RangePolicy policy(0,layout.size());
-    const auto extents = layout.extents();
+  KT::RangePolicy accum_policy(0,m_accum_size);
+  Kokkos::parallel_for("AtmosphereOutput::accumulate",accum_policy,KOKKOS_LAMBDA(const int idx) {
+    int loc;
+    const auto& e = table(find_entry(idx,loc));
+
+    // Target is contiguous, while source may be strided
+    int src_idx = 0;
+    int rem = loc;
+    for (int d=e.rank-1; d>=0; --d) {
+      src_idx += (rem % e.extents[d])*e.strides[d];
+      rem /= e.extents[d];
+    }
+    const Real new_val = e.src[src_idx];
 
-    // If the dev_view_1d is aliasing the field device view (must be Instant output),
-    // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
-      switch (rank) {
-        case 1:
-        {
-          // For rank-1 views, we use strided layout, since it helps us
-          // handling a few more scenarios
-          auto new_view_1d = field.get_strided_view<const Real*,Device>();
-          auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_1d(i),avg_view_1d(i),avg_type,fill_value);
-            } else {
-              combine(new_view_1d(i),avg_view_1d(i),avg_type);
-            }
-          });
-          break;
-        }
-        case 2:
-        {
-          auto new_view_2d = field.get_view<const Real**,Device>();
-          auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j;
-            unflatten_idx(idx,extents,i,j);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_2d(i,j),avg_view_2d(i,j),avg_type,fill_value);
-            } else {
-              combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
-            }
-          });
-          break;
-        }
-        case 3:
-        {
-          auto new_view_3d = field.get_view<const Real***,Device>();
-          auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k;
-            unflatten_idx(idx,extents,i,j,k);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_3d(i,j,k),avg_view_3d(i,j,k),avg_type,fill_value);
-            } else {
-              combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
-            }
-          });
-          break;
-        }
-        case 4:
-        {
-          auto new_view_4d = field.get_view<const Real****,Device>();
-          auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l;
-            unflatten_idx(idx,extents,i,j,k,l);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type,fill_value);
-            } else {
-              combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
-            }
-          });
-          break;
-        }
-        case 5:
-        {
-          auto new_view_5d = field.get_view<const Real*****,Device>();
-          auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m;
-            unflatten_idx(idx,extents,i,j,k,l,m);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type,fill_value);
-            } else {
-              combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
-            }
-          });
-          break;
-        }
-        case 6:
-        {
-          auto new_view_6d = field.get_view<const Real******,Device>();
-          auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m,n;
-            unflatten_idx(idx,extents,i,j,k,l,m,n);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n), avg_type,fill_value);
-            } else {
-              combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
-            }
-          });
-          break;
-        }
-        default:
-          EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+    if (e.kind==AccumEntry::Count) {
+      if (new_val!=fill_value) {
+        e.tgt[loc] += 1;
       }
+    } else if (do_avg_cnt) {
+      combine_and_fill(new_val,e.tgt[loc],avg_type,fill_value);
+    } else {
+      combine(new_val,e.tgt[loc],avg_type);
     }
-
-    if (is_write_step) {
-      if (output_step and avg_type==OutputAvgType::Average) {
-        if (do_avg_cnt) {
-          const auto avg_cnt_lookup = m_field_to_avg_cnt_map.at(name);
-          const auto avg_cnt_view = m_dev_views_1d.at(avg_cnt_lookup);
-          const auto avg_nsteps = avg_cnt_view.data();
-          // Divide by steps count only when the summation is complete
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            Real coeff_percentage = Real(avg_nsteps[i])/nsteps_since_last_output;
-            if (data[i] != fill_value && coeff_percentage > avg_coeff_threshold) {
-              data[i] /= avg_nsteps[i];
-            } else {
-              data[i] = fill_value;
-            }
-          });
+  });
+
+  // Divide by steps count only when the summation is complete
+  if (output_step and avg_type==OutputAvgType::Average) {
+    Kokkos::parallel_for("AtmosphereOutput::average",accum_policy,KOKKOS_LAMBDA(const int idx) {
+      int loc;
+      const auto& e = table(find_entry(idx,loc));
+      if (e.kind!=AccumEntry::Combine) {
+        return;
+      }
+      Real& val = e.tgt[loc];
+      if (do_avg_cnt) {
+        const Real avg_nsteps = e.cnt[loc];
+        Real coeff_percentage = avg_nsteps/nsteps_since_last_output;
+        if (val != fill_value && coeff_percentage > avg_coeff_threshold) {
+          val /= avg_nsteps;
         } else {
-          // Divide by steps count only when the summation is complete
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            data[i] /= nsteps_since_last_output;
-          });
+          val = fill_value;
         }
+      } else {
+        val /= nsteps_since_last_output;
       }
+    });
+  }
+
+  // Handle writing the fields and the average count variables to file
+  if (is_write_step) {
+    for (const auto& name : m_fields_names) {
+      auto& view_dev = m_dev_views_1d.at(name);
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
+      const Real* data = view_host.data();
+      // Quantize only regular output, so that restart files are exact.
+      // Work on a copy, since view_host may alias the field host view.
+      const int nsb = m_compression.count(name)==1 ? m_compression.at(name).quantize_nsb : 0;
+      if (nsb>0 and filename==m_quantized_filename) {
+        m_quantize_buf.assign(view_host.data(),view_host.data()+view_host.size());
+        bitround(m_quantize_buf.data(),m_quantize_buf.size(),nsb,static_cast<Real>(m_fill_value));
+        data = m_quantize_buf.data();
+      }
       auto func_start = std::chrono::steady_clock::now();
-      scorpio::write_var(filename,name,view_host.data());
+      scorpio::write_var(filename,name,data);
       auto func_finish = std::chrono::steady_clock::now();
       auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
       duration_write += duration_loc.count();
     }
-  }
-  // Handle writing the average count variables to file
-  if (is_write_step) {
     for (const auto& name : m_avg_cnt_names) {
       auto& view_dev = m_dev_views_1d.at(name);
       // Bring data to host
@@ -912,10 +866,118 @@ reset_dev_views()
   }
 }
 /* ---------------------------------------------------------- */
+void AtmosphereOutput::set_accum_src (AccumEntry& e, const Field& f) const
+{
+  const auto& layout = m_layouts.at(f.name());
+  e.rank = layout.rank();
+  auto set = [&](const auto& v) {
+    e.src = v.data();
+    for (int d=0; d<e.rank; ++d) {
+      e.extents[d] = layout.dim(d);
+      e.strides[d] = v.stride(d);
+    }
+  };
+  switch (e.rank) {
+    case 1: set(f.get_strided_view<const Real*,Device>());      break;
+    case 2: set(f.get_strided_view<const Real**,Device>());     break;
+    case 3: set(f.get_strided_view<const Real***,Device>());    break;
+    case 4: set(f.get_strided_view<const Real****,Device>());   break;
+    case 5: set(f.get_strided_view<const Real*****,Device>());  break;
+    case 6: set(f.get_strided_view<const Real******,Device>()); break;
+    default:
+      EKAT_ERROR_MSG (
+          "Error! Field rank not supported by AtmosphereOutput.\n"
+          "  - field name:   " + f.name() + "\n"
+          "  - field layout: " + layout.to_string() + "\n");
+  }
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::update_accumulation_sources()
+{
+  bool changed = false;
+  const int nentries = m_accum_src_fields.size();
+  for (int i=0; i<nentries; ++i) {
+    auto& e = m_accum_table_h(i);
+    const AccumEntry old = e;
+    set_accum_src(e,m_accum_src_fields[i]);
+    changed |= e.src!=old.src;
+    for (int d=0; d<e.rank; ++d) {
+      changed |= e.strides[d]!=old.strides[d];
+    }
+  }
+  if (changed) {
+    Kokkos::deep_copy(m_accum_table,m_accum_table_h);
+  }
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::setup_accumulation_table()
+{
+  std::vector<AccumEntry> entries;
+  m_accum_src_fields.clear();
+
+  std::set<std::string> avg_cnt_added;
+  for (const auto& name : m_fields_names) {
+    auto field = get_field(name,"io");
+
+    // If the dev_view_1d is aliasing the field device view (must be Instant output),
+    // then there's no point in copying from the field's view to dev_view
+    const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
+    const bool is_aliasing_field_view =
+        m_avg_type==OutputAvgType::Instant &&
+        field.get_header().get_alloc_properties().get_padding()==0 &&
+        field.get_header().get_parent().expired() &&
+        not is_diagnostic;
+
+    if (not is_aliasing_field_view) {
+      AccumEntry e;
+      e.kind = AccumEntry::Combine;
+      e.tgt  = m_dev_views_1d.at(name).data();
+      e.cnt  = m_track_avg_cnt ? m_dev_views_1d.at(m_field_to_avg_cnt_map.at(name)).data() : nullptr;
+      set_accum_src(e,field);
+      entries.push_back(e);
+      m_accum_src_fields.push_back(field);
+    }
+
+    // The first field with a given avg count is used to update it
+    if (m_track_avg_cnt) {
+      const auto& avg_cnt_name = m_field_to_avg_cnt_map.at(name);
+      if (avg_cnt_added.insert(avg_cnt_name).second) {
+        AccumEntry e;
+        e.kind = AccumEntry::Count;
+        e.tgt  = m_dev_views_1d.at(avg_cnt_name).data();
+        e.cnt  = nullptr;
+        set_accum_src(e,field);
+        entries.push_back(e);
+        m_accum_src_fields.push_back(field);
+      }
+    }
+  }
+
+  const int nentries = entries.size();
+  m_accum_table   = accum_table_type("accum_table",nentries);
+  m_accum_offsets = decltype(m_accum_offsets)("accum_offsets",nentries+1);
+  m_accum_table_h = Kokkos::create_mirror_view(m_accum_table);
+  auto offsets_h  = Kokkos::create_mirror_view(m_accum_offsets);
+  offsets_h(0) = 0;
+  for (int i=0; i<nentries; ++i) {
+    const auto& e = entries[i];
+    int size = 1;
+    for (int d=0; d<e.rank; ++d) {
+      size *= e.extents[d];
+    }
+    m_accum_table_h(i) = e;
+    offsets_h(i+1) = offsets_h(i) + size;
+  }
+  Kokkos::deep_copy(m_accum_table,m_accum_table_h);
+  Kokkos::deep_copy(m_accum_offsets,offsets_h);
+  m_accum_size = offsets_h(nentries);
+}
+/* ---------------------------------------------------------- */
 void AtmosphereOutput::
 register_variables(const std::string& filename,
                    const std::string& fp_precision,
-                   const scorpio::FileMode mode)
+                   const scorpio::FileMode mode,
+                   const bool is_restart_file)
 {
   using namespace ShortFieldTagsNames;
   using strvec_t = std::vector<std::string>;
@@ -988,6 +1050,25 @@ register_variables(const std::string& filename,
       scorpio::define_var (filename, name, units, vec_of_dims,
                             "real",fp_precision, m_add_time_dim);
 
+      // Compression is lossless, so it is fine for restart files too. Quantization
+      // is only applied to (and advertised in) regular output files.
+      if (m_compression.count(name)==1) {
+        const auto& cs = m_compression.at(name);
+        if (cs.deflate_level>0 or cs.shuffle) {
+          const bool applied = scorpio::define_var_compression(filename,name,cs.deflate_level,cs.shuffle);
+          if (not applied and m_atm_logger) {
+            m_atm_logger->warn("[EAMxx::scorpio_output] Compression requested, but the file format does not support it.\n"
+                               "  - filename: " + filename + "\n"
+                               "  - varname : " + name + "\n");
+          }
+        }
+        if (cs.quantize_nsb>0 and not is_restart_file) {
+          scorpio::set_attribute(filename,name,"quantization_algorithm",std::string("BitRound"));
+          scorpio::set_attribute(filename,name,"quantization_nsb",cs.quantize_nsb);
+          scorpio::set_attribute(filename,name,"quantization_max_relative_error",std::ldexp(1.0,-cs.quantize_nsb-1));
+        }
+      }
+
       // Add FillValue as an attribute of each variable
       // FillValue is a protected metadata, do not add it if it already existed
       if (fp_precision=="double" or
@@ -1168,7 +1249,8 @@ void AtmosphereOutput::set_decompositions(const std::string& filename)
 void AtmosphereOutput::
 setup_output_file(const std::string& filename,
                   const std::string& fp_precision,
-                  const scorpio::FileMode mode)
+                  const scorpio::FileMode mode,
+                  const bool is_restart_file)
 {
   // Register dimensions with netCDF file.
   for (auto it : m_dims) {
@@ -1190,7 +1272,10 @@ setup_output_file(const std::string& filename,
   }
 
   // Register variables with netCDF file.  Must come after dimensions are registered.
-  register_variables(filename,fp_precision,mode);
+  register_variables(filename,fp_precision,mode,is_restart_file);
+  if (not is_restart_file) {
+    m_quantized_filename = filename;
+  }
 
   // Set the offsets of the local dofs in the global vector.
   set_decompositions(filename);
@@ -1431,102 +1516,4 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
   return diag;
 }
 
-// Helper function to mark filled points in a specific layout
-void AtmosphereOutput::
-update_avg_cnt_view(const Field& field, view_1d_dev& dev_view) {
-  const auto& name   = field.name();
-  const auto& layout = m_layouts.at(name);
-  const auto& dims   = layout.dims();
-        auto  data   = dev_view.data();
-  const auto fill_value = m_fill_value;
-
-  KT::RangePolicy policy(0,layout.size());
-  const auto extents = layout.extents();
-  switch (layout.rank()) {
-    case 1:
-    {
-      // For rank-1 views, we use strided layout, since it helps us
-      // handling a few more scenarios
-      auto src_view_1d = field.get_strided_view<const Real*,Device>();
-      auto tgt_view_1d = view_Nd_dev<1>(data,dims[0]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-        if (src_view_1d(i)!=fill_value) {
-          tgt_view_1d(i) += 1;
-        }
-      });
-      break;
-    }
-    case 2:
-    {
-      auto src_view_2d = field.get_view<const Real**,Device>();
-      auto tgt_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j;
-        unflatten_idx(idx,extents,i,j);
-        if (src_view_2d(i,j)!=fill_value) {
-          tgt_view_2d(i,j) += 1;
-        }
-      });
-      break;
-    }
-    case 3:
-    {
-      auto src_view_3d = field.get_view<const Real***,Device>();
-      auto tgt_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j,k;
-        unflatten_idx(idx,extents,i,j,k);
-        if (src_view_3d(i,j,k)!=fill_value) {
-          tgt_view_3d(i,j,k) += 1;
-        }
-      });
-      break;
-    }
-    case 4:
-    {
-      auto src_view_4d = field.get_view<const Real****,Device>();
-      auto tgt_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j,k,l;
-        unflatten_idx(idx,extents,i,j,k,l);
-        if (src_view_4d(i,j,k,l)!=fill_value) {
-          tgt_view_4d(i,j,k,l) += 1;
-        }
-      });
-      break;
-    }
-    case 5:
-    {
-      auto src_view_5d = field.get_view<const Real*****,Device>();
-      auto tgt_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j,k,l,m;
-        unflatten_idx(idx,extents,i,j,k,l,m);
-        if (src_view_5d(i,j,k,l,m)!=fill_value) {
-          tgt_view_5d(i,j,k,l,m) += 1;
-        }
-      });
-      break;
-    }
-    case 6:
-    {
-      auto src_view_6d = field.get_view<const Real******,Device>();
-      auto tgt_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-        int i,j,k,l,m,n;
-        unflatten_idx(idx,extents,i,j,k,l,m,n);
-        if (src_view_6d(i,j,k,l,m,n)!=fill_value) {
-          tgt_view_6d(i,j,k,l,m,n) += 1;
-        }
-      });
-      break;
-    }
-    default:
-      EKAT_ERROR_MSG (
-            "Error! Field rank not not supported by AtmosphereOutput.\n"
-          "  - field name:   " + field.name() + "\n"
-          "  - field layout: " + layout.to_string() + "\n");
-  }
-}
-
 } // namespace scream
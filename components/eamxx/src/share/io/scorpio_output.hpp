@@ -137,8 +137,8 @@ public:
   void restart (const std::string& filename);
   void init();
   void reset_dev_views();
-  void update_avg_cnt_view(const Field&, view_1d_dev& dev_view);
-  void setup_output_file (const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode);
+  void setup_output_file (const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode,
+                          const bool is_restart_file = false);
 
   void init_timestep (const util::TimeStamp& start_of_step);
   void run (const std::string& filename,
@@ -166,7 +166,8 @@ protected:
   std::shared_ptr<const fm_type> get_field_manager (const std::string& mode) const;
 
   void register_dimensions(const std::string& name);
-  void register_variables(const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode);
+  void register_variables(const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode,
+                          const bool is_restart_file);
   void set_decompositions(const std::string& filename);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
@@ -179,6 +180,36 @@ protected:
   // Tracking the averaging of any filled values:
   void set_avg_cnt_tracking(const std::string& name, const FieldLayout& layout);
 
+  // Build the device table used to update all output views in a single kernel
+  void setup_accumulation_table ();
+
+  // Refresh the source pointers/strides of the table. Dynamic subfields (e.g., Homme
+  // time levels) point to a different slice of their parent at every step.
+  void update_accumulation_sources ();
+
+  // An entry of the accumulation table. Each entry maps a (possibly strided)
+  // source field onto a contiguous target view (an output view, or an avg count view).
+  // The source is accessed as src[sum_d idx_d*strides[d]], where idx is the
+  // multi-index corresponding to the flat index in the target view.
+  static constexpr int max_accum_rank = 6;
+  struct AccumEntry {
+    enum Kind : int {
+      Combine = 0,  // Combine src into tgt according to avg type
+      Count   = 1   // Add 1 to tgt where src is not filled
+    };
+    const Real* src;
+    Real*       tgt;
+    const Real* cnt;  // Avg count view (for Combine entries, if tracking avg cnt)
+    int kind;
+    int rank;
+    int extents[max_accum_rank];
+    int strides[max_accum_rank];
+  };
+  using accum_table_type = typename KT::template view_1d<AccumEntry>;
+
+  // Store data pointer, extents, and strides of the field (possibly strided) view
+  void set_accum_src (AccumEntry& e, const Field& f) const;
+
   // --- Internal variables --- //
   ekat::Comm                          m_comm;
 
@@ -215,10 +246,30 @@ protected:
   // is used inside other calculation and/or remap.
   float m_fill_value = constants::DefaultFillValue<float>().value;
 
+  // Per-field compression settings, from the 'compression' sublist of the stream params.
+  // Fields not in the map are written as they are.
+  struct CompressionSpecs {
+    int  deflate_level = 0;     // 0 means no deflate
+    bool shuffle       = false;
+    int  quantize_nsb  = 0;     // Mantissa bits kept by BitRound (0 means no quantization)
+  };
+  std::map<std::string,CompressionSpecs>  m_compression;
+  std::vector<Real>                       m_quantize_buf;
+  std::string                             m_quantized_filename; // Last non-restart file set up
+
   // Local views of each field to be used for "averaging" output and writing to file.
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
+  // Table of all the output views that need to be updated at every step.
+  // m_accum_offsets(i) is the position of the first entry of the i-th
+  // table entry in the flattened index space of all the entries.
+  accum_table_type                      m_accum_table;
+  typename accum_table_type::HostMirror m_accum_table_h;
+  std::vector<Field>                    m_accum_src_fields; // Source field of each entry
+  typename KT::template view_1d<int>    m_accum_offsets;
+  int                                   m_accum_size = 0;
+
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
 
@@ -3,7 +3,11 @@
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/util/scream_utils.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <limits>
 
 namespace scream {
 
@@ -92,4 +96,46 @@ util::TimeStamp read_timestamp (const std::string& filename,
   return ts;
 }
 
+namespace {
+
+template<typename T, typename UInt>
+void bitround_impl (T* data, const long long n, const int nsb, const T fill_value)
+{
+  static_assert (sizeof(T)==sizeof(UInt), "Error! Mismatching int/float sizes.\n");
+  constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+
+  EKAT_REQUIRE_MSG (nsb>=1 and nsb<=52,
+      "Error! Invalid number of significant bits for bitround.\n"
+      " - nsb: " + std::to_string(nsb) + "\n"
+      " - valid range: [1,52]\n");
+  if (nsb>=mantissa_bits) {
+    return;
+  }
+
+  const int  drop = mantissa_bits - nsb;
+  const UInt half = UInt(1) << (drop-1);
+  const UInt mask = ~((UInt(1) << drop) - 1);
+  for (long long i=0; i<n; ++i) {
+    if (data[i]==fill_value or not std::isfinite(data[i])) {
+      continue;
+    }
+    UInt u;
+    std::memcpy(&u,&data[i],sizeof(T));
+    u = (u + half) & mask;
+    std::memcpy(&data[i],&u,sizeof(T));
+  }
+}
+
+} // anonymous namespace
+
+void bitround (double* data, const long long n, const int nsb, const double fill_value)
+{
+  bitround_impl<double,std::uint64_t>(data,n,nsb,fill_value);
+}
+
+void bitround (float* data, const long long n, const int nsb, const float fill_value)
+{
+  bitround_impl<float,std::uint32_t>(data,n,nsb,fill_value);
+}
+
 } // namespace scream
@@ -94,5 +94,14 @@ util::TimeStamp read_timestamp (const std::string& filename,
                                 const std::string& ts_name,
                                 const bool read_nsteps = false);
 
+// Quantize data in place via BitRound: keep only the nsb most significant bits
+// of the mantissa, rounding to nearest. The relative error of each entry is
+// bounded by 2^-(nsb+1), while the trailing zero bits make the data much more
+// compressible by lossless filters (deflate). Entries equal to fill_value, as
+// well as non-finite entries, are left untouched. Requires 1<=nsb<=52 (for
+// float data, nsb>=23 is a no-op).
+void bitround (double* data, const long long n, const int nsb, const double fill_value);
+void bitround (float*  data, const long long n, const int nsb, const float  fill_value);
+
 } // namespace scream
 #endif // SCREAM_IO_UTILS_HPP
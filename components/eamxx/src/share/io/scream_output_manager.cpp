@@ -3,6 +3,7 @@
 #include "share/io/scorpio_input.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/util/scream_timing.hpp"
+#include "share/util/eamxx_metrics.hpp"
 #include "share/scream_config.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
@@ -341,6 +342,8 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   std::string timer_root = m_is_model_restart_output ? "EAMxx::IO::restart" : "EAMxx::IO::standard";
   start_timer(timer_root);
   start_timer("EAMxx::IO::" + m_params.name());
+  Metrics::instance().start_region("IO::" + m_params.name());
+  Kokkos::Profiling::pushRegion("IO::" + m_params.name());
 
   // Check if this is a write step (and what kind)
   // Note: a full checkpoint not only writes globals in the restart file, but also all the history variables.
@@ -552,6 +555,8 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     }
   }
 
+  Kokkos::Profiling::popRegion();
+  Metrics::instance().stop_region("IO::" + m_params.name());
   stop_timer("EAMxx::IO::" + m_params.name());
   stop_timer(timer_root);
 }
@@ -818,7 +823,7 @@ setup_file (      IOFileSpecs& filespecs,
 
   // Make all output streams register their dims/vars
   for (auto& it : m_output_streams) {
-    it->setup_output_file(filename,fp_precision,mode);
+    it->setup_output_file(filename,fp_precision,mode,filespecs.is_restart_file());
   }
 
   // If grid data is needed,  also register geo data fields. Skip if file is resumed,
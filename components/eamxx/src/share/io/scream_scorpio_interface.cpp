@@ -31,17 +31,11 @@ public:
   strmap_t<PIOFile>                     files;
   strmap_t<std::shared_ptr<PIODecomp>>  decomps;
 
-  // In the above map, we would like to label decomps as dtype_dim1$N1_dim2$N2...
-  // where N$i is the global length of dim$i. However, it *may* happen that we use
-  // two different decompositions for the same global layout, which would clash
-  // the names. For this reason, we append at the end an increasing counter,
-  // which disambiguate between globally-equivalent partitions.
-  // When adding a new decomp, we check this map to see if another decomp
-  // already exists with the same global layout. If so, we first check to see
-  // if that decomp is equivalent to the new one *on all ranks*. If yes, we
-  // recycle it, otherwise we create a new PIO decomp.
-  // strmap_t<std::list<std::string>>    decomp_global_layout_to_decomp_name;
-  // strmap_t<int>                       decomp_global_layout_to_counter;
+  // In the above map, we label decomps as dtype-dim1<N1>_dim2<N2>...@H, where N$i
+  // is the global length of dim$i, and H is a hash of the offsets of the decomposed
+  // dim on all ranks. The hash is needed since we *may* use two different
+  // decompositions for the same global layout (e.g., when reading a subset of the
+  // columns of a file), which would otherwise clash the names.
 
   int         pio_sysid        = -1;
   int         pio_type_default = -1;
@@ -288,6 +282,27 @@ PIOVar& get_var (const std::string& filename,
   return *f.vars.at(varname);
 }
 
+// Hash the offsets of all ranks. Each rank hashes its rank and its offsets,
+// and the local hashes are combined, so that all ranks get the same value.
+std::uint64_t global_offsets_hash (const std::vector<offset_t>& my_offsets)
+{
+  const auto& comm = ScorpioSession::instance().comm;
+  auto hash_combine = [](std::uint64_t& h, const std::uint64_t v) {
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h<<6) + (h>>2);
+  };
+
+  std::uint64_t my_hash = 0;
+  hash_combine(my_hash,comm.rank());
+  hash_combine(my_hash,my_offsets.size());
+  for (auto o : my_offsets) {
+    hash_combine(my_hash,o);
+  }
+
+  std::uint64_t hash;
+  MPI_Allreduce(&my_hash,&hash,1,MPI_UINT64_T,MPI_BXOR,comm.mpi_comm());
+  return hash;
+}
+
 } // namespace impl
 
 // ====================== Global IO operations ======================= // 
@@ -415,6 +430,7 @@ void register_file (const std::string& filename,
 
     f.mode = mode;
     f.iotype = iotype;
+    f.pio_iotype = iotype_int;
     f.name = filename;
 
     if (mode & Read) {
@@ -739,6 +755,7 @@ void set_var_decomp (PIOVar& var,
     decomp_tag += d->name + "<" + std::to_string(d->length) + ">_";
   }
   decomp_tag.pop_back(); // remove trailing underscore
+  decomp_tag += "@" + std::to_string(var.dims[0]->offsets_hash);
 
   // Check if a decomp with this name already exists
   auto& s = ScorpioSession::instance();
@@ -864,6 +881,7 @@ void set_dim_decomp (const std::string& filename,
   }
 
   dim.offsets = std::make_shared<std::vector<offset_t>>(my_offsets);
+  dim.offsets_hash = impl::global_offsets_hash(my_offsets);
 
   // If vars were already defined, we need to process them,
   // and create the proper PIODecomp objects.
@@ -1012,6 +1030,36 @@ void define_var (const std::string& filename, const std::string& varname,
   define_var(filename,varname,"",dimensions,dtype,dtype,time_dependent);
 }
 
+bool define_var_compression (const std::string& filename,
+                             const std::string& varname,
+                             const int deflate_level,
+                             const bool shuffle)
+{
+  auto& f = impl::get_file(filename,"scorpio::define_var_compression");
+  const auto& var = impl::get_var(filename,varname,"scorpio::define_var_compression");
+
+  EKAT_REQUIRE_MSG (f.mode==Write and not f.enddef,
+      "Error! Compression settings can only be set while defining a new file.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  EKAT_REQUIRE_MSG (deflate_level>=0 and deflate_level<=9,
+      "Error! Invalid deflate level.\n"
+      " - filename     : " + filename + "\n"
+      " - varname      : " + varname + "\n"
+      " - deflate level: " + std::to_string(deflate_level) + "\n"
+      " - valid range  : [0,9]\n");
+
+  // Filters are a NetCDF-4 feature. Other formats simply store raw data.
+  if (f.pio_iotype!=PIO_IOTYPE_NETCDF4C and f.pio_iotype!=PIO_IOTYPE_NETCDF4P) {
+    return false;
+  }
+
+  int err = PIOc_def_var_deflate(f.ncid,var.ncid,shuffle ? 1 : 0,
+                                 deflate_level>0 ? 1 : 0,deflate_level);
+  check_scorpio_noerr(err,f.name,"variable",varname,"define_var_compression","def_var_deflate");
+  return true;
+}
+
 // This overload is not exposed externally. Also, filename is only
 // used to print it in case there are errors
 void change_var_dtype (PIOVar& var,
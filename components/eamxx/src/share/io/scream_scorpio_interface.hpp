@@ -153,6 +153,15 @@ void define_var (const std::string& filename, const std::string& varname,
                  const std::string& dtype,
                  const bool time_dependent = false);
 
+// Request lossless compression of a var (shuffle filter and/or deflate, with
+// 0<=deflate_level<=9). Must be called after define_var, and before enddef.
+// Filters are only available for NetCDF-4 files: for other formats this is a
+// no-op, and the function returns false.
+bool define_var_compression (const std::string& filename,
+                             const std::string& varname,
+                             const int deflate_level,
+                             const bool shuffle);
+
 // This is useful when reading data sets. E.g., if the pio file is storing
 // a var as float, but we need to read it as double, we need to call this.
 // NOTE: read_var/write_var automatically change the dtype if the input
@@ -1,6 +1,7 @@
 #ifndef SCREAM_SCORPIO_TYPES_HPP
 #define SCREAM_SCORPIO_TYPES_HPP
 
+#include <cstdint>
 #include <string>
 #include <map>
 #include <vector>
@@ -69,6 +70,10 @@ struct PIODim : public PIOFileEntity {
   // NOTE: use a pointer, so we can detect if a decomposition already
   //       existed or not when we set one.
   std::shared_ptr<std::vector<offset_t>> offsets;
+
+  // Hash of the offsets of ALL ranks (same value on all ranks). Two dims with
+  // the same name/length but different distributions have different hashes.
+  std::uint64_t offsets_hash = 0;
 };
 
 // A decomposition
@@ -122,6 +127,7 @@ struct PIOFile : public PIOEntity {
   std::shared_ptr<PIODim> time_dim;
   FileMode mode;
   IOType   iotype;
+  int      pio_iotype = -1; // The actual PIO_IOTYPE_XYZ used (resolves DefaultIOType)
   bool enddef = false;
 
   // We keep track of how many places are currently using this file, so that we
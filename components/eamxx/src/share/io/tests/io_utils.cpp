@@ -4,7 +4,12 @@
 #include <share/io/scream_io_control.hpp>
 #include <share/util/scream_time_stamp.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <limits>
+#include <vector>
 
 TEST_CASE ("find_filename_in_rpointer") {
   using namespace scream;
@@ -127,3 +132,42 @@ TEST_CASE ("io_control") {
     REQUIRE (not control.is_write_step(t3));
   }
 }
+
+TEST_CASE ("bitround") {
+  using namespace scream;
+
+  const double fill = -99999.0;
+  std::vector<double> orig = {1.0, -3.14159265358979, 2.718281828459045e-20,
+                              6.02214076e23, fill, 0.0, -0.0};
+  orig.push_back(std::numeric_limits<double>::infinity());
+
+  for (int nsb : {1, 7, 10, 23, 52}) {
+    auto data = orig;
+    bitround(data.data(),data.size(),nsb,fill);
+    const double tol = std::ldexp(1.0,-nsb-1);
+    for (size_t i=0; i<data.size(); ++i) {
+      if (orig[i]==fill or not std::isfinite(orig[i]) or orig[i]==0) {
+        // Untouched
+        REQUIRE (data[i]==orig[i]);
+        continue;
+      }
+      REQUIRE (std::abs(data[i]-orig[i])<=tol*std::abs(orig[i]));
+
+      // The dropped mantissa bits must be zero
+      std::uint64_t u;
+      std::memcpy(&u,&data[i],sizeof(double));
+      const int drop = 52-nsb;
+      REQUIRE ((drop==0 or (u & ((std::uint64_t(1) << drop) - 1))==0));
+    }
+  }
+
+  // For single precision data, keeping all 23 mantissa bits is a no-op
+  std::vector<float> f = {1.1f, -2.2f, 3.3e10f};
+  auto g = f;
+  bitround(g.data(),g.size(),23,float(fill));
+  REQUIRE (g==f);
+
+  // Invalid nsb
+  REQUIRE_THROWS (bitround(f.data(),f.size(),0,float(fill)));
+  REQUIRE_THROWS (bitround(f.data(),f.size(),53,float(fill)));
+}
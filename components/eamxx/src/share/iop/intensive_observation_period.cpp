@@ -361,7 +361,7 @@ setup_io_info(const std::string& file_name,
     using minloc_t = Kokkos::MinLoc<Real,int>;
     using minloc_value_t = typename minloc_t::value_type;
     minloc_value_t minloc;
-    Kokkos::parallel_reduce(ncols, KOKKOS_LAMBDA (int icol, minloc_value_t& result) {
+    Kokkos::parallel_reduce("IntensiveObservationPeriod::setup_io_info", ncols, KOKKOS_LAMBDA (int icol, minloc_value_t& result) {
       auto dist = std::abs(lat_v(icol)-target_lat)+std::abs(lon_v(icol)-target_lon);
       if(dist<result.val) {
         result.val = dist;
@@ -379,18 +379,39 @@ setup_io_info(const std::string& file_name,
     const auto lon_v_h = lon_f.get_view<Real*,Host>();
     auto local_column_idx = minloc.loc;
     auto min_dist_rank = min_dist_and_rank.second;
+    // The io grid gids span [min_gid,min_gid+ncol), matching the file ncol dimension
+    const auto min_gid = io_grid->get_global_min_dof_gid();
     Real lat_lon_vals[2];
+    int global_column_idx;
     if (my_rank == min_dist_rank) {
       lat_lon_vals[0] = lat_v_h(local_column_idx);
       lat_lon_vals[1] = lon_v_h(local_column_idx);
+
+      const auto gids_h = io_grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+      global_column_idx = gids_h(local_column_idx) - min_gid;
     }
     m_comm.broadcast(lat_lon_vals, 2, min_dist_rank);
+    m_comm.broadcast(&global_column_idx, 1, min_dist_rank);
 
     // Set local_column_idx=-1 for mpi ranks not containing minimum lat/lon distance
     if (my_rank != min_dist_rank) local_column_idx = -1;
 
     // Store closest lat/lon info for this grid, used later when reading ICs
-    m_lat_lon_info[grid_name] = ClosestLatLonInfo{lat_lon_vals[0], lat_lon_vals[1], min_dist_rank, local_column_idx};
+    m_lat_lon_info[grid_name] = ClosestLatLonInfo{lat_lon_vals[0], lat_lon_vals[1], min_dist_rank,
+                                                  local_column_idx, global_column_idx};
+
+    // Create a grid containing only the closest column, on the rank that owns it.
+    // Subsequent reads only need to fetch this column from file.
+    const int num_my_cols = my_rank==min_dist_rank ? 1 : 0;
+    auto col_grid = std::make_shared<PointGrid>(grid_name,num_my_cols,
+                                                io_grid->get_num_vertical_levels(),
+                                                m_comm);
+    auto col_gids_h = col_grid->get_dofs_gids().get_view<AbstractGrid::gid_type*,Host>();
+    if (num_my_cols==1) {
+      col_gids_h(0) = global_column_idx;
+    }
+    col_grid->get_dofs_gids().sync_to_dev();
+    m_io_col_grids[grid_name] = col_grid;
   }
 }
 
@@ -419,7 +440,8 @@ read_fields_from_file_for_iop (const std::string& file_name,
                    "Error! Attempting to read IOP initial conditions on "
                    +grid_name+" grid, but m_lat_lon_info entry has not been created.\n");
 
-  auto io_grid = m_io_grids[grid_name];
+  // Only read the closest column, on the rank that owns it
+  auto io_grid = m_io_col_grids[grid_name];
   if (grid_name=="Physics GLL" && scorpio::has_dim(file_name,"ncol_d")) {
     // If we are on GLL grid, and nc file contains "ncol_d" dimension,
     // we need to reset COL dim tag
@@ -453,8 +475,18 @@ read_fields_from_file_for_iop (const std::string& file_name,
     io_fields.push_back(io_field);
   }
 
-  // Read data from file
-  AtmosphereInput file_reader(file_name,io_grid,io_fields);
+  // Read data from file. Since io_grid only contains the closest column,
+  // we need to tell the reader that it is a subset of the file columns.
+  ekat::ParameterList reader_params;
+  reader_params.set("Filename",file_name);
+  reader_params.set("Read_Column_Subset",true);
+  auto& reader_fnames = reader_params.get<vos>("Field Names",{});
+  auto io_fm = std::make_shared<FieldManager>(io_grid);
+  for (const auto& f : io_fields) {
+    io_fm->add_field(f);
+    reader_fnames.push_back(f.name());
+  }
+  AtmosphereInput file_reader(reader_params,io_fm);
   file_reader.read_variables(time_index);
   file_reader.finalize();
 
@@ -476,8 +508,8 @@ read_fields_from_file_for_iop (const std::string& file_name,
     // MPI rank with closest column index store column data
     const auto mpi_rank_with_col = m_lat_lon_info[grid_name].mpi_rank_of_closest_column;
     if (m_comm.rank() == mpi_rank_with_col) {
-      const auto col_idx_with_data = m_lat_lon_info[grid_name].local_column_index_of_closest_column;
-      col_data.deep_copy<Host>(io_field.subfield(0,col_idx_with_data));
+      // io_field only stores the closest column
+      col_data.deep_copy<Host>(io_field.subfield(0,0));
     }
 
     // Broadcast column data to all other ranks
@@ -547,7 +579,7 @@ read_iop_file_data (const util::TimeStamp& current_ts)
     EKAT_REQUIRE_MSG(file_levs+1 == iop_file_pressure.get_header().get_identifier().get_layout().dim(0),
                     "Error! Unexpected size for helper field \"iop_file_pressure\"\n");
     const auto& Ps = surface_pressure.get_view<const Real>();
-    Kokkos::parallel_reduce(file_levs+1, KOKKOS_LAMBDA (const int ilev, int& lmin) {
+    Kokkos::parallel_reduce("IntensiveObservationPeriod::read_iop_file_data::file_pressure", file_levs+1, KOKKOS_LAMBDA (const int ilev, int& lmin) {
       if (ilev == file_levs) {
         // Add surface pressure to last iop file pressure entry
         iop_file_pres_v(ilev) = Ps()/100;
@@ -573,12 +605,12 @@ read_iop_file_data (const util::TimeStamp& current_ts)
     const auto model_nlevs = model_pressure.get_header().get_identifier().get_layout().dim(0);
     const auto hyam_v = m_helper_fields["hyam"].get_view<const Real*>();
     const auto hybm_v = m_helper_fields["hybm"].get_view<const Real*>();
-    Kokkos::parallel_for(model_nlevs, KOKKOS_LAMBDA (const int ilev) {
+    Kokkos::parallel_for("IntensiveObservationPeriod::read_iop_file_data::model_pressure", model_nlevs, KOKKOS_LAMBDA (const int ilev) {
       model_pres_v(ilev) = 1000*hyam_v(ilev) + Ps()*hybm_v(ilev)/100;
     });
 
     // Find file pressure levels just outside the range of model pressure levels
-    Kokkos::parallel_reduce(adjusted_file_levs, KOKKOS_LAMBDA (const int& ilev, int& lmax, int& lmin) {
+    Kokkos::parallel_reduce("IntensiveObservationPeriod::read_iop_file_data::file_level_range", adjusted_file_levs, KOKKOS_LAMBDA (const int& ilev, int& lmax, int& lmin) {
       if (iop_file_pres_v(ilev) <= model_pres_v(0) && ilev > lmax) {
         lmax = ilev;
       }
@@ -594,7 +626,7 @@ read_iop_file_data (const util::TimeStamp& current_ts)
     if (iop_file_end   == Kokkos::reduction_identity<int>::min()) iop_file_end = adjusted_file_levs;
 
     // Find model pressure levels just inside range of file pressure levels
-    Kokkos::parallel_reduce(model_nlevs, KOKKOS_LAMBDA (const int& ilev, int& lmin, int& lmax) {
+    Kokkos::parallel_reduce("IntensiveObservationPeriod::read_iop_file_data::model_level_range", model_nlevs, KOKKOS_LAMBDA (const int& ilev, int& lmin, int& lmax) {
       if (model_pres_v(ilev) >= iop_file_pres_v(iop_file_start) && ilev < lmin) {
         lmin = ilev;
       }
@@ -683,7 +715,7 @@ read_iop_file_data (const util::TimeStamp& current_ts)
 
       ekat::LinInterp<Real,Pack1d::n> vert_interp(1, nlevs_input, nlevs_output);
       const auto policy = ESU::get_default_team_policy(1, total_nlevs);
-      Kokkos::parallel_for(policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+      Kokkos::parallel_for("IntensiveObservationPeriod::read_iop_file_data::vert_interp", policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
         const auto x_src  = Kokkos::subview(iop_file_pres_v, Kokkos::pair<int,int>(iop_file_start,iop_file_end));
         const auto x_tgt  = Kokkos::subview(model_pres_v, Kokkos::pair<int,int>(model_start,model_end));
         const auto input  = Kokkos::subview(iop_file_v, Kokkos::pair<int,int>(iop_file_start,iop_file_end));
@@ -698,11 +730,11 @@ read_iop_file_data (const util::TimeStamp& current_ts)
       // the interpolated region with the value at model_start/model_end
       if (fname == "T"    || fname == "q" || fname == "u" ||
           fname == "u_ls" || fname == "v" || fname == "v_ls") {
-        Kokkos::parallel_for(Kokkos::RangePolicy<>(0, model_start+1),
+        Kokkos::parallel_for("IntensiveObservationPeriod::read_iop_file_data::fill_top", Kokkos::RangePolicy<>(0, model_start+1),
 			     KOKKOS_LAMBDA (const int ilev) {
 			       iop_field_v(ilev) = iop_file_v(0);
 			     });
-        Kokkos::parallel_for(Kokkos::RangePolicy<>(model_end-1, total_nlevs),
+        Kokkos::parallel_for("IntensiveObservationPeriod::read_iop_file_data::fill_bottom", Kokkos::RangePolicy<>(model_end-1, total_nlevs),
 			     KOKKOS_LAMBDA (const int ilev) {
 			       iop_field_v(ilev) = iop_file_v(adjusted_file_levs-1);
 			     });
@@ -717,7 +749,7 @@ read_iop_file_data (const util::TimeStamp& current_ts)
       const auto vertdivT = get_iop_field("vertdivT").get_view<const Real*>();
       const auto divT3d = get_iop_field("divT3d").get_view<Real*>();
       const auto nlevs = get_iop_field("divT3d").get_header().get_identifier().get_layout().dim(0);
-      Kokkos::parallel_for(nlevs, KOKKOS_LAMBDA (const int ilev) {
+      Kokkos::parallel_for("IntensiveObservationPeriod::read_iop_file_data::divT3d", nlevs, KOKKOS_LAMBDA (const int ilev) {
         divT3d(ilev) = divT(ilev) + vertdivT(ilev);
       });
     }
@@ -728,7 +760,7 @@ read_iop_file_data (const util::TimeStamp& current_ts)
       const auto vertdivq = get_iop_field("vertdivq").get_view<const Real*>();
       const auto divq3d = get_iop_field("divq3d").get_view<Real*>();
       const auto nlevs = get_iop_field("divq3d").get_header().get_identifier().get_layout().dim(0);
-      Kokkos::parallel_for(nlevs, KOKKOS_LAMBDA (const int ilev) {
+      Kokkos::parallel_for("IntensiveObservationPeriod::read_iop_file_data::divq3d", nlevs, KOKKOS_LAMBDA (const int ilev) {
         divq3d(ilev) = divq(ilev) + vertdivq(ilev);
       });
     }
@@ -812,7 +844,7 @@ set_fields_from_iop_data(const field_mgr_ptr field_mgr)
   const auto ncols = field_mgr->get_grid()->get_num_local_dofs();
   const auto nlevs = field_mgr->get_grid()->get_num_vertical_levels();
   const auto policy = ESU::get_default_team_policy(ncols, nlevs);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const KT::MemberType& team) {
+  Kokkos::parallel_for("IntensiveObservationPeriod::set_fields_from_iop_data", policy, KOKKOS_LAMBDA(const KT::MemberType& team) {
     const auto icol = team.league_rank();
 
     if (set_ps) {
@@ -854,7 +886,7 @@ correct_temperature_and_water_vapor(const field_mgr_ptr field_mgr)
   int first_valid_idx;
   const auto nlevs = field_mgr->get_grid()->get_num_vertical_levels();
   auto t_iop = get_iop_field("T").get_view<Real*>();
-  Kokkos::parallel_reduce(nlevs, KOKKOS_LAMBDA (const int ilev, int& lmin) {
+  Kokkos::parallel_reduce("IntensiveObservationPeriod::correct_temperature_and_water_vapor::first_valid_level", nlevs, KOKKOS_LAMBDA (const int ilev, int& lmin) {
     if (t_iop(ilev) > 0 && ilev < lmin) lmin = ilev;
   }, Kokkos::Min<int>(first_valid_idx));
 
@@ -869,7 +901,7 @@ correct_temperature_and_water_vapor(const field_mgr_ptr field_mgr)
     auto T_mid = field_mgr->get_field("T_mid").get_view<const Real**>();
     auto qv   = field_mgr->get_field("qv").get_view<const Real**>();
     auto q_iop = get_iop_field("q").get_view<Real*>();
-    Kokkos::parallel_for(Kokkos::RangePolicy<>(0, first_valid_idx), KOKKOS_LAMBDA (const int ilev) {
+    Kokkos::parallel_for("IntensiveObservationPeriod::correct_temperature_and_water_vapor::fill_from_model", Kokkos::RangePolicy<>(0, first_valid_idx), KOKKOS_LAMBDA (const int ilev) {
       t_iop(ilev) = T_mid(0, ilev);
       q_iop(ilev) = qv(0, ilev);
     });
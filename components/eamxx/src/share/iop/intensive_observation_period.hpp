@@ -142,6 +142,9 @@ private:
     // Should be set -1 on ranks not equal to the
     // one above.
     int local_column_index_of_closest_column;
+    // Index of closest lat,lon pair along the
+    // file ncol dimension (same on all ranks).
+    int global_column_index_of_closest_column;
   };
 
   // Struct for storing relevant time information
@@ -191,6 +194,11 @@ private:
 
   std::map<std::string,grid_ptr> m_io_grids;
 
+  // Grids containing only the closest column (owned by
+  // mpi_rank_of_closest_column), used to read only that
+  // column from file.
+  std::map<std::string,grid_ptr> m_io_col_grids;
+
   std::map<std::string, Field> m_iop_fields;
   std::map<std::string, Field> m_helper_fields;
 
@@ -8,6 +8,7 @@
 #include "share/scream_types.hpp"
 
 #include <algorithm>
+#include <type_traits>
 
 namespace {
 
@@ -196,6 +197,54 @@ TEST_CASE ("grid_import_export") {
   if (comm.am_i_root()) {
     printf(" -> Testing scatter routine ... %s\n",ok ? "PASS" : "FAIL");
   }
+
+  // Test persistent plan
+  if (comm.am_i_root()) {
+    printf(" -> Testing import/export plan ...\n");
+  }
+  ok = true;
+  using view_2d = ImportExportPlan<Real>::view_2d<Real>;
+  static_assert(not std::is_copy_constructible<ImportExportPlan<Real>>::value &&
+                not std::is_move_constructible<ImportExportPlan<Real>>::value,
+                "Error! ImportExportPlan owns MPI requests, and must not be copied/moved.\n");
+  const int col_size = 3;
+  const int nldofs_dst = dst_grid->get_num_local_dofs();
+  ImportExportPlan<Real> plan(std::make_shared<GridImportExport>(src_grid,dst_grid),col_size);
+  view_2d src_view("",nldofs_src,col_size), dst_view("",nldofs_dst,col_size);
+  auto src_view_h = Kokkos::create_mirror_view(src_view);
+  auto dst_view_h = Kokkos::create_mirror_view(dst_view);
+
+  // Repeat, to make sure persistent requests can be restarted
+  for (int iter=0; iter<2; ++iter) {
+    for (int i=0; i<nldofs_src; ++i) {
+      for (int k=0; k<col_size; ++k) {
+        src_view_h(i,k) = src_gids[i]*col_size + k + iter;
+      }
+    }
+    Kokkos::deep_copy(src_view,src_view_h);
+    plan.scatter(src_view,dst_view);
+    Kokkos::deep_copy(dst_view_h,dst_view);
+    for (int i=0; i<nldofs_dst; ++i) {
+      for (int k=0; k<col_size; ++k) {
+        CHECK (dst_view_h(i,k)==dst_gids[i]*col_size + k + iter);
+        ok &= catch_capture.lastAssertionPassed();
+      }
+    }
+
+    // Gather sends the scattered values back, so each unique dof
+    // receives its value once per importing overlapped dof
+    plan.gather(dst_view,src_view);
+    Kokkos::deep_copy(src_view_h,src_view);
+    for (int i=0; i<nldofs_src; ++i) {
+      for (int k=0; k<col_size; ++k) {
+        CHECK (src_view_h(i,k)==(src_gids[i]*col_size + k + iter)*num_imp_per_lid[i]);
+        ok &= catch_capture.lastAssertionPassed();
+      }
+    }
+  }
+  if (comm.am_i_root()) {
+    printf(" -> Testing import/export plan ... %s\n",ok ? "PASS" : "FAIL");
+  }
 }
 
 } // anonymous namespace
@@ -0,0 +1,90 @@
+#include <catch2/catch.hpp>
+
+#include "share/util/eamxx_kernel_profiler.hpp"
+#include "share/util/eamxx_metrics.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <fstream>
+#include <typeinfo>
+
+namespace {
+
+using namespace scream;
+
+struct UnnamedFunctor {
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int) const {}
+};
+
+TEST_CASE ("kernel_profiler") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto& kp = KernelProfiler::instance();
+
+  SECTION ("canonical_name") {
+    // Hand-written labels are left alone
+    REQUIRE (KernelProfiler::canonical_name("Field::deep_copy_impl")=="Field::deep_copy_impl");
+    REQUIRE (KernelProfiler::canonical_name("my_kernel")=="my_kernel");
+
+    // Mangled types are demangled, and stripped of template args
+    REQUIRE (KernelProfiler::canonical_name("N6scream3FooIdEE")=="scream::Foo");
+    REQUIRE (KernelProfiler::canonical_name(typeid(UnnamedFunctor).name()).find("UnnamedFunctor")!=std::string::npos);
+
+    // Kokkos internal kernels carry the view name, which we drop
+    REQUIRE (KernelProfiler::canonical_name("Kokkos::View::initialization [T_mid] via memset")==
+             "Kokkos::View::initialization via memset");
+  }
+
+  SECTION ("attribution") {
+    auto& metrics = Metrics::instance();
+    metrics.enable(true);
+    kp.enable(true);
+
+    metrics.start_region("proc");
+    Kokkos::Profiling::pushRegion("proc::run");
+    for (int i=0; i<3; ++i) {
+      Kokkos::parallel_for("my_kernel",Kokkos::RangePolicy<>(0,10),UnnamedFunctor());
+    }
+    int sum = 0;
+    Kokkos::parallel_reduce(Kokkos::RangePolicy<>(0,10),KOKKOS_LAMBDA(const int i, int& s) { s += i; },sum);
+    Kokkos::Profiling::popRegion();
+    metrics.stop_region("proc");
+    REQUIRE (sum==45);
+
+    // Outside of any region
+    Kokkos::parallel_for("my_kernel",Kokkos::RangePolicy<>(0,10),UnnamedFunctor());
+
+    const auto& stats = kp.get_stats();
+    REQUIRE (stats.at("proc::run::my_kernel").num_launches==3);
+    REQUIRE (stats.at("my_kernel").num_launches==1);
+    REQUIRE (stats.size()==3);
+    REQUIRE (metrics.get_counters().at("proc").num_kernels==4);
+
+    // The test runs with different numbers of ranks, possibly at the same time,
+    // so use a different file for each
+    const auto fname = "kernel_profiler_tests_np" + std::to_string(comm.size()) + ".csv";
+    const auto lines = kp.write(comm,fname);
+    if (comm.am_i_root()) {
+      REQUIRE (lines.size()==3);
+      std::ifstream ifs(fname);
+      std::string line;
+      std::getline(ifs,line);
+      REQUIRE (line=="kernel,num_launches,total_time_min,total_time_max,total_time_mean,time_per_launch");
+      int nlines = 0;
+      for (; std::getline(ifs,line); ++nlines) {
+        REQUIRE (line==lines[nlines]);
+      }
+      REQUIRE (nlines==3);
+    }
+
+    // Once disabled, kernels are no longer recorded
+    kp.enable(false);
+    REQUIRE (kp.get_stats().empty());
+    Kokkos::parallel_for("my_kernel",Kokkos::RangePolicy<>(0,10),UnnamedFunctor());
+    REQUIRE (kp.get_stats().empty());
+
+    metrics.enable(false);
+  }
+}
+
+} // anonymous namespace
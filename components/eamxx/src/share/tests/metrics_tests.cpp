@@ -0,0 +1,169 @@
+#include <catch2/catch.hpp>
+
+#include "share/util/eamxx_metrics.hpp"
+#include "share/field/field.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+using namespace scream;
+
+TEST_CASE ("metrics_regions") {
+  auto& metrics = Metrics::instance();
+
+  SECTION ("disabled") {
+    metrics.enable(false);
+    metrics.start_region("a");
+    metrics.add_columns(10);
+    metrics.stop_region("b"); // No check on names if disabled
+    REQUIRE (metrics.get_counters().empty());
+  }
+
+  SECTION ("nested") {
+    metrics.enable(true);
+    for (int i=0; i<2; ++i) {
+      metrics.start_region("outer");
+      metrics.add_columns(1);
+      metrics.start_region("inner");
+      metrics.add_columns(10);
+      metrics.add_kernel_launches(3);
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      metrics.stop_region("inner");
+      metrics.add_h2d_bytes(100);
+      metrics.stop_region("outer");
+    }
+
+    const auto& c = metrics.get_counters();
+    REQUIRE (c.size()==2);
+    const auto& outer = c.at("outer");
+    const auto& inner = c.at("outer/inner");
+
+    // Wall time is inclusive, other counters are not
+    REQUIRE (outer.num_calls==2);
+    REQUIRE (inner.num_calls==2);
+    REQUIRE (inner.wall_time>=0.01);
+    REQUIRE (outer.wall_time>=inner.wall_time);
+    REQUIRE (outer.num_columns==2);
+    REQUIRE (inner.num_columns==20);
+    REQUIRE (outer.num_kernels==0);
+    REQUIRE (inner.num_kernels==6);
+    REQUIRE (outer.h2d_bytes==200);
+    REQUIRE (inner.h2d_bytes==0);
+
+    // Regions must be closed in reverse order
+    metrics.start_region("outer");
+    metrics.start_region("inner");
+    REQUIRE_THROWS (metrics.stop_region("outer"));
+    REQUIRE_THROWS (metrics.reset());
+
+    metrics.enable(false);
+    REQUIRE (not metrics.has_open_regions());
+    REQUIRE (metrics.get_counters().empty());
+  }
+
+  SECTION ("field_allocation") {
+    using namespace ShortFieldTagsNames;
+    metrics.enable(true);
+
+    FieldIdentifier fid ("f",FieldLayout({COL,LEV},{3,7}),ekat::units::Units::nondimensional(),"some_grid");
+    Field f(fid);
+    metrics.start_region("alloc");
+    f.allocate_view();
+    f.sync_to_host();
+    metrics.stop_region("alloc");
+
+    const auto& c = metrics.get_counters().at("alloc");
+    const auto alloc_size = f.get_header().get_alloc_properties().get_alloc_size();
+    REQUIRE (c.device_bytes==alloc_size);
+
+    // Transfers are recorded only if host and device memory spaces differ
+    const bool same_space = f.get_view<Real**>().data()==f.get_view<Real**,Host>().data();
+    REQUIRE (c.d2h_bytes==(same_space ? 0 : alloc_size));
+
+    metrics.enable(false);
+  }
+}
+
+TEST_CASE ("metrics_write") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  const int size = comm.size();
+
+  // The test runs with different numbers of ranks, possibly at the same time,
+  // so use different files for each
+  const auto csv_file  = "metrics_tests_np" + std::to_string(size) + ".csv";
+  const auto json_file = "metrics_tests_np" + std::to_string(size) + ".jsonl";
+  auto& metrics = Metrics::instance();
+  metrics.enable(true);
+
+  // Each rank processes rank+1 columns, and only rank 0 has a "root_only" region
+  auto fill = [&]() {
+    metrics.start_region("proc");
+    metrics.add_columns(comm.rank()+1);
+    metrics.stop_region("proc");
+    if (comm.am_i_root()) {
+      metrics.start_region("root_only");
+      metrics.stop_region("root_only");
+    }
+    metrics.end_step();
+  };
+
+  fill();
+  fill();
+  metrics.write(comm,csv_file,"step_2");
+  REQUIRE (metrics.get_counters().empty());
+  REQUIRE (metrics.num_steps()==0);
+  fill();
+  metrics.write(comm,csv_file,"step_3");
+  fill();
+  metrics.write(comm,json_file,"step_4");
+  fill();
+  metrics.write(comm,json_file,"step_5");
+
+  if (comm.am_i_root()) {
+    // csv: header line, then 7 metrics for 2 regions for each snapshot
+    std::ifstream ifs(csv_file);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(ifs,line); ) {
+      lines.push_back(line);
+    }
+    REQUIRE (lines.size()==1+2*2*7);
+    REQUIRE (lines[0]=="label,num_steps,num_ranks,region,metric,min,max,mean,imbalance");
+
+    const double mean = (size+1)/2.0;
+    std::ostringstream expected;
+    expected << std::setprecision(10);
+    expected << "step_2,2," << size << ",proc,num_columns,"
+             << 2 << "," << 2*size << "," << 2*mean << "," << size/mean;
+    REQUIRE (std::find(lines.begin(),lines.end(),expected.str())!=lines.end());
+
+    // Regions missing on some rank count as zero there
+    expected.str("");
+    expected << "step_3,1," << size << ",root_only,num_calls,"
+             << (size>1 ? 0 : 1) << "," << 1 << "," << 1.0/size << "," << size;
+    REQUIRE (std::find(lines.begin(),lines.end(),expected.str())!=lines.end());
+
+    // JSON Lines: one object per snapshot
+    std::ifstream jfs(json_file);
+    std::vector<std::string> json;
+    for (std::string line; std::getline(jfs,line); ) {
+      json.push_back(line);
+    }
+    REQUIRE (json.size()==2);
+    for (const auto& j : json) {
+      REQUIRE (j.front()=='{');
+      REQUIRE (j.back()=='}');
+      REQUIRE (j.find("\"root_only\"")!=std::string::npos);
+    }
+    REQUIRE (json[0].find("{\"label\": \"step_4\"")==0);
+    REQUIRE (json[1].find("{\"label\": \"step_5\"")==0);
+  }
+
+  metrics.enable(false);
+}
+
+} // anonymous namespace
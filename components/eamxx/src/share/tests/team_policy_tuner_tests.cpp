@@ -0,0 +1,141 @@
+#include <catch2/catch.hpp>
+
+#include "share/util/eamxx_team_policy_tuner.hpp"
+#include "share/scream_types.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <fstream>
+
+namespace {
+
+using namespace scream;
+
+TEST_CASE ("team_policy_tuner") {
+  using ExeSpace = Kokkos::DefaultExecutionSpace;
+  using MemberType = typename Kokkos::TeamPolicy<ExeSpace>::member_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto& tuner = TeamPolicyTuner::instance();
+  tuner.clear();
+
+  SECTION ("candidates") {
+    auto ts_max = [](const int vl) { return 512/vl; };
+    const auto c = TeamPolicyTuner::make_candidates(4,32,32,ts_max);
+
+    // The default comes first, and is not repeated
+    REQUIRE (c[0].team_size==4);
+    REQUIRE (c[0].vector_length==32);
+    for (size_t i=1; i<c.size(); ++i) {
+      REQUIRE (not (c[i].team_size==4 && c[i].vector_length==32));
+      REQUIRE (c[i].vector_length<=32);
+      REQUIRE (c[i].team_size<=ts_max(c[i].vector_length));
+    }
+
+    // Limits of the backend and of the kernel are honored
+    auto small_ts_max = [](const int) { return 8; };
+    for (const auto& cc : TeamPolicyTuner::make_candidates(1,1,8,small_ts_max)) {
+      REQUIRE (cc.vector_length<=8);
+      REQUIRE (cc.team_size<=8);
+    }
+  }
+
+  SECTION ("keys") {
+    REQUIRE (TeamPolicyTuner::league_size_bucket(1)==1);
+    REQUIRE (TeamPolicyTuner::league_size_bucket(5)==8);
+    REQUIRE (TeamPolicyTuner::league_size_bucket(64)==64);
+    REQUIRE (TeamPolicyTuner::make_key("Cuda",64,72,"Compute my diag")=="Cuda 64 72 Compute my diag");
+  }
+
+  SECTION ("tuning") {
+    const int ncols = 13;
+    const int nlevs = 72;
+    Kokkos::View<Real**> x("x",ncols,nlevs);
+    Kokkos::View<Real*>  sum("sum",ncols);
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,ncols*nlevs),KOKKOS_LAMBDA(const int idx) {
+      x(idx/nlevs,idx%nlevs) = idx%nlevs;
+    });
+
+    auto kernel = KOKKOS_LAMBDA (const MemberType& team) {
+      const int icol = team.league_rank();
+      Real s = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team,nlevs),[&](const int k, Real& ls) {
+        ls += x(icol,k);
+      },s);
+      Kokkos::single(Kokkos::PerTeam(team),[&]() { sum(icol) = s; });
+    };
+
+    tuner.enable(true);
+    const auto key = TeamPolicyTuner::make_key(ExeSpace::name(),16,nlevs,"tuned_kernel");
+    for (int n=0; n<100; ++n) {
+      Kokkos::deep_copy(sum,0);
+      tuner.parallel_for<ExeSpace>("tuned_kernel",ncols,nlevs,kernel);
+
+      // Results do not depend on the candidate being tried
+      auto sum_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),sum);
+      for (int i=0; i<ncols; ++i) {
+        REQUIRE (sum_h(i)==nlevs*(nlevs-1)/2);
+      }
+    }
+
+    // On host, the default policy is always used, and nothing is tuned
+    const auto& choices = tuner.get_choices();
+    if (ekat::OnGpu<ExeSpace>::value) {
+      REQUIRE (choices.count(key)==1);
+      REQUIRE (choices.at(key).team_size>=1);
+      REQUIRE (choices.at(key).vector_length>=1);
+    } else {
+      REQUIRE (choices.empty());
+    }
+    tuner.enable(false);
+  }
+
+  SECTION ("database") {
+    // Write a database by hand. The test runs with different numbers of ranks,
+    // possibly at the same time, so use a different file for each
+    const auto fname = "team_policy_tuner_tests_np" + std::to_string(comm.size()) + ".txt";
+    if (comm.am_i_root()) {
+      std::ofstream ofs(fname);
+      ofs << "# backend league_size num_levels team_size vector_length time kernel\n"
+          << "Cuda 64 72 4 32 0.001 Compute my diag\n"
+          << "Cuda 8 72 16 8 0.002 shoc::shoc_grid_disp\n";
+    }
+    comm.barrier();
+
+    tuner.load(fname);
+    const auto& choices = tuner.get_choices();
+    REQUIRE (choices.size()==2);
+    const auto& c = choices.at(TeamPolicyTuner::make_key("Cuda",64,72,"Compute my diag"));
+    REQUIRE (c.team_size==4);
+    REQUIRE (c.vector_length==32);
+    REQUIRE (c.time==0.001);
+
+    // Round trip
+    comm.barrier();
+    tuner.save(comm,fname);
+    comm.barrier();
+    tuner.clear();
+    tuner.load(fname);
+    REQUIRE (tuner.get_choices().size()==2);
+    REQUIRE (tuner.get_choices().at(TeamPolicyTuner::make_key("Cuda",8,72,"shoc::shoc_grid_disp")).team_size==16);
+
+    // A missing file is not an error, a malformed one is
+    tuner.clear();
+    tuner.load("this_file_does_not_exist.txt");
+    REQUIRE (tuner.get_choices().empty());
+
+    comm.barrier();
+    if (comm.am_i_root()) {
+      std::ofstream ofs(fname);
+      ofs << "Cuda 64 72 four 32 0.001 my_kernel\n";
+    }
+    comm.barrier();
+    REQUIRE_THROWS (tuner.load(fname));
+  }
+
+  tuner.clear();
+}
+
+} // anonymous namespace
@@ -5,6 +5,7 @@
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_setup_random_test.hpp"
+#include "share/util/eamxx_precision_cast.hpp"
 #include "share/scream_config.hpp"
 
 TEST_CASE("contiguous_superset") {
@@ -250,3 +251,66 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("fused_cast") {
+  using namespace scream;
+  using KT = KokkosTypes<DefaultDevice>;
+  using dview = KT::view_2d<Real>;
+  using fview = KT::view_2d<SingleReal>;
+
+  // The single precision views are padded to the pack size, the Real ones are not
+  const int ncols = 3;
+  const int nlevs = 7;
+  const int npadded = ((nlevs+SCREAM_PACK_SIZE-1)/SCREAM_PACK_SIZE)*SCREAM_PACK_SIZE;
+  dview a("a",ncols,nlevs), b("b",ncols,nlevs);
+  fview fa("fa",ncols,npadded), fb("fb",ncols,npadded);
+  Kokkos::parallel_for(Kokkos::RangePolicy<>(0,ncols*nlevs),KOKKOS_LAMBDA(const int idx) {
+    const int i = idx / nlevs;
+    const int k = idx % nlevs;
+    a(i,k) = 1.0/(1+idx);
+    b(i,k) = -idx;
+  });
+
+  fused_cast<2>("to_single",
+    Kokkos::Array<KT::view_2d<const Real>,2>{a,b},
+    Kokkos::Array<fview,2>{fa,fb},
+    ncols,nlevs);
+
+  auto fa_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),fa);
+  auto fb_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),fb);
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      const int idx = i*nlevs + k;
+      REQUIRE (fa_h(i,k)==static_cast<SingleReal>(1.0/(1+idx)));
+      REQUIRE (fb_h(i,k)==-idx);
+    }
+    // Padding entries are not touched
+    for (int k=nlevs; k<npadded; ++k) {
+      REQUIRE (fa_h(i,k)==0);
+    }
+  }
+
+  // Back to Real
+  dview a2("a2",ncols,nlevs);
+  fused_cast<1>("to_double",
+    Kokkos::Array<KT::view_2d<const SingleReal>,1>{fa},
+    Kokkos::Array<dview,1>{a2},
+    ncols,nlevs);
+  auto a2_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),a2);
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      REQUIRE (a2_h(i,k)==fa_h(i,k));
+    }
+  }
+
+  // Views whose logical extents differ are an error, rather than being cast
+  // over the common block
+  dview short_cols("short_cols",ncols-1,nlevs), short_levs("short_levs",ncols,nlevs-1);
+  dview too_padded("too_padded",ncols,nlevs+SCREAM_PACK_SIZE);
+  for (const auto& v : {short_cols,short_levs,too_padded}) {
+    REQUIRE_THROWS (fused_cast<1>("bad_extents",
+      Kokkos::Array<KT::view_2d<const SingleReal>,1>{fa},
+      Kokkos::Array<dview,1>{v},
+      ncols,nlevs));
+  }
+}
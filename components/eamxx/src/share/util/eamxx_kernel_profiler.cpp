@@ -0,0 +1,224 @@
+#include "share/util/eamxx_kernel_profiler.hpp"
+#include "share/util/eamxx_metrics.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cxxabi.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+namespace scream {
+
+namespace {
+
+// Kokkos Tools callbacks, forwarding to the singleton
+void push_region_cb (const char* name) {
+  KernelProfiler::instance().push_region(name);
+}
+void pop_region_cb () {
+  KernelProfiler::instance().pop_region();
+}
+void begin_kernel_cb (const char* name, const uint32_t /* dev_id */, uint64_t* kernel_id) {
+  KernelProfiler::instance().begin_kernel(name,kernel_id);
+}
+void end_kernel_cb (const uint64_t kernel_id) {
+  KernelProfiler::instance().end_kernel(kernel_id);
+}
+
+// Remove everything between (and including) the open/close delimiters, accounting for nesting
+std::string strip_enclosed (const std::string& s, const char open, const char close) {
+  std::string out;
+  int depth = 0;
+  for (const char c : s) {
+    if (c==open) {
+      ++depth;
+    } else if (c==close && depth>0) {
+      --depth;
+    } else if (depth==0) {
+      out += c;
+    }
+  }
+  return out;
+}
+
+} // anonymous namespace
+
+KernelProfiler& KernelProfiler::instance () {
+  static KernelProfiler kp;
+  return kp;
+}
+
+void KernelProfiler::enable (const bool on) {
+  namespace KTE = Kokkos::Tools::Experimental;
+  if (on==m_enabled) {
+    return;
+  }
+
+  if (on) {
+    EKAT_REQUIRE_MSG (not Kokkos::Tools::profileLibraryLoaded(),
+        "Error! Cannot enable the EAMxx kernel profiler, since a Kokkos Tools library is already loaded.\n"
+        "  Either unset KOKKOS_TOOLS_LIBS, or disable kernel profiling in EAMxx.\n");
+    KTE::set_push_region_callback(push_region_cb);
+    KTE::set_pop_region_callback(pop_region_cb);
+    KTE::set_begin_parallel_for_callback(begin_kernel_cb);
+    KTE::set_begin_parallel_reduce_callback(begin_kernel_cb);
+    KTE::set_begin_parallel_scan_callback(begin_kernel_cb);
+    KTE::set_end_parallel_for_callback(end_kernel_cb);
+    KTE::set_end_parallel_reduce_callback(end_kernel_cb);
+    KTE::set_end_parallel_scan_callback(end_kernel_cb);
+  } else {
+    KTE::set_push_region_callback(nullptr);
+    KTE::set_pop_region_callback(nullptr);
+    KTE::set_begin_parallel_for_callback(nullptr);
+    KTE::set_begin_parallel_reduce_callback(nullptr);
+    KTE::set_begin_parallel_scan_callback(nullptr);
+    KTE::set_end_parallel_for_callback(nullptr);
+    KTE::set_end_parallel_reduce_callback(nullptr);
+    KTE::set_end_parallel_scan_callback(nullptr);
+
+    m_regions.clear();
+    m_running.clear();
+    m_stats.clear();
+  }
+  m_enabled = on;
+}
+
+void KernelProfiler::pop_region () {
+  // Regions opened before enabling the profiler may be closed after it
+  if (not m_regions.empty()) {
+    m_regions.pop_back();
+  }
+}
+
+void KernelProfiler::begin_kernel (const char* name, uint64_t* kernel_id)
+{
+  auto it = m_canonical_names.find(name);
+  if (it==m_canonical_names.end()) {
+    it = m_canonical_names.emplace(name,canonical_name(name)).first;
+  }
+  const auto key = m_regions.empty() ? it->second : m_regions.back() + "::" + it->second;
+
+  auto& stats = m_stats[key];
+  ++stats.num_launches;
+  Metrics::instance().add_kernel_launches(1);
+
+  *kernel_id = m_next_kernel_id++;
+  m_running[*kernel_id] = {&stats,std::chrono::steady_clock::now()};
+}
+
+void KernelProfiler::end_kernel (const uint64_t kernel_id)
+{
+  auto it = m_running.find(kernel_id);
+  if (it==m_running.end()) {
+    return;
+  }
+  const auto& k = it->second;
+  k.stats->total_time += std::chrono::duration<double>(std::chrono::steady_clock::now()-k.start).count();
+  m_running.erase(it);
+}
+
+std::string KernelProfiler::canonical_name (const std::string& label)
+{
+  // Kokkos labels unnamed kernels with typeid(functor).name(). Only attempt
+  // to demangle strings that cannot be a hand-written label.
+  std::string name = label;
+  if (name.size()>1 && name.find_first_of(" :[") == std::string::npos) {
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name.c_str(),nullptr,nullptr,&status);
+    if (status==0 && demangled!=nullptr) {
+      name = demangled;
+    }
+    std::free(demangled);
+  }
+
+  // Remove anonymous namespaces, template/function arguments, and the
+  // view names that Kokkos appends (in square brackets) to its own kernels
+  for (const std::string anon : {"(anonymous namespace)::", "{anonymous}::"}) {
+    for (auto pos=name.find(anon); pos!=std::string::npos; pos=name.find(anon)) {
+      name.erase(pos,anon.size());
+    }
+  }
+  name = strip_enclosed(name,'<','>');
+  name = strip_enclosed(name,'(',')');
+  name = strip_enclosed(name,'[',']');
+
+  // Collapse whitespace left behind by the removals
+  std::string out;
+  for (const char c : name) {
+    if (c!=' ' || (not out.empty() && out.back()!=' ')) {
+      out += c;
+    }
+  }
+  while (not out.empty() && out.back()==' ') {
+    out.pop_back();
+  }
+  return out.empty() ? label : out;
+}
+
+std::vector<std::string>
+KernelProfiler::write (const ekat::Comm& comm, const std::string& filename)
+{
+  // Some kernels may not have run on all ranks, so gather all the names
+  std::set<std::string> my_kernels;
+  for (const auto& it : m_stats) {
+    my_kernels.insert(it.first);
+  }
+  const auto kernels = all_gather_names(comm,my_kernels);
+
+  // Missing kernels count as zero
+  const int n = kernels.size();
+  std::vector<double> launches(n,0), times(n,0);
+  int i = 0;
+  for (const auto& k : kernels) {
+    auto it = m_stats.find(k);
+    if (it!=m_stats.end()) {
+      launches[i] = it->second.num_launches;
+      times[i] = it->second.total_time;
+    }
+    ++i;
+  }
+  std::vector<double> launches_sum(n), tmin(n), tmax(n), tsum(n);
+  comm.all_reduce(launches.data(),launches_sum.data(),n,MPI_SUM);
+  comm.all_reduce(times.data(),tmin.data(),n,MPI_MIN);
+  comm.all_reduce(times.data(),tmax.data(),n,MPI_MAX);
+  comm.all_reduce(times.data(),tsum.data(),n,MPI_SUM);
+
+  std::vector<std::string> lines;
+  if (not comm.am_i_root()) {
+    return lines;
+  }
+
+  std::vector<int> order(n);
+  for (int j=0; j<n; ++j) {
+    order[j] = j;
+  }
+  std::stable_sort(order.begin(),order.end(),[&](const int a, const int b) {
+    return tmax[a]>tmax[b];
+  });
+
+  const std::vector<std::string> names(kernels.begin(),kernels.end());
+  for (const int j : order) {
+    std::ostringstream oss;
+    oss << std::setprecision(10)
+        << "\"" << names[j] << "\"," << launches_sum[j] << ","
+        << tmin[j] << "," << tmax[j] << "," << tsum[j]/comm.size() << ","
+        << (launches_sum[j]>0 ? tsum[j]/launches_sum[j] : 0.0);
+    lines.push_back(oss.str());
+  }
+
+  std::ofstream ofs(filename);
+  ofs << "kernel,num_launches,total_time_min,total_time_max,total_time_mean,time_per_launch\n";
+  for (const auto& l : lines) {
+    ofs << l << "\n";
+  }
+  return lines;
+}
+
+} // namespace scream
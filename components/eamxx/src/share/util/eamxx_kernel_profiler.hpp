@@ -0,0 +1,85 @@
+#ifndef EAMXX_KERNEL_PROFILER_HPP
+#define EAMXX_KERNEL_PROFILER_HPP
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * Built-in lightweight Kokkos Tools connector
+ *
+ * When enabled, it registers itself with Kokkos Tools, and attributes every
+ * parallel_for/reduce/scan to the innermost Kokkos profiling region open at
+ * launch time. Atm processes open the regions "<proc>::init" and "<proc>::run",
+ * and output streams open "IO::<stream>", so each kernel is identified by a key
+ * of the form "<proc>::<phase>::<kernel label>". Unnamed kernels are labeled
+ * by Kokkos with the (mangled) type of the functor, which we demangle and
+ * strip of template and function arguments.
+ *
+ * Each launch is also counted in the innermost open Metrics region (if any).
+ *
+ * When a Kokkos Tools callback is registered, Kokkos fences before calling the
+ * end-of-kernel callback, so the recorded times are device execution times.
+ * This also means that profiling perturbs asynchronous execution, so it should
+ * not be left on in production runs.
+ *
+ * The connector cannot be enabled if a Kokkos Tools library is already loaded
+ * (e.g., via KOKKOS_TOOLS_LIBS), since it would replace its callbacks.
+ */
+
+struct KernelStats {
+  long long num_launches = 0;
+  double    total_time   = 0; // seconds
+};
+
+class KernelProfiler {
+public:
+  static KernelProfiler& instance ();
+
+  // Register/unregister the Kokkos Tools callbacks. Disabling discards all stats.
+  void enable (const bool on);
+  bool enabled () const { return m_enabled; }
+
+  const std::map<std::string,KernelStats>& get_stats () const { return m_stats; }
+
+  // Aggregate stats across ranks, and write them on root rank in csv format,
+  // sorted by decreasing max (over ranks) total time. Must be called on all
+  // ranks of comm. Returns the (sorted) lines of the table that were written.
+  std::vector<std::string> write (const ekat::Comm& comm, const std::string& filename);
+
+  // Turn a kernel label (possibly a mangled type name) into a readable name
+  static std::string canonical_name (const std::string& label);
+
+  // Kokkos Tools hooks (not meant to be called directly)
+  void push_region (const char* name) { m_regions.emplace_back(name); }
+  void pop_region ();
+  void begin_kernel (const char* name, uint64_t* kernel_id);
+  void end_kernel (const uint64_t kernel_id);
+
+private:
+  KernelProfiler () = default;
+
+  struct RunningKernel {
+    KernelStats*  stats;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  bool                               m_enabled = false;
+  uint64_t                           m_next_kernel_id = 0;
+  std::vector<std::string>           m_regions;
+  std::map<uint64_t,RunningKernel>   m_running;
+  std::map<std::string,KernelStats>  m_stats;
+
+  // Canonical names of the labels seen so far, since demangling is not cheap
+  std::map<std::string,std::string>  m_canonical_names;
+};
+
+} // namespace scream
+
+#endif // EAMXX_KERNEL_PROFILER_HPP
@@ -0,0 +1,181 @@
+#include "share/util/eamxx_metrics.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace scream {
+
+namespace {
+
+constexpr int num_metrics = 7;
+const std::array<std::string,num_metrics> metrics_names = {
+  "wall_time", "num_calls", "num_kernels", "device_bytes", "h2d_bytes", "d2h_bytes", "num_columns"
+};
+
+std::array<double,num_metrics> to_array (const MetricsCounters& c) {
+  return {c.wall_time, double(c.num_calls), double(c.num_kernels), double(c.device_bytes),
+          double(c.h2d_bytes), double(c.d2h_bytes), double(c.num_columns)};
+}
+
+bool ends_with (const std::string& s, const std::string& suffix) {
+  return s.size()>=suffix.size() && s.compare(s.size()-suffix.size(),suffix.size(),suffix)==0;
+}
+
+} // anonymous namespace
+
+std::set<std::string> all_gather_names (const ekat::Comm& comm, const std::set<std::string>& names)
+{
+  std::string my_names;
+  for (const auto& n : names) {
+    my_names += n + "\n";
+  }
+  const int my_len = my_names.size();
+  std::vector<int> lens(comm.size()), offsets(comm.size(),0);
+  MPI_Allgather(&my_len,1,MPI_INT,lens.data(),1,MPI_INT,comm.mpi_comm());
+  for (int pid=1; pid<comm.size(); ++pid) {
+    offsets[pid] = offsets[pid-1] + lens[pid-1];
+  }
+  std::string all_names(offsets.back()+lens.back(),' ');
+  MPI_Allgatherv(my_names.data(),my_len,MPI_CHAR,&all_names[0],lens.data(),offsets.data(),MPI_CHAR,comm.mpi_comm());
+
+  std::set<std::string> all;
+  std::istringstream iss(all_names);
+  for (std::string name; std::getline(iss,name); ) {
+    all.insert(name);
+  }
+  return all;
+}
+
+Metrics& Metrics::instance () {
+  static Metrics m;
+  return m;
+}
+
+void Metrics::enable (const bool on) {
+  if (not on) {
+    m_stack.clear();
+    reset();
+  }
+  m_enabled = on;
+}
+
+void Metrics::start_region (const std::string& name) {
+  if (not m_enabled) {
+    return;
+  }
+
+  const auto path = m_stack.empty() ? name : m_stack.back().path + "/" + name;
+  auto& counters = m_counters[path];
+  ++counters.num_calls;
+  m_stack.push_back({name,path,&counters,std::chrono::steady_clock::now()});
+}
+
+void Metrics::stop_region (const std::string& name) {
+  if (not m_enabled) {
+    return;
+  }
+
+  EKAT_REQUIRE_MSG (not m_stack.empty() && m_stack.back().name==name,
+      "Error! Metrics regions must be stopped in the reverse order they were started.\n"
+      "  - region to stop: " + name + "\n"
+      "  - innermost region: " + (m_stack.empty() ? std::string("none") : m_stack.back().path) + "\n");
+
+  const auto& r = m_stack.back();
+  r.counters->wall_time += std::chrono::duration<double>(std::chrono::steady_clock::now()-r.start).count();
+  m_stack.pop_back();
+}
+
+void Metrics::reset () {
+  EKAT_REQUIRE_MSG (m_stack.empty(),
+      "Error! Cannot reset metrics while a region is open.\n"
+      "  - innermost region: " + m_stack.back().path + "\n");
+  m_counters.clear();
+  m_num_steps = 0;
+}
+
+void Metrics::write (const ekat::Comm& comm, const std::string& filename, const std::string& label)
+{
+  if (not m_enabled) {
+    return;
+  }
+
+  // Some regions may not have been started on all ranks (e.g., if some
+  // rank has no columns), so gather the names of the regions from all ranks
+  std::set<std::string> my_regions;
+  for (const auto& it : m_counters) {
+    my_regions.insert(it.first);
+  }
+  const auto regions = all_gather_names(comm,my_regions);
+
+  // Aggregate all metrics of all regions at once. Missing regions count as zero.
+  const int n = regions.size()*num_metrics;
+  std::vector<double> vals(n,0), vmin(n), vmax(n), vsum(n);
+  int offset = 0;
+  for (const auto& r : regions) {
+    auto it = m_counters.find(r);
+    if (it!=m_counters.end()) {
+      const auto c = to_array(it->second);
+      std::copy(c.begin(),c.end(),vals.begin()+offset);
+    }
+    offset += num_metrics;
+  }
+  comm.all_reduce(vals.data(),vmin.data(),n,MPI_MIN);
+  comm.all_reduce(vals.data(),vmax.data(),n,MPI_MAX);
+  comm.all_reduce(vals.data(),vsum.data(),n,MPI_SUM);
+
+  const int num_steps = m_num_steps;
+  reset();
+
+  if (not comm.am_i_root()) {
+    return;
+  }
+
+  auto mean = [&](const int i) { return vsum[i]/comm.size(); };
+  auto imbalance = [&](const int i) { return vsum[i]>0 ? vmax[i]/mean(i) : 1.0; };
+
+  // Files are truncated at the first write of a run, and appended to afterwards
+  const bool first = m_files.insert(filename).second;
+  std::ostringstream oss;
+  oss << std::setprecision(10);
+  if (ends_with(filename,".csv")) {
+    if (first) {
+      oss << "label,num_steps,num_ranks,region,metric,min,max,mean,imbalance\n";
+    }
+    offset = 0;
+    for (const auto& r : regions) {
+      for (int m=0; m<num_metrics; ++m, ++offset) {
+        oss << label << "," << num_steps << "," << comm.size() << ","
+            << r << "," << metrics_names[m] << ","
+            << vmin[offset] << "," << vmax[offset] << ","
+            << mean(offset) << "," << imbalance(offset) << "\n";
+      }
+    }
+  } else {
+    // JSON Lines: one self-contained json object per snapshot
+    oss << "{\"label\": \"" << label << "\""
+        << ", \"num_steps\": " << num_steps
+        << ", \"num_ranks\": " << comm.size()
+        << ", \"regions\": {";
+    offset = 0;
+    for (const auto& r : regions) {
+      oss << (offset==0 ? "" : ", ") << "\"" << r << "\": {";
+      for (int m=0; m<num_metrics; ++m, ++offset) {
+        oss << (m==0 ? "" : ", ")
+            << "\"" << metrics_names[m] << "\": {"
+            << "\"min\": " << vmin[offset] << ", \"max\": " << vmax[offset]
+            << ", \"mean\": " << mean(offset) << ", \"imbalance\": " << imbalance(offset) << "}";
+      }
+      oss << "}";
+    }
+    oss << "}}\n";
+  }
+  std::ofstream ofs(filename, first ? std::ios::out : std::ios::app);
+  ofs << oss.str();
+}
+
+} // namespace scream
@@ -0,0 +1,105 @@
+#ifndef EAMXX_METRICS_HPP
+#define EAMXX_METRICS_HPP
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * Lightweight hierarchical performance counters
+ *
+ * Counters are organized in regions, which can be nested: each region is
+ * identified by the '/'-separated names of all the regions that were open
+ * when it was started (e.g., "run/physics/shoc"). For each region we record
+ *  - wall time and number of calls, inclusive of nested regions;
+ *  - kernel launches, device bytes allocated, host<->device transfer bytes,
+ *    and number of columns processed. These are attributed to the innermost
+ *    open region only, so that one can tell which region they come from.
+ *
+ * The registry is disabled by default, in which case all methods return
+ * right away. When enabled, counters are accumulated until write is called,
+ * which aggregates them across ranks (min/max/mean over ranks, as well as
+ * the imbalance ratio max/mean), writes them to file, and resets them.
+ * The file format is csv if the file name ends with '.csv', JSON Lines
+ * otherwise (one json object per snapshot, on its own line). Successive
+ * calls to write append a new snapshot to the file.
+ */
+
+struct MetricsCounters {
+  double    wall_time    = 0; // seconds
+  long long num_calls    = 0;
+  long long num_kernels  = 0;
+  long long device_bytes = 0;
+  long long h2d_bytes    = 0;
+  long long d2h_bytes    = 0;
+  long long num_columns  = 0;
+};
+
+class Metrics {
+public:
+  static Metrics& instance ();
+
+  // Disabling the metrics discards all counters and open regions
+  void enable (const bool on);
+  bool enabled () const { return m_enabled; }
+  bool has_open_regions () const { return not m_stack.empty(); }
+
+  void start_region (const std::string& name);
+  void stop_region  (const std::string& name);
+
+  // Attribute counters to the innermost open region (if any)
+  void add_kernel_launches (const long long n) { if (auto c = current()) c->num_kernels  += n; }
+  void add_device_bytes    (const long long n) { if (auto c = current()) c->device_bytes += n; }
+  void add_h2d_bytes       (const long long n) { if (auto c = current()) c->h2d_bytes    += n; }
+  void add_d2h_bytes       (const long long n) { if (auto c = current()) c->d2h_bytes    += n; }
+  void add_columns         (const long long n) { if (auto c = current()) c->num_columns  += n; }
+
+  // Number of time steps covered by the counters since the last write
+  void end_step () { if (m_enabled) ++m_num_steps; }
+  int num_steps () const { return m_num_steps; }
+
+  const std::map<std::string,MetricsCounters>& get_counters () const { return m_counters; }
+
+  // Discard all counters (no region can be open)
+  void reset ();
+
+  // Aggregate counters across ranks, write them on root rank (labeling the
+  // snapshot with the given label), and reset them. Must be called on all
+  // ranks of comm, with no region open.
+  void write (const ekat::Comm& comm, const std::string& filename, const std::string& label);
+
+private:
+  Metrics () = default;
+
+  MetricsCounters* current () const {
+    return m_enabled && not m_stack.empty() ? m_stack.back().counters : nullptr;
+  }
+
+  struct OpenRegion {
+    std::string       name;
+    std::string       path;
+    MetricsCounters*  counters;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  bool                                  m_enabled = false;
+  int                                   m_num_steps = 0;
+  std::map<std::string,MetricsCounters> m_counters;
+  std::vector<OpenRegion>               m_stack;
+
+  // Files already created by write (csv ones with a header line)
+  std::set<std::string>                 m_files;
+};
+
+// Union of the names passed by all ranks of comm. Must be called on all ranks.
+std::set<std::string> all_gather_names (const ekat::Comm& comm, const std::set<std::string>& names);
+
+} // namespace scream
+
+#endif // EAMXX_METRICS_HPP
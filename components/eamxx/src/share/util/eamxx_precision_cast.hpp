@@ -0,0 +1,62 @@
+#ifndef EAMXX_PRECISION_CAST_HPP
+#define EAMXX_PRECISION_CAST_HPP
+
+#include "share/scream_types.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+
+namespace scream {
+
+// Scalar type used by atm processes running with compute_precision=single.
+// Fields are always stored as Real in the field manager, so these processes
+// cast their inputs to SingleReal before computing, and their outputs back
+// to Real afterwards (see fused_cast below).
+using SingleReal = float;
+
+// Cast N rank-2 views into views with a different value type, using one kernel
+// for all of them, so that the cost of the conversion is a single pass over the
+// data. All views must have the same logical extents (num_rows,num_cols), but
+// their second extent may be padded (by less than SCREAM_PACK_SIZE), since fields
+// and buffers may be padded to different pack sizes. Only the logical entries are
+// copied. Both src and dst must be scalar (not packed) views; use ekat::scalarize
+// on packed views.
+template<int N, typename SrcView, typename DstView>
+void fused_cast (const std::string& name,
+                 const Kokkos::Array<SrcView,N>& src,
+                 const Kokkos::Array<DstView,N>& dst,
+                 const int num_rows, const int num_cols)
+{
+  static_assert (SrcView::rank==2 && DstView::rank==2,
+      "Error! fused_cast only supports rank-2 views.\n");
+  using dst_value_t = typename DstView::non_const_value_type;
+  using exe_space_t = typename DstView::execution_space;
+
+  auto check_extents = [&](const int n, const std::string& which, const int e0, const int e1) {
+    EKAT_REQUIRE_MSG (e0==num_rows && e1>=num_cols && e1<num_cols+SCREAM_PACK_SIZE,
+        "Error! Views in fused_cast must have the same logical extents (modulo padding).\n"
+        "  - kernel name: " + name + "\n"
+        "  - view: " + which + "[" + std::to_string(n) + "]\n"
+        "  - view extents: (" + std::to_string(e0) + "," + std::to_string(e1) + ")\n"
+        "  - logical extents: (" + std::to_string(num_rows) + "," + std::to_string(num_cols) + ")\n");
+  };
+  for (int n=0; n<N; ++n) {
+    check_extents(n,"src",src[n].extent(0),src[n].extent(1));
+    check_extents(n,"dst",dst[n].extent(0),dst[n].extent(1));
+  }
+
+  using policy_t = Kokkos::MDRangePolicy<exe_space_t,Kokkos::Rank<2>>;
+  Kokkos::parallel_for(name, policy_t({0,0},{num_rows,num_cols}),
+                       KOKKOS_LAMBDA (const int i, const int j) {
+    for (int n=0; n<N; ++n) {
+      dst[n](i,j) = static_cast<dst_value_t>(src[n](i,j));
+    }
+  });
+}
+
+} // namespace scream
+
+#endif // EAMXX_PRECISION_CAST_HPP
@@ -0,0 +1,190 @@
+#include "share/util/eamxx_team_policy_tuner.hpp"
+#include "share/util/eamxx_metrics.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+namespace scream {
+
+namespace {
+
+// Split a database line (or an entry of save) into key and choice.
+// Returns false on malformed input.
+bool parse_entry (const std::string& line, std::string& key, TeamPolicyChoice& c)
+{
+  std::istringstream iss(line);
+  std::string backend, kernel;
+  int league_size, num_levs;
+  if (not (iss >> backend >> league_size >> num_levs >> c.team_size >> c.vector_length >> c.time)) {
+    return false;
+  }
+  // The kernel name is the rest of the line, and may contain spaces
+  std::getline(iss >> std::ws,kernel);
+  if (kernel.empty() || c.team_size<1 || c.vector_length<1) {
+    return false;
+  }
+  key = TeamPolicyTuner::make_key(backend,league_size,num_levs,kernel);
+  return true;
+}
+
+std::string make_entry (const std::string& key, const TeamPolicyChoice& c)
+{
+  // Keys are "<backend> <league size> <num levels> <kernel>"
+  std::istringstream iss(key);
+  std::string backend, league_size, num_levs, kernel;
+  iss >> backend >> league_size >> num_levs;
+  std::getline(iss >> std::ws,kernel);
+
+  std::ostringstream oss;
+  oss << std::setprecision(6)
+      << backend << " " << league_size << " " << num_levs << " "
+      << c.team_size << " " << c.vector_length << " " << c.time << " " << kernel;
+  return oss.str();
+}
+
+} // anonymous namespace
+
+TeamPolicyTuner& TeamPolicyTuner::instance () {
+  static TeamPolicyTuner tpt;
+  return tpt;
+}
+
+void TeamPolicyTuner::enable (const bool on) {
+  if (not on) {
+    m_tuning.clear();
+  }
+  m_enabled = on;
+}
+
+void TeamPolicyTuner::clear () {
+  m_choices.clear();
+  m_tuning.clear();
+  m_validated.clear();
+}
+
+std::string TeamPolicyTuner::
+make_key (const std::string& backend, const int league_size,
+          const int num_levs, const std::string& kernel)
+{
+  return backend + " " + std::to_string(league_size) + " " + std::to_string(num_levs) + " " + kernel;
+}
+
+int TeamPolicyTuner::league_size_bucket (const int league_size)
+{
+  int bucket = 1;
+  while (bucket<league_size) {
+    bucket *= 2;
+  }
+  return bucket;
+}
+
+void TeamPolicyTuner::load (const std::string& filename)
+{
+  std::ifstream ifs(filename);
+  if (not ifs.good()) {
+    // Nothing tuned yet
+    return;
+  }
+
+  int nline = 0;
+  for (std::string line; std::getline(ifs,line); ) {
+    ++nline;
+    if (line.empty() || line[0]=='#') {
+      continue;
+    }
+    std::string key;
+    TeamPolicyChoice c;
+    EKAT_REQUIRE_MSG (parse_entry(line,key,c),
+        "Error! Malformed line in team policy database.\n"
+        "  - file name: " + filename + "\n"
+        "  - line " + std::to_string(nline) + ": " + line + "\n");
+    m_choices[key] = c;
+    m_validated.erase(key);
+    m_tuning.erase(key);
+  }
+}
+
+void TeamPolicyTuner::save (const ekat::Comm& comm, const std::string& filename) const
+{
+  std::set<std::string> my_entries;
+  for (const auto& it : m_choices) {
+    my_entries.insert(make_entry(it.first,it.second));
+  }
+  const auto entries = all_gather_names(comm,my_entries);
+
+  if (not comm.am_i_root()) {
+    return;
+  }
+
+  std::map<std::string,TeamPolicyChoice> best;
+  for (const auto& e : entries) {
+    std::string key;
+    TeamPolicyChoice c;
+    if (not parse_entry(e,key,c)) {
+      continue;
+    }
+    auto it = best.find(key);
+    if (it==best.end() || c.time<it->second.time) {
+      best[key] = c;
+    }
+  }
+
+  std::ofstream ofs(filename);
+  ofs << "# backend league_size num_levels team_size vector_length time kernel\n";
+  for (const auto& it : best) {
+    ofs << make_entry(it.first,it.second) << "\n";
+  }
+}
+
+std::vector<TeamPolicyChoice> TeamPolicyTuner::
+make_candidates (const int default_team_size, const int default_vector_length,
+                 const int vector_length_max,
+                 const std::function<int(const int)>& team_size_max)
+{
+  std::vector<TeamPolicyChoice> candidates;
+  candidates.push_back({default_team_size,default_vector_length});
+
+  for (const int vl : {1, 8, 32}) {
+    if (vl>vector_length_max) {
+      continue;
+    }
+    const int ts_max = team_size_max(vl);
+    for (const int nthreads : {64, 128, 256}) {
+      const int ts = nthreads / vl;
+      if (ts<1 || ts>ts_max) {
+        continue;
+      }
+      const bool dup = std::any_of(candidates.begin(),candidates.end(),
+          [&](const TeamPolicyChoice& c) { return c.team_size==ts && c.vector_length==vl; });
+      if (not dup) {
+        candidates.push_back({ts,vl});
+      }
+    }
+  }
+  return candidates;
+}
+
+void TeamPolicyTuner::record (const std::string& key, Tuning& t, const double time)
+{
+  auto& c = t.candidates[t.num_launches / num_samples];
+  c.time = (t.num_launches % num_samples)==0 ? time : std::min(c.time,time);
+  ++t.num_launches;
+
+  if (t.num_launches < static_cast<int>(t.candidates.size())*num_samples) {
+    return;
+  }
+
+  // Ties go to the default policy, which comes first
+  const auto best = std::min_element(t.candidates.begin(),t.candidates.end(),
+      [](const TeamPolicyChoice& a, const TeamPolicyChoice& b) { return a.time<b.time; });
+  m_choices[key] = *best;
+  m_validated[key] = true;
+  m_tuning.erase(key);
+}
+
+} // namespace scream
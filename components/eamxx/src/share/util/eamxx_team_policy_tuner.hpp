@@ -0,0 +1,173 @@
+#ifndef EAMXX_TEAM_POLICY_TUNER_HPP
+#define EAMXX_TEAM_POLICY_TUNER_HPP
+
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * Autotuning of team size and vector length for team-policy kernels
+ *
+ * Kernels launched via TeamPolicyTuner::parallel_for, rather than with
+ * ekat::ExeSpaceUtils::get_default_team_policy, get their (team_size, vector_length)
+ * tuned on GPU: the first launches of each kernel cycle through a few candidate
+ * pairs (the default policy being one of them), timing each one, and the fastest
+ * pair is used for all later launches. Choices are stored per
+ * (backend, league size, number of levels, kernel name), where the league size
+ * is rounded up to a power of two, so that kernels running over a varying number
+ * of columns (e.g., only the active ones) are not tuned over and over. Choices
+ * can be saved to (and loaded from) a small text database, so that later runs
+ * do not need to tune again. Each line of the database reads
+ *
+ *   <backend> <league size> <num levels> <team size> <vector length> <time> <kernel name>
+ *
+ * where time is the (min over samples) time of one launch with that choice, in
+ * seconds. When the tuner is disabled, or on host backends, the default policy
+ * is used, so that behavior is unchanged.
+ *
+ * Notes:
+ *  - the kernel must be correct for any team size/vector length. In particular,
+ *    kernels using a WorkspaceManager sized from the default policy must NOT be
+ *    launched via the tuner, since a smaller team allows more concurrent teams
+ *    than the workspace has slots for;
+ *  - reductions within a team may be ordered differently with different team
+ *    sizes, so tuned runs are not BFB with untuned ones (nor with runs using a
+ *    different database);
+ *  - timing a launch requires fencing before and after it, which is only done
+ *    while the kernel is being tuned.
+ */
+
+struct TeamPolicyChoice {
+  int    team_size;
+  int    vector_length;
+  double time = 0; // seconds
+};
+
+class TeamPolicyTuner {
+public:
+  static TeamPolicyTuner& instance ();
+
+  // Number of timed launches for each candidate
+  static constexpr int num_samples = 2;
+
+  // Disabling the tuner discards tunings in progress, but keeps the choices made
+  void enable (const bool on);
+  bool enabled () const { return m_enabled; }
+
+  // Read choices from file (if it exists), overriding current ones with the same key
+  void load (const std::string& filename);
+
+  // Gather the choices of all ranks, and write them (on root rank) to file.
+  // For keys tuned on more than one rank, the fastest choice is kept.
+  // Must be called on all ranks of comm.
+  void save (const ekat::Comm& comm, const std::string& filename) const;
+
+  // Choices made so far (or loaded), by key
+  const std::map<std::string,TeamPolicyChoice>& get_choices () const { return m_choices; }
+
+  // Discard all the choices made so far (or loaded)
+  void clear ();
+
+  static std::string make_key (const std::string& backend, const int league_size,
+                               const int num_levs, const std::string& kernel);
+
+  // Smallest power of two not smaller than league_size
+  static int league_size_bucket (const int league_size);
+
+  // The pairs tried for a kernel: the default one first, followed by a few
+  // others with different total number of threads and vector lengths, which
+  // are within the limits of the backend (team_size_max(vl)) and of the kernel
+  static std::vector<TeamPolicyChoice>
+  make_candidates (const int default_team_size, const int default_vector_length,
+                   const int vector_length_max,
+                   const std::function<int(const int)>& team_size_max);
+
+  // Launch f with a tuned team policy over league_size teams. The number of
+  // levels is what would be passed to get_default_team_policy.
+  template<typename ExeSpace, typename Functor>
+  void parallel_for (const std::string& name, const int league_size,
+                     const int num_levs, const Functor& f);
+
+private:
+  TeamPolicyTuner () = default;
+
+  struct Tuning {
+    std::vector<TeamPolicyChoice> candidates;
+    int num_launches = 0;
+  };
+
+  // Record the time of a tuning launch, and pick the best candidate once all are done
+  void record (const std::string& key, Tuning& t, const double time);
+
+  bool                                    m_enabled = false;
+  std::map<std::string,TeamPolicyChoice>  m_choices;
+  std::map<std::string,Tuning>            m_tuning;
+
+  // Loaded choices are checked against the limits of the kernel at first use
+  std::map<std::string,bool>              m_validated;
+};
+
+template<typename ExeSpace, typename Functor>
+void TeamPolicyTuner::
+parallel_for (const std::string& name, const int league_size,
+              const int num_levs, const Functor& f)
+{
+  using ESU      = ekat::ExeSpaceUtils<ExeSpace>;
+  using policy_t = Kokkos::TeamPolicy<ExeSpace>;
+
+  const auto default_policy = ESU::get_default_team_policy(league_size,num_levs);
+  if (not m_enabled || not ekat::OnGpu<ExeSpace>::value) {
+    Kokkos::parallel_for(name,default_policy,f);
+    return;
+  }
+
+  auto team_size_max = [&](const int vl) {
+    return policy_t(league_size,1,vl).team_size_max(f,Kokkos::ParallelForTag());
+  };
+
+  const auto key = make_key(ExeSpace::name(),league_size_bucket(league_size),num_levs,name);
+  auto it = m_choices.find(key);
+  if (it!=m_choices.end()) {
+    const auto& c = it->second;
+    auto& valid = m_validated[key];
+    if (not valid) {
+      // The choice may come from a database created by a different build
+      valid = c.vector_length<=policy_t::vector_length_max() &&
+              c.team_size<=team_size_max(c.vector_length);
+    }
+    if (valid) {
+      Kokkos::parallel_for(name,policy_t(league_size,c.team_size,c.vector_length),f);
+      return;
+    }
+    m_choices.erase(it);
+    m_validated.erase(key);
+  }
+
+  auto& t = m_tuning[key];
+  if (t.candidates.empty()) {
+    t.candidates = make_candidates(default_policy.team_size(),default_policy.impl_vector_length(),
+                                   policy_t::vector_length_max(),team_size_max);
+  }
+  const auto& c = t.candidates[t.num_launches / num_samples];
+
+  Kokkos::fence();
+  const auto start = std::chrono::steady_clock::now();
+  Kokkos::parallel_for(name,policy_t(league_size,c.team_size,c.vector_length),f);
+  Kokkos::fence();
+  const auto stop = std::chrono::steady_clock::now();
+
+  record(key,t,std::chrono::duration<double>(stop-start).count());
+}
+
+} // namespace scream
+
+#endif // EAMXX_TEAM_POLICY_TUNER_HPP
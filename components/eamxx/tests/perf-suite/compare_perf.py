@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+
+"""
+Compare the json output of the EAMxx perf suite against a baseline json file.
+A process fails the comparison if its throughput (columns per second) dropped
+by more than the given tolerance relative to the baseline.
+"""
+
+import argparse, json, os, sys
+
+###############################################################################
+def parse_command_line(args, description):
+###############################################################################
+    parser = argparse.ArgumentParser(
+        usage="""\n{0} <results> <baseline> [--tol <tol>]
+OR
+{0} --help
+
+\033[1mEXAMPLES:\033[0m
+    \033[1;32m# Fail if any process is more than 10% slower than the baseline \033[0m
+    > {0} perf_suite.json baselines/perf_suite.json --tol 0.1
+""".format(os.path.basename(args[0])),
+        description=description,
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter
+    )
+
+    parser.add_argument("results", help="The json file produced by the perf suite")
+    parser.add_argument("baseline", help="The baseline json file")
+    parser.add_argument("--tol", type=float, default=0.1,
+                        help="Max allowed relative decrease of the columns per second")
+    parser.add_argument("--allow-missing-baseline", action="store_true",
+                        help="Succeed without comparing if the baseline file does not exist")
+
+    return parser.parse_args(args[1:])
+
+###############################################################################
+def load_procs(filename):
+###############################################################################
+    with open(filename, "r") as fd:
+        data = json.load(fd)
+
+    return data, {p["name"] : p for p in data["processes"]}
+
+###############################################################################
+def compare_perf(results, baseline, tol, allow_missing_baseline=False):
+###############################################################################
+    if allow_missing_baseline and not os.path.exists(baseline):
+        print(f"No baseline found at {baseline}, skipping comparison")
+        return True
+
+    res_data, res_procs = load_procs(results)
+    base_data, base_procs = load_procs(baseline)
+
+    for key in ["num_columns", "num_vertical_levels", "num_ranks"]:
+        if res_data[key] != base_data[key]:
+            print(f"WARNING: {key} differs from baseline ({res_data[key]} vs {base_data[key]})")
+
+    success = True
+    print(f"{'process':<16}{'cols/s':>14}{'baseline':>14}{'ratio':>10}")
+    for name, base in base_procs.items():
+        if base["status"] != "ok":
+            continue
+
+        res = res_procs.get(name)
+        if res is None or res["status"] != "ok":
+            print(f"{name:<16}{'FAILED':>14}")
+            success = False
+            continue
+
+        ratio = res["columns_per_second"] / base["columns_per_second"]
+        regressed = ratio < 1 - tol
+        print(f"{name:<16}{res['columns_per_second']:>14.4e}{base['columns_per_second']:>14.4e}{ratio:>10.3f}"
+              + ("  <-- REGRESSION" if regressed else ""))
+        success &= not regressed
+
+    return success
+
+###############################################################################
+def _main_func(description):
+###############################################################################
+    args = parse_command_line(sys.argv, description)
+    sys.exit(0 if compare_perf(args.results, args.baseline, args.tol, args.allow_missing_baseline) else 1)
+
+###############################################################################
+
+if __name__ == "__main__":
+    _main_func(__doc__)
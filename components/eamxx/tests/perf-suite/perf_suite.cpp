@@ -0,0 +1,412 @@
+#include "catch2/catch.hpp"
+
+#include "physics/register_physics.hpp"
+#include "share/atm_process/atmosphere_process.hpp"
+#include "share/atm_process/ATMBufferManager.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <set>
+
+/*
+ * Performance regression suite for atmosphere processes.
+ *
+ * Each process listed in the input yaml file is created through the atm
+ * process factory, on a mesh-free point grid with a configurable number of
+ * columns. All its fields are filled with synthetic (but physically sensible)
+ * initial conditions, so that no input file is needed. We then time the
+ * initialization and N calls to run, and write, for each process, the run
+ * throughput (in columns per second) and an estimate of the bytes moved per
+ * step to a json file. The script compare_perf.py can compare such file
+ * against a stored baseline.
+ *
+ * The problem size can be changed without editing the yaml file via
+ *   --ekat-test-params ifile=<file>,ncols=<N>,nsteps=<N>,ofile=<file>
+ */
+
+namespace scream {
+
+namespace {
+
+// Vertical profiles of one column, from which all synthetic ICs are derived
+struct ColumnProfile {
+  std::vector<Real> p_int, p_mid, dp, T, qv;
+};
+
+ColumnProfile make_profile (const int nlev, const Real ps, const Real Ts)
+{
+  constexpr Real ptop = 200;
+  ColumnProfile prof;
+  prof.p_int.resize(nlev+1);
+  for (int k=0; k<=nlev; ++k) {
+    prof.p_int[k] = ptop + (ps-ptop)*Real(k)/nlev;
+  }
+  for (int k=0; k<nlev; ++k) {
+    const Real p = (prof.p_int[k]+prof.p_int[k+1])/2;
+    // Dry adiabatic-ish lapse rate, capped by an isothermal stratosphere
+    const Real T = std::max(Real(200),Ts*std::pow(p/ps,Real(0.19)));
+    // Tetens formula, with 80% relative humidity
+    const Real es = 611.2*std::exp(17.67*(T-273.15)/(T-29.65));
+    prof.p_mid.push_back(p);
+    prof.dp.push_back(prof.p_int[k+1]-prof.p_int[k]);
+    prof.T.push_back(T);
+    prof.qv.push_back(std::min(Real(0.8*0.622*es/p),Real(0.02)));
+  }
+  return prof;
+}
+
+// Value of a synthetic IC at a given level. Clouds are placed in a low
+// liquid layer and a high ice layer, with some rain below the liquid one.
+Real synthetic_value (const std::string& name, const ColumnProfile& prof, const int k, const int icmp)
+{
+  // Clip k for fields defined at interfaces, other than p_int
+  const int nlev = prof.p_mid.size();
+  const int km = std::min(k,nlev-1);
+  const Real p = prof.p_mid[km];
+  const bool liq_layer = p>7e4 && p<9e4;
+  const bool ice_layer = p>2e4 && p<4e4;
+  const bool rain_layer = p>8.5e4;
+
+  if (name=="p_int")                                    return prof.p_int[k];
+  if (name=="p_mid" || name=="p_dry_mid")               return prof.p_mid[km];
+  if (name=="pseudo_density" || name=="pseudo_density_dry") return prof.dp[km];
+  if (name=="T_mid" || name=="T_prev_micro_step")       return prof.T[km];
+  if (name=="qv" || name=="qv_prev_micro_step")         return prof.qv[km];
+  if (name=="qc")             return liq_layer ? 2e-4 : 0;
+  if (name=="nc")             return liq_layer ? 1e8 : 0;
+  if (name=="cldfrac_liq")    return liq_layer ? 1 : 0;
+  if (name=="cldfrac_tot")    return liq_layer || ice_layer ? 1 : 0;
+  if (name=="qr")             return rain_layer ? 1e-5 : 0;
+  if (name=="nr")             return rain_layer ? 1e4 : 0;
+  if (name=="qi")             return ice_layer ? 5e-5 : 0;
+  if (name=="ni")             return ice_layer ? 1e5 : 0;
+  if (name=="nccn")           return 1e8;
+  if (name=="inv_qc_relvar")  return 1;
+  if (name=="tke")            return 0.1;
+  if (name=="horiz_winds")    return icmp==0 ? 10 : 5;
+  return 0;
+}
+
+// Surface (i.e., 2d) synthetic ICs
+Real synthetic_value_2d (const std::string& name)
+{
+  if (name=="sgh30")          return 100;
+  if (name=="landfrac")       return 0.5;
+  if (name=="surf_sens_flux") return 10;
+  if (name=="surf_evap")      return 1e-5;
+  return 0;
+}
+
+void set_synthetic_ics (const FieldManager& fm, const std::vector<ColumnProfile>& profiles)
+{
+  using namespace ShortFieldTagsNames;
+  for (const auto& it : fm) {
+    auto& f = *it.second;
+    const auto& fid = f.get_header().get_identifier();
+    const auto& fl = fid.get_layout();
+    const auto& name = fid.name();
+    if (f.data_type()!=DataType::RealType || fl.rank()==0 || fl.tag(0)!=COL) {
+      continue;
+    }
+
+    const int ncols = fl.dim(0);
+    switch (fl.rank()) {
+      case 1:
+        f.deep_copy(synthetic_value_2d(name));
+        break;
+      case 2:
+      {
+        auto v = f.get_view<Real**,Host>();
+        const bool vert = fl.tag(1)==LEV || fl.tag(1)==ILEV;
+        for (int icol=0; icol<ncols; ++icol) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            v(icol,j) = vert ? synthetic_value(name,profiles[icol],j,0)
+                             : synthetic_value_2d(name);
+          }
+        }
+        f.sync_to_dev();
+        break;
+      }
+      case 3:
+      {
+        auto v = f.get_view<Real***,Host>();
+        for (int icol=0; icol<ncols; ++icol) {
+          for (int icmp=0; icmp<fl.dim(1); ++icmp) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              v(icol,icmp,k) = synthetic_value(name,profiles[icol],k,icmp);
+            }
+          }
+        }
+        f.sync_to_dev();
+        break;
+      }
+      default:
+        f.deep_copy(Real(0));
+    }
+  }
+}
+
+std::string json_escape (const std::string& s)
+{
+  std::string out;
+  for (char c : s) {
+    switch (c) {
+      case '"':  out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n";  break;
+      case '\t': out += "\\t";  break;
+      default:   out += c;
+    }
+  }
+  return out;
+}
+
+struct ProcPerf {
+  std::string name;
+  std::string error;
+  double init_time     = 0;
+  double run_time      = 0;
+  long long bytes_step = 0;
+};
+
+} // anonymous namespace
+
+TEST_CASE("perf_suite") {
+  using namespace ShortFieldTagsNames;
+  using Clock = std::chrono::steady_clock;
+
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  // Load the suite parameters; sizes can be overridden from the command line
+  auto& session = ekat::TestSession::get();
+  session.params.emplace("ifile","perf_suite.yaml");
+  ekat::ParameterList params("Perf Suite");
+  parse_yaml_file(session.params["ifile"],params);
+
+  auto& suite_params = params.sublist("perf_suite");
+  auto get_int = [&](const std::string& key, const std::string& yaml_key) {
+    return session.params.count(key)>0 ? std::stoi(session.params[key])
+                                       : suite_params.get<int>(yaml_key);
+  };
+  const int ncols  = get_int("ncols","number_of_columns");
+  const int nsteps = get_int("nsteps","number_of_steps");
+  const int nlevs  = suite_params.get<int>("number_of_vertical_levels");
+  const int dt     = suite_params.get<int>("time_step");
+  const auto ofile = session.params.count("ofile")>0 ? session.params["ofile"]
+                                                     : suite_params.get<std::string>("output_file");
+  const auto& procs_names = suite_params.get<std::vector<std::string>>("atm_procs_list");
+
+  register_physics();
+
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+
+  // Max time over all ranks, in seconds
+  auto elapsed = [&](const Clock::time_point& start) {
+    double t = std::chrono::duration<double>(Clock::now()-start).count();
+    double t_max;
+    comm.all_reduce(&t,&t_max,1,MPI_MAX);
+    return t_max;
+  };
+
+  std::vector<ProcPerf> perfs;
+  for (const auto& pname : procs_names) {
+    ProcPerf perf;
+    perf.name = pname;
+    if (comm.am_i_root()) {
+      printf(" -> %s: %d cols x %d levs, %d steps\n",pname.c_str(),ncols,nlevs,nsteps);
+    }
+    try {
+      // Create a point grid named "Physics", which is what physics procs expect
+      ekat::ParameterList gm_params;
+      gm_params.set<std::vector<std::string>>("grids_names",{"Physics"});
+      auto& pl = gm_params.sublist("Physics");
+      pl.set<std::string>("type","point_grid");
+      pl.set<std::vector<std::string>>("aliases",{"Point Grid"});
+      pl.set("number_of_global_columns",ncols);
+      pl.set("number_of_vertical_levels",nlevs);
+      auto gm = create_mesh_free_grids_manager(comm,gm_params);
+      gm->build_grids();
+
+      // Geometry data, with a reference pressure profile and latitudes spanning [-60,60]
+      auto grid = gm->get_grid_nonconst("Physics");
+      const int ncols_loc = grid->get_num_local_dofs();
+      const auto gids = grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+      const auto nondim = ekat::units::Units::nondimensional();
+      const auto ref = make_profile(nlevs,1e5,288);
+      auto lat  = grid->create_geometry_data("lat",grid->get_2d_scalar_layout(),nondim);
+      auto lon  = grid->create_geometry_data("lon",grid->get_2d_scalar_layout(),nondim);
+      auto hyam = grid->create_geometry_data("hyam",FieldLayout({LEV},{nlevs}),nondim);
+      auto hybm = grid->create_geometry_data("hybm",FieldLayout({LEV},{nlevs}),nondim);
+      auto lat_h  = lat.get_view<Real*,Host>();
+      auto hybm_h = hybm.get_view<Real*,Host>();
+      for (int icol=0; icol<ncols_loc; ++icol) {
+        lat_h(icol) = -60 + 120*Real(gids(icol))/std::max(ncols-1,1);
+      }
+      for (int k=0; k<nlevs; ++k) {
+        hybm_h(k) = ref.p_mid[k]/1e5;
+      }
+      lat.sync_to_dev();
+      lon.deep_copy(Real(0));
+      hyam.deep_copy(Real(0));
+      hybm.sync_to_dev();
+
+      // Column profiles are seeded with the global dof id, so that the ICs
+      // do not depend on the number of ranks
+      std::vector<ColumnProfile> profiles;
+      for (int icol=0; icol<ncols_loc; ++icol) {
+        std::mt19937_64 engine(gids(icol));
+        std::uniform_real_distribution<Real> pdf(-1,1);
+        profiles.push_back(make_profile(nlevs,1e5+1e3*pdf(engine),288+5*pdf(engine)));
+      }
+
+      // Create the atm proc
+      auto& proc_params = params.sublist("atmosphere_processes").sublist(pname);
+      auto& apf = AtmosphereProcessFactory::instance();
+      auto proc = apf.create(pname,comm,proc_params);
+      proc->set_grids(gm);
+
+      // Register and set fields/groups, as done by the AD (computed ones go first)
+      auto fm = std::make_shared<FieldManager>(grid);
+      fm->registration_begins();
+      for (const auto& req : proc->get_required_field_requests()) {
+        fm->register_field(req);
+      }
+      for (const auto& req : proc->get_computed_field_requests()) {
+        fm->register_field(req);
+      }
+      for (const auto& req : proc->get_required_group_requests()) {
+        fm->register_group(req);
+      }
+      for (const auto& req : proc->get_computed_group_requests()) {
+        fm->register_group(req);
+      }
+      fm->registration_ends();
+      for (const auto& req : proc->get_computed_field_requests()) {
+        proc->set_computed_field(fm->get_field(req.fid));
+      }
+      for (const auto& req : proc->get_computed_group_requests()) {
+        proc->set_computed_group(fm->get_field_group(req.name));
+      }
+      for (const auto& req : proc->get_required_group_requests()) {
+        proc->set_required_group(fm->get_field_group(req.name).get_const());
+      }
+      for (const auto& req : proc->get_required_field_requests()) {
+        proc->set_required_field(fm->get_field(req.fid).get_const());
+      }
+
+      set_synthetic_ics(*fm,profiles);
+      for (const auto& it : *fm) {
+        it.second->get_header().get_tracking().update_time_stamp(t0);
+      }
+
+      // Estimate the bytes moved in each step as the size of all the inputs
+      // plus the size of all the outputs (updated fields count twice)
+      auto count_bytes = [](const std::list<Field>& fields, const std::list<FieldGroup>& groups) {
+        std::set<std::string> names;
+        long long bytes = 0;
+        auto add = [&](const Field& f) {
+          if (names.insert(f.name()).second) {
+            bytes += f.get_header().get_alloc_properties().get_alloc_size();
+          }
+        };
+        for (const auto& f : fields) {
+          add(f);
+        }
+        for (const auto& g : groups) {
+          for (const auto& it : g.m_fields) {
+            add(*it.second);
+          }
+        }
+        return bytes;
+      };
+      long long bytes = count_bytes(proc->get_fields_in(),proc->get_groups_in())
+                      + count_bytes(proc->get_fields_out(),proc->get_groups_out());
+      comm.all_reduce(&bytes,&perf.bytes_step,1,MPI_SUM);
+
+      // Init
+      ATMBufferManager buffer;
+      buffer.request_bytes(proc->total_buffer_size_in_bytes());
+      buffer.allocate();
+      proc->init_buffers(buffer);
+      proc->init_tendencies_buffer(buffer);
+
+      comm.barrier();
+      auto start = Clock::now();
+      proc->initialize(t0,RunType::Initial);
+      Kokkos::fence();
+      perf.init_time = elapsed(start);
+
+      // Run
+      comm.barrier();
+      start = Clock::now();
+      for (int n=0; n<nsteps; ++n) {
+        proc->run(dt);
+      }
+      Kokkos::fence();
+      perf.run_time = elapsed(start);
+
+      proc->finalize();
+    } catch (std::exception& e) {
+      perf.error = e.what();
+    }
+
+    if (comm.am_i_root()) {
+      if (perf.error.empty()) {
+        printf("    init: %.4f s, run: %.4f s/step, %.3e cols/s\n",
+               perf.init_time,perf.run_time/nsteps,ncols*nsteps/perf.run_time);
+      } else {
+        printf("    FAILED: %s\n",perf.error.c_str());
+      }
+    }
+    perfs.push_back(perf);
+  }
+
+  // Write results to json
+  if (comm.am_i_root()) {
+    std::ofstream ofs(ofile);
+    ofs << "{\n"
+        << "  \"num_ranks\": " << comm.size() << ",\n"
+        << "  \"num_columns\": " << ncols << ",\n"
+        << "  \"num_vertical_levels\": " << nlevs << ",\n"
+        << "  \"num_steps\": " << nsteps << ",\n"
+        << "  \"time_step\": " << dt << ",\n"
+        << "  \"processes\": [";
+    for (size_t i=0; i<perfs.size(); ++i) {
+      const auto& p = perfs[i];
+      ofs << (i==0 ? "\n" : ",\n") << "    {\n"
+          << "      \"name\": \"" << json_escape(p.name) << "\",\n";
+      if (p.error.empty()) {
+        const double cols_per_sec = ncols*nsteps/p.run_time;
+        const double bandwidth = p.bytes_step*nsteps/p.run_time;
+        ofs << "      \"status\": \"ok\",\n"
+            << "      \"init_time_s\": " << p.init_time << ",\n"
+            << "      \"run_time_s\": " << p.run_time << ",\n"
+            << "      \"time_per_step_s\": " << p.run_time/nsteps << ",\n"
+            << "      \"columns_per_second\": " << cols_per_sec << ",\n"
+            << "      \"bytes_per_step\": " << p.bytes_step << ",\n"
+            << "      \"bytes_per_second\": " << bandwidth << "\n";
+      } else {
+        ofs << "      \"status\": \"failed\",\n"
+            << "      \"error\": \"" << json_escape(p.error) << "\"\n";
+      }
+      ofs << "    }";
+    }
+    ofs << "\n  ]\n}\n";
+    printf(" -> Results written to %s\n",ofile.c_str());
+  }
+
+  for (const auto& p : perfs) {
+    CHECK (p.error.empty());
+  }
+}
+
+} // namespace scream
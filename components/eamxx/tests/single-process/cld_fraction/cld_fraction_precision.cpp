@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include "physics/cld_fraction/eamxx_cld_fraction_process_interface.hpp"
+#include "share/atm_process/ATMBufferManager.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include <cmath>
+
+namespace scream {
+
+namespace {
+
+// Create a CldFraction process, with its own fields, and set its inputs
+std::shared_ptr<AtmosphereProcess>
+create_cld_fraction (const ekat::Comm& comm, const std::shared_ptr<GridsManager>& gm,
+                     const std::string& precision, const util::TimeStamp& t0,
+                     ATMBufferManager& buffer)
+{
+  ekat::ParameterList params("cld_fraction");
+  params.set<std::string>("compute_precision",precision);
+  auto proc = std::make_shared<CldFraction>(comm,params);
+  proc->set_grids(gm);
+
+  // Register and set fields, as done by the AD (computed ones go first)
+  auto fm = std::make_shared<FieldManager>(gm->get_grid("Physics"));
+  fm->registration_begins();
+  for (const auto& req : proc->get_required_field_requests()) {
+    fm->register_field(req);
+  }
+  for (const auto& req : proc->get_computed_field_requests()) {
+    fm->register_field(req);
+  }
+  fm->registration_ends();
+  for (const auto& req : proc->get_computed_field_requests()) {
+    proc->set_computed_field(fm->get_field(req.fid));
+  }
+  for (const auto& req : proc->get_required_field_requests()) {
+    proc->set_required_field(fm->get_field(req.fid).get_const());
+  }
+
+  // Inputs are away from the ice cloud thresholds, so that rounding them
+  // to float does not change which side of the threshold they are on
+  auto qi  = fm->get_field("qi");
+  auto liq = fm->get_field("cldfrac_liq");
+  auto qi_h  = qi.get_view<Real**,Host>();
+  auto liq_h = liq.get_view<Real**,Host>();
+  for (int icol=0; icol<qi_h.extent_int(0); ++icol) {
+    for (int k=0; k<qi_h.extent_int(1); ++k) {
+      qi_h(icol,k)  = 1e-4*((icol+3*k)%7)/7;
+      liq_h(icol,k) = std::abs(std::sin(Real(icol+k)));
+    }
+  }
+  qi.sync_to_dev();
+  liq.sync_to_dev();
+  for (const auto& it : *fm) {
+    it.second->get_header().get_tracking().update_time_stamp(t0);
+  }
+
+  buffer.request_bytes(proc->total_buffer_size_in_bytes());
+  buffer.allocate();
+  proc->init_buffers(buffer);
+  proc->init_tendencies_buffer(buffer);
+
+  proc->initialize(t0,RunType::Initial);
+  return proc;
+}
+
+} // anonymous namespace
+
+TEST_CASE("cld_fraction_precision") {
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  // Use a number of levels that is not a multiple of the pack size,
+  // so that fields and single precision buffers have different padding
+  const int ncols = 5;
+  const int nlevs = 13;
+  const double dt = 300;
+
+  ekat::ParameterList gm_params;
+  gm_params.set<std::vector<std::string>>("grids_names",{"Physics"});
+  auto& pl = gm_params.sublist("Physics");
+  pl.set<std::string>("type","point_grid");
+  pl.set<std::vector<std::string>>("aliases",{"Point Grid"});
+  pl.set("number_of_global_columns",ncols);
+  pl.set("number_of_vertical_levels",nlevs);
+  auto gm = create_mesh_free_grids_manager(comm,gm_params);
+  gm->build_grids();
+
+  util::TimeStamp t0 ({2021,10,12},{12,30,0});
+  ATMBufferManager buffer_dp, buffer_sp;
+  auto proc_dp = create_cld_fraction(comm,gm,"double",t0,buffer_dp);
+  auto proc_sp = create_cld_fraction(comm,gm,"single",t0,buffer_sp);
+  proc_dp->run(dt);
+  proc_sp->run(dt);
+
+  // Inputs are only rounded to float, so outputs (in [0,1]) match up to float precision
+  for (const std::string name : {"cldfrac_tot","cldfrac_ice","cldfrac_tot_for_analysis","cldfrac_ice_for_analysis"}) {
+    auto f_dp = proc_dp->get_field_out(name);
+    auto f_sp = proc_sp->get_field_out(name);
+    f_dp.sync_to_host();
+    f_sp.sync_to_host();
+    auto v_dp = f_dp.get_view<const Real**,Host>();
+    auto v_sp = f_sp.get_view<const Real**,Host>();
+    for (int icol=0; icol<v_dp.extent_int(0); ++icol) {
+      for (int k=0; k<nlevs; ++k) {
+        REQUIRE (std::abs(v_sp(icol,k)-v_dp(icol,k))<=1e-6);
+      }
+    }
+  }
+
+  proc_dp->finalize();
+  proc_sp->finalize();
+}
+
+} // namespace scream
@@ -198,7 +198,7 @@ struct ComposeTransportImpl {
 
   template <typename Fn>
   void launch_ie_physlev_ij (Fn& f) const {
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("ComposeTransportImpl::launch_ie_physlev_ij",
       Kokkos::RangePolicy<ExecSpace>(0, m_data.nelemd*np*np*num_phys_lev), f);
   }
 
@@ -209,7 +209,7 @@ struct ComposeTransportImpl {
 
   template <typename Fn>
   void launch_ie_packlev_ij (Fn& f) const {
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("ComposeTransportImpl::launch_ie_packlev_ij",
       Kokkos::RangePolicy<ExecSpace>(0, m_data.nelemd*np*np*num_lev_pack), f);
   }
 
@@ -223,7 +223,7 @@ struct ComposeTransportImpl {
 
   template <int nlev, typename Fn>
   void launch_ie_ij_nlev (Fn& f) const {
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("ComposeTransportImpl::launch_ie_ij_nlev",
       Kokkos::RangePolicy<ExecSpace>(0, m_data.nelemd*np*np*nlev), f);
   }
 
@@ -239,7 +239,7 @@ struct ComposeTransportImpl {
 
   template <int nlev, typename Fn>
   void launch_ie_q_ij_nlev (const int qsize, Fn& f) const {
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("ComposeTransportImpl::launch_ie_q_ij_nlev",
       Kokkos::RangePolicy<ExecSpace>(0, m_data.nelemd*qsize*np*np*nlev), f);
   }
 
@@ -38,7 +38,7 @@ void ComposeTransportImpl::advance_hypervis_scalar (const Real dt_q) {
         sphere_ops.laplace_simple(kv, Qtens_ie, Qtens_ie);
       };
       Kokkos::fence();
-      Kokkos::parallel_for(m_tp_ne_hv_q, f);
+      Kokkos::parallel_for("ComposeTransportImpl::advance_hypervis_scalar::laplace_simple", m_tp_ne_hv_q, f);
     };
     laplace_simple_Qtens();
     m_hv_dss_be[0]->exchange(m_geometry.m_rspheremp);
@@ -54,7 +54,7 @@ void ComposeTransportImpl::advance_hypervis_scalar (const Real dt_q) {
                                   Qtens_ie, Qtens_ie);
       };
       Kokkos::fence();
-      Kokkos::parallel_for(m_tp_ne_hv_q, f);
+      Kokkos::parallel_for("ComposeTransportImpl::advance_hypervis_scalar::laplace_tensor", m_tp_ne_hv_q, f);
     }
     { // Compute Q = Q spheremp - dt nu_q Qtens. N.B. spheremp is already in
       // Qtens from divergence_sphere_wk.
@@ -392,7 +392,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
           Homme::subview(buf1c, kv.team_idx), Homme::subview(buf2a, kv.team_idx),
           dprecon);
       };
-      Kokkos::parallel_for(m_tp_ne, calc_dprecon);
+      Kokkos::parallel_for("ComposeTransportImpl::calc_trajectory::dprecon", m_tp_ne, calc_dprecon);
       Kokkos::fence();
       remap_v(m_dp3d, np1, m_divdp, m_vn0);
       const auto sphere = KOKKOS_LAMBDA (const MT& team) {
@@ -407,7 +407,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
         cti::loop_ijk<num_lev_pack>(kv, f);
       };
       Kokkos::fence();
-      Kokkos::parallel_for(m_tp_ne, sphere);
+      Kokkos::parallel_for("ComposeTransportImpl::calc_trajectory::dprecon_dss_scale", m_tp_ne, sphere);
       Kokkos::fence();
       GPTLstop("compose_3d_levels");
     }
@@ -434,7 +434,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
       };
       cti::loop_ijk<num_lev_pack>(kv, f);
     };
-    Kokkos::parallel_for(m_tp_ne, calc_midpoint_velocity);
+    Kokkos::parallel_for("ComposeTransportImpl::calc_trajectory::midpoint_velocity", m_tp_ne, calc_midpoint_velocity);
   }
   { // DSS velocity.
     Kokkos::fence();
@@ -481,7 +481,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
       };
       cti::loop_ijk<num_lev_pack>(kv, f);
     };
-    Kokkos::parallel_for(m_tp_ne, calc_departure_point);
+    Kokkos::parallel_for("ComposeTransportImpl::calc_trajectory::departure_point", m_tp_ne, calc_departure_point);
     Kokkos::fence();
     GPTLstop("compose_v2x");
   }
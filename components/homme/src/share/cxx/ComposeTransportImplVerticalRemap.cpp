@@ -59,7 +59,7 @@ void ComposeTransportImpl::remap_q (const TimeLevel& tl) {
   };
   const auto policy = Kokkos::RangePolicy<ExecSpace>(0, dp3d.extent_int(0)*NP*NP*NUM_LEV*nq);
   Kokkos::fence();
-  Kokkos::parallel_for(policy, post);
+  Kokkos::parallel_for("ComposeTransportImpl::remap_q", policy, post);
   Kokkos::fence();
   GPTLstop("compose_vertical_remap");
 }
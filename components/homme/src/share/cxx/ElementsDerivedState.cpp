@@ -67,7 +67,7 @@ void ElementsDerivedState::randomize(const int seed, const Real dp3d_min) {
   TeamUtils<ExecSpace> tu(policy);
   const int nslots = tu.get_num_ws_slots();
   ExecViewManaged<Scalar *[NP][NP][NUM_LEV]> delta_eta("",nslots);
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const TeamMember& team) {
+  Kokkos::parallel_for("ElementsDerivedState::randomize", policy, KOKKOS_LAMBDA(const TeamMember& team) {
     KernelVariables kv(team, tu);
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -301,11 +301,11 @@ public:
     m_data.rhs_viss = 3.0;
 
     if(m_data.nu_p > 0){
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNup>(
+    Kokkos::parallel_for("EulerStepFunctorImpl::compute_biharmonic_pre::nu_p", Homme::get_default_team_policy<ExecSpace, BIHPreNup>(
                            m_geometry.num_elems() * m_data.qsize, m_tpref),
                          *this);
     }else{
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNoNup>(
+    Kokkos::parallel_for("EulerStepFunctorImpl::compute_biharmonic_pre::no_nu_p", Homme::get_default_team_policy<ExecSpace, BIHPreNoNup>(
                            m_geometry.num_elems() * m_data.qsize, m_tpref),
                          *this);
 
@@ -320,11 +320,11 @@ public:
     assert(m_data.rhs_multiplier == 2.0);
 
     if(m_data.consthv){
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostConstHV>(
+    Kokkos::parallel_for("EulerStepFunctorImpl::compute_biharmonic_post::const_hv", Homme::get_default_team_policy<ExecSpace, BIHPostConstHV>(
                            m_geometry.num_elems() * m_data.qsize, m_tpref),
                          *this);
     }else{
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostTensorHV>(
+    Kokkos::parallel_for("EulerStepFunctorImpl::compute_biharmonic_post::tensor_hv", Homme::get_default_team_policy<ExecSpace, BIHPostTensorHV>(
                            m_geometry.num_elems() * m_data.qsize, m_tpref),
                          *this);
     }
@@ -417,13 +417,13 @@ public:
 
   void advect_and_limit() {
     profiling_resume();
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("EulerStepFunctorImpl::advect_and_limit::setup",
       Homme::get_default_team_policy<ExecSpace, AALSetupPhase>(
         m_geometry.num_elems(), m_tpref),
       *this);
     Kokkos::fence();
     m_kernel_will_run_limiters = true;
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("EulerStepFunctorImpl::advect_and_limit::tracers",
       //to play with launch bounds
       //Homme::get_default_team_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
       Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
@@ -452,7 +452,7 @@ public:
     assert(m_data.qsize >= 0); // reset() already called
     profiling_resume();
 
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("EulerStepFunctorImpl::precompute_divdp",
         Homme::get_default_team_policy<ExecSpace, PrecomputeDivDp>(
             m_geometry.num_elems(), m_tpref),
         *this);
@@ -483,7 +483,7 @@ public:
     const int qsize = m_data.qsize;
     const auto qdp = m_tracers.qdp;
     const Real rkstage = 3.0;
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("EulerStepFunctorImpl::qdp_time_avg",
       Homme::get_default_team_policy<ExecSpace>(m_geometry.num_elems()*m_data.qsize,
                                                 m_tpref),
       KOKKOS_LAMBDA(const TeamMember& team) {
@@ -513,7 +513,7 @@ public:
     const auto divdp_proj = m_derived_state.m_divdp_proj;
     const auto rhsmdt = c.rhs_multiplier * c.dt;
     const auto buf = m_buffers.dp;
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("EulerStepFunctorImpl::compute_dp",
       Homme::get_default_team_policy<ExecSpace>(m_geometry.num_elems(), m_tpref),
       KOKKOS_LAMBDA (const TeamMember& team) {
         KernelVariables kv(team); // no team-idx used, so no need for TU
@@ -545,7 +545,7 @@ public:
     const auto dp = m_buffers.dp;
     const auto qtens_biharmonic = m_tracers.qtens_biharmonic;
     const auto qlim = m_tracers.qlim;
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("EulerStepFunctorImpl::compute_qmin_qmax",
       m_tv_policy,
       KOKKOS_LAMBDA (const TeamMember& team) {
         KernelVariables kv(team, qsize); // no team-idx used, so no need for TU
@@ -225,12 +225,12 @@ void HybridVCoord::compute_eta ()
   const auto p0 = PhysicalConstants::p0;
   const auto kappa = PhysicalConstants::kappa;
 
-  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0,NUM_LEV),
+  Kokkos::parallel_for("HybridVCoord::compute_eta::mid", Kokkos::RangePolicy<ExecSpace>(0,NUM_LEV),
                        KOKKOS_LAMBDA(const int& ilev){
     l_etam(ilev) = l_hybrid_am(ilev) + l_hybrid_bm(ilev);
     l_exner0(ilev) = pow(l_etam(ilev)*l_ps0/p0,kappa);
   });
-  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0,NUM_INTERFACE_LEV),
+  Kokkos::parallel_for("HybridVCoord::compute_eta::int", Kokkos::RangePolicy<ExecSpace>(0,NUM_INTERFACE_LEV),
                        KOKKOS_LAMBDA(const int& ilev){
     l_etai(ilev) = l_hybrid_ai(ilev) + l_hybrid_bi(ilev);
   });
@@ -483,7 +483,7 @@ struct RemapFunctor : public Remapper {
     }
 
     auto update_dp_policy = Kokkos::RangePolicy<ExecSpace,UpdateThicknessTag>(0,m_state.num_elems()*NP*NP*NUM_LEV);
-    Kokkos::parallel_for(update_dp_policy, *this);
+    Kokkos::parallel_for("RemapFunctor::run_remap", update_dp_policy, *this);
   }
 
   void remap1 (
@@ -502,14 +502,14 @@ struct RemapFunctor : public Remapper {
       remap.compute_grids_phase(kv, Homme::subview(dp_src, kv.ie, np1),
                                 Homme::subview(dp_tgt, kv.ie));
     };
-    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne), g);
+    Kokkos::parallel_for("RemapFunctor::remap1::compute_grids", get_default_team_policy<ExecSpace>(ne), g);
     const auto tu_ne_ntr = m_tu_ne_ntr;
     const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
       KernelVariables kv(team, nv, tu_ne_ntr);
       remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, kv.iq, ALL(), ALL(), ALL()));
     };
     Kokkos::fence();
-    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nv), r);
+    Kokkos::parallel_for("RemapFunctor::remap1::compute_remap", get_default_team_policy<ExecSpace>(ne*nv), r);
   }
 
   void remap1 (
@@ -528,14 +528,14 @@ struct RemapFunctor : public Remapper {
       remap.compute_grids_phase(kv, Homme::subview(dp_src, kv.ie),
                                 Homme::subview(dp_tgt, kv.ie, np1));
     };
-    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne), g);
+    Kokkos::parallel_for("RemapFunctor::remap1::compute_grids_tl", get_default_team_policy<ExecSpace>(ne), g);
     const auto tu_ne_ntr = m_tu_ne_ntr;
     const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
       KernelVariables kv(team, nv, tu_ne_ntr);
       remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, n_v, kv.iq, ALL(), ALL(), ALL()));
     };
     Kokkos::fence();
-    Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nv), r);
+    Kokkos::parallel_for("RemapFunctor::remap1::compute_remap_tl", get_default_team_policy<ExecSpace>(ne*nv), r);
   }
 
   int requested_buffer_size () const override {
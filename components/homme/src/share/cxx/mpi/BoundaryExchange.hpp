@@ -334,7 +334,7 @@ void BoundaryExchange::register_field (ExecView<Real*[NP][NP], Properties...> fi
   {
     auto l_num_2d_fields = m_num_2d_fields;
     auto l_2d_fields = m_2d_fields;
-    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, m_connectivity->get_num_local_elements()),
+    Kokkos::parallel_for("BoundaryExchange::register_field::2d", Kokkos::RangePolicy<ExecSpace>(0, m_connectivity->get_num_local_elements()),
                          KOKKOS_LAMBDA(const int ie){
       l_2d_fields(ie, l_num_2d_fields) = Kokkos::subview(field, ie, ALL, ALL);
     });
@@ -358,7 +358,7 @@ void BoundaryExchange::register_field (ExecView<Real*[DIM][NP][NP], Properties..
   {
     auto l_num_2d_fields = m_num_2d_fields;
     auto l_2d_fields = m_2d_fields;
-    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+    Kokkos::parallel_for("BoundaryExchange::register_field::2d_dim", MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int idim){
         l_2d_fields(ie, l_num_2d_fields+idim) = Kokkos::subview(field, ie, start_dim+idim, ALL, ALL);
     });
@@ -382,7 +382,7 @@ void BoundaryExchange::register_field (ExecView<Real**[NP][NP], Properties...> f
   {
     auto l_num_2d_fields = m_num_2d_fields;
     auto l_2d_fields = m_2d_fields;
-    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+    Kokkos::parallel_for("BoundaryExchange::register_field::2d_multi", MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int idim){
         l_2d_fields(ie, l_num_2d_fields+idim) = Kokkos::subview(field, ie, start_dim+idim, ALL, ALL);
     });
@@ -407,7 +407,7 @@ void BoundaryExchange::register_field (ExecView<Real***[NP][NP], Properties...>
   {
     auto l_num_2d_fields = m_num_2d_fields;
     auto l_2d_fields = m_2d_fields;
-    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+    Kokkos::parallel_for("BoundaryExchange::register_field::2d_outer", MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int idim){
         l_2d_fields(ie, l_num_2d_fields+idim) = Kokkos::subview(field, ie, idim_out, start_dim+idim, ALL, ALL);
     });
@@ -433,7 +433,7 @@ void BoundaryExchange::register_field (ExecView<Scalar*[OUTER_DIM][DIM][NP][NP][
   {
     auto l_num_3d_fields = m_num_3d_fields;
     auto l_3d_fields = m_3d_fields;
-    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+    Kokkos::parallel_for("BoundaryExchange::register_field::3d_outer_dim", MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int idim){
         l_3d_fields(ie, l_num_3d_fields+idim) = Kokkos::subview(field, ie, outer_dim, start_dim+idim, ALL, ALL, ALL);
     });
@@ -458,7 +458,7 @@ void BoundaryExchange::register_field (ExecView<Scalar***[NP][NP][NUM_LEV], Prop
   {
     auto l_num_3d_fields = m_num_3d_fields;
     auto l_3d_fields = m_3d_fields;
-    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+    Kokkos::parallel_for("BoundaryExchange::register_field::3d_outer", MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int idim){
         l_3d_fields(ie, l_num_3d_fields+idim) = Kokkos::subview(field, ie, outer_dim, start_dim+idim, ALL, ALL, ALL);
     });
@@ -485,7 +485,7 @@ void BoundaryExchange::register_field_impl (
   {
     auto l_num_3d_fields = m_num_3d_fields;
     auto l_3d_fields = m_3d_fields;
-    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, m_connectivity->get_num_local_elements()),
+    Kokkos::parallel_for("BoundaryExchange::register_field_impl::3d_mid", Kokkos::RangePolicy<ExecSpace>(0, m_connectivity->get_num_local_elements()),
                          KOKKOS_LAMBDA(const int ie){
       l_3d_fields(ie, l_num_3d_fields) = Kokkos::subview(field, ie, ALL, ALL, ALL);
     });
@@ -516,7 +516,7 @@ void BoundaryExchange::register_field_impl (
   {
     auto l_num_3d_int_fields = m_num_3d_int_fields;
     auto l_3d_int_fields = m_3d_int_fields;
-    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, m_connectivity->get_num_local_elements()),
+    Kokkos::parallel_for("BoundaryExchange::register_field_impl::3d_int", Kokkos::RangePolicy<ExecSpace>(0, m_connectivity->get_num_local_elements()),
                          KOKKOS_LAMBDA(const int ie){
       l_3d_int_fields(ie, l_num_3d_int_fields) = Kokkos::subview(field, ie, ALL, ALL, ALL);
     });
@@ -563,7 +563,7 @@ void BoundaryExchange::register_field_impl (
     f.start_dim = start_dim;
     f.fields = m_3d_fields;
     f.field = field;
-    Kokkos::parallel_for(
+    Kokkos::parallel_for("BoundaryExchange::register_field_impl::3d_multi_mid",
       Kokkos::RangePolicy<ExecSpace>(0, m_connectivity->get_num_local_elements()*num_dims),
       f);
   }
@@ -595,7 +595,7 @@ void BoundaryExchange::register_field_impl (
   {
     auto l_num_3d_int_fields = m_num_3d_int_fields;
     auto l_3d_int_fields = m_3d_int_fields;
-    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+    Kokkos::parallel_for("BoundaryExchange::register_field_impl::3d_multi_int", MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int idim){
       l_3d_int_fields(ie, l_num_3d_int_fields) = Kokkos::subview(field, ie, start_dim+idim, ALL, ALL, ALL);
     });
@@ -618,7 +618,7 @@ void BoundaryExchange::register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV
   {
     auto l_num_1d_fields = m_num_1d_fields;
     auto l_1d_fields     = m_1d_fields;
-    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+    Kokkos::parallel_for("BoundaryExchange::register_min_max_fields", MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
                          KOKKOS_LAMBDA(const int ie, const int idim){
       l_1d_fields(ie, l_num_1d_fields+idim) = Kokkos::subview(field_min_max, ie, start_dim+idim, ALL, ALL);
     });
@@ -42,7 +42,7 @@ void initialize_dp3d_from_ps_c () {
   {
     const auto dp3d = elements.m_state.m_dp3d;
     const auto tln0 = tl.n0;
-    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace> (0,elements.num_elems()*NP*NP*NUM_LEV),
+    Kokkos::parallel_for("Homme::initialize_dp3d_from_ps_c", Kokkos::RangePolicy<ExecSpace> (0,elements.num_elems()*NP*NP*NUM_LEV),
                          KOKKOS_LAMBDA(const int idx) {
       const int ie   = ((idx / NUM_LEV) / NP) / NP;
       const int igp  = ((idx / NUM_LEV) / NP) % NP;
@@ -208,7 +208,7 @@ void update_q (const int np1_qdp, const int np1)
   // Update the device copy of Q, stored in Tracers
   const int num_elems = elements.num_elems();
   const int qsize = params.qsize;
-  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0,num_elems*qsize*NP*NP*NUM_LEV),
+  Kokkos::parallel_for("Homme::update_q", Kokkos::RangePolicy<ExecSpace>(0,num_elems*qsize*NP*NP*NUM_LEV),
                        KOKKOS_LAMBDA(const int idx) {
     const int ie    =  idx / (qsize*NP*NP*NUM_LEV);
     const int iq    = (idx / (NP*NP*NUM_LEV)) % qsize;
@@ -39,7 +39,7 @@ static void set_tracer_transport_derived_values (
     const auto vstar = elements.m_derived.m_vstar;
     const auto v = elements.m_state.m_v;
     const auto n0 = tl.n0;
-    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace> (0,elements.num_elems()*NP*NP*NUM_LEV),
+    Kokkos::parallel_for("Homme::set_tracer_transport_derived_values", Kokkos::RangePolicy<ExecSpace> (0,elements.num_elems()*NP*NP*NUM_LEV),
                          KOKKOS_LAMBDA(const int idx) {
       const int ie   = ((idx / NUM_LEV) / NP) / NP;
       const int igp  = ((idx / NUM_LEV) / NP) % NP;
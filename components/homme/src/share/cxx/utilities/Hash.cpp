@@ -11,7 +11,7 @@ namespace Homme {
 void hash (const int tl, const ExecViewManaged<Scalar******>& v, int n5,
            HashType& accum_out) {
   HashType accum;
-  Kokkos::parallel_reduce(
+  Kokkos::parallel_reduce("Homme::hash::rank6_tl",
     MDRangePolicy<ExecSpace, 6>(
       {0, tl, 0, 0, 0, 0},
       {v.extent_int(0), tl+1, v.extent_int(2), v.extent_int(3), v.extent_int(4), n5}),
@@ -25,7 +25,7 @@ void hash (const int tl, const ExecViewManaged<Scalar******>& v, int n5,
 void hash (const int tl, const ExecViewManaged<Scalar*****>& v, int n4,
            HashType& accum_out) {
   HashType accum;
-  Kokkos::parallel_reduce(
+  Kokkos::parallel_reduce("Homme::hash::rank5_tl",
     MDRangePolicy<ExecSpace, 5>(
       {0, tl, 0, 0, 0},
       {v.extent_int(0), tl+1, v.extent_int(2), v.extent_int(3), n4}),
@@ -39,7 +39,7 @@ void hash (const int tl, const ExecViewManaged<Scalar*****>& v, int n4,
 void hash (const ExecViewManaged<Scalar*****>& v, int n4,
            HashType& accum_out) {
   HashType accum;
-  Kokkos::parallel_reduce(
+  Kokkos::parallel_reduce("Homme::hash::rank5",
     MDRangePolicy<ExecSpace, 5>(
       {0, 0, 0, 0, 0},
       {v.extent_int(0), v.extent_int(1), v.extent_int(2), v.extent_int(3), n4}),
@@ -53,7 +53,7 @@ void hash (const ExecViewManaged<Scalar*****>& v, int n4,
 void hash (const int tl, const ExecViewManaged<Real****>& v,
            HashType& accum_out) {
   HashType accum;
-  Kokkos::parallel_reduce(
+  Kokkos::parallel_reduce("Homme::hash::rank4_tl",
     MDRangePolicy<ExecSpace, 4>(
       {0, tl, 0, 0},
       {v.extent_int(0), tl+1, v.extent_int(2), v.extent_int(3)}),
@@ -84,6 +84,13 @@ std::vector<int> indexToCellIDData;
 int numBoundaryEdges;
 double radius;
 
+// State of the mask entries that determine the FE mesh at the last call of
+// velocity_solver_compute_2d_grid, used to detect if the mesh needs an update
+std::vector<char> femMeshMaskState;
+
+// Ranks of comm owning FE triangles, when reducedComm was created
+std::vector<int> reducedCommActiveRanks;
+
 exchangeList_Type const *sendCellsList_F = 0, *recvCellsList_F = 0;
 exchangeList_Type const *sendEdgesList_F = 0, *recvEdgesList_F = 0;
 exchangeList_Type const *sendVerticesList_F = 0, *recvVerticesList_F = 0;
@@ -94,7 +101,29 @@ exchange::exchange(int _procID, int const* vec_first, int const* vec_last,
     int fieldDim) :
     procID(_procID), vec(vec_first, vec_last), buffer(
         fieldDim * (vec_last - vec_first)), doubleBuffer(
-        fieldDim * (vec_last - vec_first)) {
+        fieldDim * (vec_last - vec_first)), persistentReqID(MPI_REQUEST_NULL),
+        persistentBuffer(0), persistentCount(0), persistentType(MPI_DATATYPE_NULL) {
+}
+
+exchange::exchange(const exchange& src) :
+    procID(src.procID), vec(src.vec), buffer(src.buffer), doubleBuffer(
+        src.doubleBuffer), persistentReqID(MPI_REQUEST_NULL),
+        persistentBuffer(0), persistentCount(0), persistentType(MPI_DATATYPE_NULL) {
+}
+
+exchange::~exchange() {
+  freePersistentRequest();
+}
+
+void exchange::freePersistentRequest() const {
+  if (persistentReqID == MPI_REQUEST_NULL)
+    return;
+  // Lists stored in global variables may be destroyed after MPI is finalized
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (!finalized)
+    MPI_Request_free(&persistentReqID);
+  persistentReqID = MPI_REQUEST_NULL;
 }
 
 extern "C" {
@@ -157,6 +186,9 @@ void velocity_solver_set_grid_data(int const* _nCells_F, int const* _nEdges_F,
   nEdges_F = *_nEdges_F;
   nVertices_F = *_nVertices_F;
   nLayers = *_nLevels-1;
+
+  // New grid data, so the FE mesh must be recomputed
+  femMeshMaskState.clear();
   nCellsSolve_F = *_nCellsSolve_F;
   nEdgesSolve_F = *_nEdgesSolve_F;
   nVerticesSolve_F = *_nVerticesSolve_F;
@@ -339,6 +371,10 @@ void velocity_solver_finalize() {
   delete recvEdgesList_F;
   delete sendVerticesList_F;
   delete recvVerticesList_F;
+  sendVerticesListReversed.clear();
+  recvVerticesListReversed.clear();
+  sendCellsListReversed.clear();
+  recvCellsListReversed.clear();
 }
 
 /*duality:
@@ -358,6 +394,13 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   verticesMask_F = _verticesMask_F;
   dirichletCellsMask_F = _dirichletCellsMask_F;
 
+  // If the masks did not change on any processor, the current FE mesh is still valid
+  if (!updateFEMeshMaskState()) {
+    if (!isDomainEmpty)
+      velocity_solver_compute_2d_grid__(reducedComm);
+    return;
+  }
+
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
   std::vector<int> partialOffset(numProcs + 1), globalOffsetTriangles(
@@ -1009,12 +1052,11 @@ void mapVerticesToCells(const std::vector<double>& velocityOnVertices,
     }
   }
 
-  for (int dim = 0; dim < fieldDim; dim++) {
-    allToAll(&velocityOnCells[dim * nCells_F * (numLayers + 1)],
-        &sendCellsListReversed, &recvCellsListReversed, (numLayers + 1));
-    allToAll(&velocityOnCells[dim * nCells_F * (numLayers + 1)],
-        sendCellsList_F, recvCellsList_F, (numLayers + 1));
-  }
+  // Exchange all components at once
+  allToAll(velocityOnCells, &sendCellsListReversed, &recvCellsListReversed,
+      (numLayers + 1), fieldDim, nCells_F * (numLayers + 1));
+  allToAll(velocityOnCells, sendCellsList_F, recvCellsList_F,
+      (numLayers + 1), fieldDim, nCells_F * (numLayers + 1));
 }
 
 
@@ -1361,10 +1403,26 @@ void exportBeta(double * beta_F) {
   allToAll (beta_F,  sendCellsList_F, recvCellsList_F, 1);
 }
 
+bool updateFEMeshMaskState() {
+  // The FE mesh only depends on the dynamic ice bit of vertices and cells masks,
+  // and on which entries of the dirichlet mask are nonzero
+  std::vector<char> state(nVertices_F + nCells_F * (nLayers + 2));
+  int k = 0;
+  for (int i = 0; i < nVertices_F; i++)
+    state[k++] = (verticesMask_F[i] & dynamic_ice_bit_value) != 0;
+  for (int i = 0; i < nCells_F; i++)
+    state[k++] = (cellsMask_F[i] & dynamic_ice_bit_value) != 0;
+  for (int i = 0; i < nCells_F * (nLayers + 1); i++)
+    state[k++] = dirichletCellsMask_F[i] != 0;
+
+  int changed = (state != femMeshMaskState);
+  MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_INT, MPI_MAX, comm);
+  femMeshMaskState.swap(state);
+  return changed != 0;
+}
+
 void createReducedMPI(int nLocalEntities, MPI_Comm& reduced_comm_id) {
   int numProcs, me;
-  if (reduced_comm_id != MPI_COMM_NULL)
-    MPI_Comm_free(&reduced_comm_id);
   MPI_Group world_group_id, reduced_group_id;
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
@@ -1372,14 +1430,22 @@ void createReducedMPI(int nLocalEntities, MPI_Comm& reduced_comm_id) {
   int nonEmpty = int(nLocalEntities > 0);
   MPI_Allgather(&nonEmpty, 1, MPI_INT, &haveElements[0], 1, MPI_INT, comm);
   std::vector<int> ranks;
-  reduced_ranks.assign(numProcs,-1);
   for (int i = 0; i < numProcs; i++) {
-    if (haveElements[i]) {
-      reduced_ranks[i] = ranks.size();
+    if (haveElements[i])
       ranks.push_back(i);
-    }
   }
 
+  // If the ranks owning elements did not change, we can keep the communicator
+  if (!reducedCommActiveRanks.empty() && ranks == reducedCommActiveRanks)
+    return;
+
+  if (reduced_comm_id != MPI_COMM_NULL)
+    MPI_Comm_free(&reduced_comm_id);
+  reduced_ranks.assign(numProcs,-1);
+  for (int i = 0; i < int(ranks.size()); i++)
+    reduced_ranks[ranks[i]] = i;
+  reducedCommActiveRanks = ranks;
+
   MPI_Comm_group(comm, &world_group_id);
   MPI_Group_incl(world_group_id, ranks.size(), &ranks[0], &reduced_group_id);
   MPI_Comm_create(comm, reduced_group_id, &reduced_comm_id);
@@ -1484,87 +1550,128 @@ void allToAll(std::vector<int>& field, int const * sendArray,
   }
 }
 
-void allToAll(std::vector<int>& field, exchangeList_Type const * sendList,
-    exchangeList_Type const * recvList, int fieldDim) {
-  int me;
-  MPI_Comm_rank(comm, &me);
-
-  for (int iComp = 0; iComp < fieldDim; iComp++) {
-    exchangeList_Type::const_iterator it;
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Irecv(&(it->buffer[0]), it->buffer.size(), MPI_INT, it->procID,
-          it->procID, comm, &it->reqID);
-    }
-
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      for (ID i = 0; i < it->vec.size(); i++)
-        it->buffer[i] = field[fieldDim * it->vec[i] + iComp];
-
-      MPI_Isend(&(it->buffer[0]), it->buffer.size(), MPI_INT, it->procID, me,
-          comm, &it->reqID);
-    }
+namespace {
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+template <typename T>
+std::vector<T>& exchangeBuffer(const exchange& ex);
+template <>
+std::vector<int>& exchangeBuffer<int>(const exchange& ex) {
+  return ex.buffer;
+}
+template <>
+std::vector<double>& exchangeBuffer<double>(const exchange& ex) {
+  return ex.doubleBuffer;
+}
 
-      for (int i = 0; i < int(it->vec.size()); i++)
-        field[fieldDim * it->vec[i] + iComp] = it->buffer[i];
-    }
+template <typename T>
+MPI_Datatype mpiType();
+template <>
+MPI_Datatype mpiType<int>() {
+  return MPI_INT;
+}
+template <>
+MPI_Datatype mpiType<double>() {
+  return MPI_DOUBLE;
+}
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-    }
+// Returns the persistent request of the exchange for a message of the given
+// size, (re)creating it only if the buffer or the message changed.
+template <typename T>
+MPI_Request getPersistentRequest(const exchange& ex, bool isSend, int count,
+    int tag) {
+  std::vector<T>& buffer = exchangeBuffer<T>(ex);
+  if (int(buffer.size()) < count)
+    buffer.resize(count);
+
+  void* ptr = &buffer[0];
+  if (ex.persistentReqID == MPI_REQUEST_NULL || ex.persistentBuffer != ptr
+      || ex.persistentCount != count || ex.persistentType != mpiType<T>()) {
+    ex.freePersistentRequest();
+    if (isSend)
+      MPI_Send_init(ptr, count, mpiType<T>(), ex.procID, tag, comm,
+          &ex.persistentReqID);
+    else
+      MPI_Recv_init(ptr, count, mpiType<T>(), ex.procID, tag, comm,
+          &ex.persistentReqID);
+    ex.persistentBuffer = ptr;
+    ex.persistentCount = count;
+    ex.persistentType = mpiType<T>();
   }
+  return ex.persistentReqID;
 }
 
-void allToAll(double* field, exchangeList_Type const * sendList,
-    exchangeList_Type const * recvList, int fieldDim) {
+template <typename T>
+void allToAllImpl(T* field, exchangeList_Type const * sendList,
+    exchangeList_Type const * recvList, int fieldDim, int numComps,
+    int compStride) {
   int me;
   MPI_Comm_rank(comm, &me);
 
-  for (int iComp = 0; iComp < fieldDim; iComp++) {
-    exchangeList_Type::const_iterator it;
+  const int blockSize = fieldDim * numComps;
+  std::vector<MPI_Request> recvReqs, sendReqs;
+  std::vector<exchange const*> recvExchanges;
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Irecv(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, it->procID, comm, &it->reqID);
-    }
+  exchangeList_Type::const_iterator it;
+  for (it = recvList->begin(); it != recvList->end(); ++it) {
+    if (it->procID == me || it->vec.empty())
+      continue;
+    recvReqs.push_back(getPersistentRequest<T>(*it, false,
+        blockSize * it->vec.size(), it->procID));
+    recvExchanges.push_back(&(*it));
+  }
+  if (!recvReqs.empty())
+    MPI_Startall(recvReqs.size(), &recvReqs[0]);
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      for (ID i = 0; i < it->vec.size(); i++)
-        it->doubleBuffer[i] = field[fieldDim * it->vec[i] + iComp];
+  // Pack all components for a processor contiguously
+  for (it = sendList->begin(); it != sendList->end(); ++it) {
+    if (it->procID == me || it->vec.empty())
+      continue;
+    MPI_Request req = getPersistentRequest<T>(*it, true,
+        blockSize * it->vec.size(), me);
+    std::vector<T>& buffer = exchangeBuffer<T>(*it);
+    for (ID i = 0; i < it->vec.size(); i++)
+      for (int iComp = 0; iComp < numComps; iComp++)
+        for (int j = 0; j < fieldDim; j++)
+          buffer[(numComps * i + iComp) * fieldDim + j] =
+              field[iComp * compStride + fieldDim * it->vec[i] + j];
+    MPI_Start(&req);
+    sendReqs.push_back(req);
+  }
 
-      MPI_Isend(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, me, comm, &it->reqID);
+  // Unpack messages as they arrive
+  const int numRecvs = recvReqs.size();
+  std::vector<int> indices(numRecvs);
+  for (int numDone = 0, count; numDone < numRecvs; numDone += count) {
+    MPI_Waitsome(numRecvs, &recvReqs[0], &count, &indices[0],
+        MPI_STATUSES_IGNORE);
+    for (int k = 0; k < count; k++) {
+      const exchange& ex = *recvExchanges[indices[k]];
+      std::vector<T>& buffer = exchangeBuffer<T>(ex);
+      for (ID i = 0; i < ex.vec.size(); i++)
+        for (int iComp = 0; iComp < numComps; iComp++)
+          for (int j = 0; j < fieldDim; j++)
+            field[iComp * compStride + fieldDim * ex.vec[i] + j] =
+                buffer[(numComps * i + iComp) * fieldDim + j];
     }
+  }
+
+  if (!sendReqs.empty())
+    MPI_Waitall(sendReqs.size(), &sendReqs[0], MPI_STATUSES_IGNORE);
+}
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+} // namespace
 
-      for (int i = 0; i < int(it->vec.size()); i++)
-        field[fieldDim * it->vec[i] + iComp] = it->doubleBuffer[i];
-    }
+void allToAll(std::vector<int>& field, exchangeList_Type const * sendList,
+    exchangeList_Type const * recvList, int fieldDim, int numComps,
+    int compStride) {
+  allToAllImpl(field.data(), sendList, recvList, fieldDim, numComps,
+      compStride);
+}
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-    }
-  }
+void allToAll(double* field, exchangeList_Type const * sendList,
+    exchangeList_Type const * recvList, int fieldDim, int numComps,
+    int compStride) {
+  allToAllImpl(field, sendList, recvList, fieldDim, numComps, compStride);
 }
 
 int initialize_iceProblem(int nTriangles) {
@@ -51,8 +51,22 @@ struct exchange {
   mutable std::vector<double> doubleBuffer;
   mutable MPI_Request reqID;
 
+  // Persistent request used by allToAll, reused across calls as long as
+  // the buffer, its size, and the data type do not change.
+  mutable MPI_Request persistentReqID;
+  mutable void* persistentBuffer;
+  mutable int persistentCount;
+  mutable MPI_Datatype persistentType;
+
   exchange(int _procID, int const* vec_first, int const* vec_last,
       int fieldDim = 1);
+
+  // Persistent requests cannot be shared, so copies start without one
+  exchange(const exchange& src);
+  exchange& operator=(const exchange&) = delete;
+  ~exchange();
+
+  void freePersistentRequest() const;
 };
 
 typedef std::list<exchange> exchangeList_Type;
@@ -203,6 +217,10 @@ double signedTriangleArea(const double* x, const double* y);
 
 double signedTriangleArea(const double* x, const double* y, const double* z);
 
+// Stores the state of the masks that determine the FE mesh, and returns
+// true if it changed on any processor since the last call.
+bool updateFEMeshMaskState();
+
 void createReducedMPI(int nLocalEntities, MPI_Comm& reduced_comm_id);
 
 void importFields(std::vector<std::pair<int, int> >& marineBdyExtensionMap,
@@ -256,11 +274,17 @@ void getProcIds(std::vector<int>& field, exchangeList_Type const* recvList);
 void allToAll(std::vector<int>& field, int const* sendArray,
     int const* recvArray, int fieldDim = 1);
 
+// Exchange numComps components of a field at once. Component iComp of the
+// entry with local id i is stored at field[iComp*compStride + fieldDim*i + j],
+// for j=0,..,fieldDim-1. All components sent to a processor are packed in a
+// single message.
 void allToAll(std::vector<int>& field, exchangeList_Type const* sendList,
-    exchangeList_Type const* recvList, int fieldDim = 1);
+    exchangeList_Type const* recvList, int fieldDim = 1,
+    int numComps = 1, int compStride = 0);
 
 void allToAll(double* field, exchangeList_Type const* sendList,
-    exchangeList_Type const* recvList, int fieldDim = 1);
+    exchangeList_Type const* recvList, int fieldDim = 1,
+    int numComps = 1, int compStride = 0);
 
 void procsSharingVertex(const int vertex, std::vector<int>& procIds);
 